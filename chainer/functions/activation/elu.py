@@ -4,6 +4,7 @@ from chainer.backends import cuda
 from chainer import function_node
 from chainer import utils
 from chainer.utils import type_check
+import chainerx
 
 
 class ELU(function_node.FunctionNode):
@@ -19,6 +20,10 @@ class ELU(function_node.FunctionNode):
 
         type_check.expect(x_type.dtype.kind == 'f')
 
+    def forward_chainerx(self, inputs):
+        x, = inputs
+        return chainerx.elu(x, self.alpha),
+
     def forward_cpu(self, inputs):
         if self.alpha < 0:
             self.retain_inputs((0,))
@@ -2,6 +2,7 @@ from chainer.backends import cuda
 from chainer.backends import intel64
 from chainer import function_node
 from chainer.utils import type_check
+import chainerx
 
 
 _kern = None
@@ -28,6 +29,10 @@ class LeakyReLU(function_node.FunctionNode):
         x_type, = in_types
         type_check.expect(x_type.dtype.kind == 'f')
 
+    def forward_chainerx(self, inputs):
+        x, = inputs
+        return chainerx.leaky_relu(x, self.slope),
+
     def forward_cpu(self, inputs):
         if (intel64.should_use_ideep('>=auto')
                 and intel64.inputs_all_ready(inputs)):
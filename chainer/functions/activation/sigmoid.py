@@ -5,6 +5,7 @@ from chainer.backends import cuda
 from chainer import function_node
 from chainer import utils
 from chainer.utils import type_check
+import chainerx
 
 if cuda.cudnn_enabled:
     cudnn = cuda.cudnn
@@ -19,6 +20,10 @@ class Sigmoid(function_node.FunctionNode):
         type_check._argname(in_types, ('x',))
         type_check.expect(in_types[0].dtype.kind == 'f')
 
+    def forward_chainerx(self, inputs):
+        x, = inputs
+        return chainerx.sigmoid(x),
+
     def forward_cpu(self, inputs):
         x = inputs[0]
         half = x.dtype.type(0.5)
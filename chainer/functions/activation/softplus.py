@@ -5,6 +5,7 @@ from chainer import function_node
 import chainer.functions
 from chainer import utils
 from chainer.utils import type_check
+import chainerx
 
 
 class Softplus(function_node.FunctionNode):
@@ -20,6 +21,10 @@ class Softplus(function_node.FunctionNode):
         x_type, = in_types
         type_check.expect(x_type.dtype.kind == 'f')
 
+    def forward_chainerx(self, inputs):
+        x, = inputs
+        return chainerx.softplus(x, self.beta),
+
     def forward_cpu(self, inputs):
         self.retain_inputs((0,))
         x = inputs[0]
@@ -6,6 +6,7 @@ from chainer.backends import cuda
 from chainer import configuration
 from chainer import function_node
 from chainer.utils import type_check
+import chainerx
 
 
 if cuda.cudnn_enabled:
@@ -39,6 +40,13 @@ class GroupNormalization(function_node.FunctionNode):
             gamma_type.shape == beta_type.shape,
         )
 
+    def forward_chainerx(self, inputs):
+        x, gamma, beta = inputs
+        # Let the generic implementation report indivisible channels.
+        if x.shape[1] % self.groups != 0:
+            return chainer.Fallback
+        return chainerx.group_norm(x, self.groups, gamma, beta, self.eps),
+
     def forward(self, inputs):
         if inputs[0].shape[1] % self.groups != 0:
             raise ValueError('The number of channels {} is not divisible by '
@@ -2,6 +2,7 @@ from chainer import backend
 from chainer import function_node
 import chainer.functions
 from chainer.utils import type_check
+import chainerx
 
 
 class LayerNormalization(function_node.FunctionNode):
@@ -36,6 +37,10 @@ class LayerNormalization(function_node.FunctionNode):
         x_hat = x_mu * inv_std
         return x_mu, var, inv_std, x_hat
 
+    def forward_chainerx(self, inputs):
+        x, gamma, beta = inputs
+        return chainerx.layer_norm(x, gamma, beta, self.eps),
+
     def forward(self, inputs):
         self.retain_inputs((0, 1))
         xp = backend.get_array_module(*inputs)
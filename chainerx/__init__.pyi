@@ -73,7 +73,9 @@ def is_backprop_required(context: tp.Optional[Context]=None) -> bool: ...
 def backward(
         arg0: tp.Union[ndarray, tp.List[ndarray]],
         backprop_id: tp.Optional[BackpropId]=None,
-        enable_double_backprop: bool=...) -> None: ...
+        enable_double_backprop: bool=...,
+        loss_scale: tp.Optional[float]=None,
+        execution_mode: str=...) -> None: ...
 
 
 # python/check_backward.cc
@@ -388,7 +390,9 @@ class ndarray:
     def backward(
             self,
             backprop_id: tp.Optional[BackpropId]=None,
-            enable_double_backprop: bool=...) -> None: ...
+            enable_double_backprop: bool=...,
+            loss_scale: tp.Optional[float]=None,
+            execution_mode: str=...) -> None: ...
 
     def cleargrad(self, backprop_id: tp.Optional[BackpropId]=None) -> None: ...
 
@@ -496,6 +500,8 @@ class ndarray:
 
     def view(self) -> ndarray: ...
 
+    def zerograd(self, backprop_id: tp.Optional[BackpropId]=None) -> None: ...
+
 
 # chainerx_cc/chainerx/python/routines.cc
 def abs(x: ndarray) -> ndarray: ...
@@ -644,6 +650,16 @@ def conv(
         cover_all: bool=False) -> ndarray: ...
 
 
+def conv_bias_activation(
+        x: ndarray,
+        w: ndarray,
+        b: tp.Optional[ndarray]=None,
+        stride: tp.Union[int, tp.Tuple[int, ...]]=...,
+        pad: tp.Union[int, tp.Tuple[int, ...]]=...,
+        cover_all: bool=False,
+        activation: str=...) -> ndarray: ...
+
+
 def conv_transpose(
         x: ndarray,
         w: ndarray,
@@ -738,6 +754,16 @@ def floor(x: ndarray) -> ndarray: ...
 def fmod(x: ndarray) -> ndarray: ...
 
 
+def fold_fixed_batch_norm(
+        w: ndarray,
+        b: tp.Optional[ndarray],
+        gamma: ndarray,
+        beta: ndarray,
+        mean: ndarray,
+        var: ndarray,
+        eps: float=...) -> tp.Tuple[ndarray, ndarray]: ...
+
+
 def frombuffer(
         buffer: tp.Any,
         dtype: tp.Optional[tp.Any]=...,
@@ -764,13 +790,21 @@ def greater(x1: ndarray, x2: ndarray) -> ndarray: ...
 
 def greater_equal(x1: ndarray, x2: ndarray) -> ndarray: ...
 
-def gaussian_kl_divergence(mean: ndarray, ln_var: ndarray, reduce: tp.Optional[str]="sum") -> ndarray: ...
 
-def hinge(x1: ndarray, x2: ndarray, norm: float=1.0) -> ndarray: ...
+def group_norm(
+        x: ndarray,
+        groups: int,
+        gamma: ndarray,
+        beta: ndarray,
+        eps: float=...) -> ndarray: ...
+
+def gaussian_kl_divergence(mean: ndarray, ln_var: ndarray, reduce: str="no") -> ndarray: ...
+
+def hinge(x1: ndarray, x2: ndarray, norm: float=1.0, reduce: str="no") -> ndarray: ...
 
 def hstack(arrays: tp.List[ndarray]) -> ndarray: ...
 
-def huber_loss(x: ndarray, t: ndarray, delta: float,reduce: tp.Optional[str]="sum_along_second_axis") -> ndarray: ...
+def huber_loss(x1: ndarray, x2: ndarray, delta: float, reduce: str="no") -> ndarray: ...
 
 def identity(
         n: int,
@@ -796,6 +830,14 @@ def less(x1: ndarray, x2: ndarray) -> ndarray: ...
 def less_equal(x1: ndarray, x2: ndarray) -> ndarray: ...
 
 
+def layer_norm(
+        x: ndarray,
+        gamma: ndarray,
+        beta: ndarray,
+        eps: float=...,
+        axis: int=...) -> ndarray: ...
+
+
 def linear(
         x: ndarray,
         w: ndarray,
@@ -915,6 +957,13 @@ def reshape(
 @tp.overload
 def reshape(a: ndarray, *args: tp.Any) -> ndarray: ...
 
+def scaled_dot_product_attention(
+        q: ndarray,
+        k: ndarray,
+        v: ndarray,
+        mask: tp.Optional[ndarray]=None,
+        scale: tp.Optional[float]=None) -> ndarray: ...
+
 def sign(x: ndarray) -> ndarray: ...
 
 def sin(x: ndarray) -> ndarray: ...
@@ -925,7 +974,8 @@ def sigmoid(x: ndarray) -> ndarray: ...
 
 def sigmoid_cross_entropy(
         x1: ndarray,
-        x2: ndarray) -> ndarray: ...
+        x2: ndarray,
+        reduce: str="no") -> ndarray: ...
 
 def relu(x: ndarray) -> ndarray: ...
 
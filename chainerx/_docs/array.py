@@ -200,7 +200,8 @@ Returns:
 
     _docs.set_doc(
         ndarray.backward,
-        """backward(backprop_id=None, enable_double_backprop=False)
+        """backward(backprop_id=None, enable_double_backprop=False, \
+loss_scale=None, execution_mode='serial')
 Performs backpropagation starting from this array.
 
 This method is equivalent to ``chainerx.backward([self], *args)``.
@@ -419,4 +420,15 @@ Returns a view of the array.
 
 The returned array shares the underlying buffer, though it has a different
 identity as a Python object.
+""")
+
+    _docs.set_doc(
+        ndarray.zerograd,
+        """zerograd(backprop_id=None)
+Sets the gradient held by this array to zeros.
+
+The buffer of the current gradient is reused unless it is shared with other
+arrays. Since :func:`chainerx.backward` accumulates gradients into such a
+buffer in place, gradients can be accumulated over multiple backward calls,
+e.g. over micro-batches, without allocating new buffers.
 """)
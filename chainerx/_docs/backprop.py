@@ -5,7 +5,8 @@ from chainerx import _docs
 def set_docs():
     _docs.set_doc(
         chainerx.backward,
-        """backward(outputs, *, enable_double_backprop=False)
+        """backward(outputs, *, enable_double_backprop=False, \
+execution_mode='serial')
 Runs backpropagation.
 
 On backpropagation (a.k.a. backprop),
@@ -27,8 +28,8 @@ computation.
 Note:
     The whole process of backpropagation is executed in C++, except those
     operations whose backward computation falls back to the corresponding
-    Python implementation. Currently this function does not release the GIL at
-    all.
+    Python implementation. The GIL is released only if a parallel
+    ``execution_mode`` is given.
 
 Args:
     outputs (~chainerx.ndarray or list of ndarrays):
@@ -37,6 +38,15 @@ Args:
         a computational trace of the whole backpropagation procedure is
         recorded to the computational graph so that one can further do
         backpropagation from the resulting gradients.
+    execution_mode (str): ``'serial'``, ``'parallel_deterministic'`` or
+        ``'parallel'``. The parallel modes run the backward computations of
+        independent operations concurrently on a thread pool.
+        ``'parallel_deterministic'`` accumulates the gradients in the same
+        order as ``'serial'`` so that the results are bitwise identical,
+        while ``'parallel'`` accumulates them as soon as they are computed.
+        The parallel modes fall back to the serial execution if
+        ``enable_double_backprop`` is ``True``, if a loss scale is given or if
+        the graph is not the default one.
 
 .. seealso::
     * :meth:`chainerx.ndarray.backward`
@@ -44,7 +54,8 @@ Args:
 
     _docs.set_doc(
         chainerx.grad,
-        """grad(outputs, inputs, *, enable_double_backprop=False)
+        """grad(outputs, inputs, *, enable_double_backprop=False, \
+execution_mode='serial')
 Computes and returns the gradients of the outputs w.r.t. the inputs.
 
 This function differs from :func:`chainerx.backward` in the sense that
@@ -63,6 +74,8 @@ Args:
         a computational trace of the whole backpropagation procedure is
         recorded to the computational graph so that one can further do
         backpropagation from the resulting gradients.
+    execution_mode (str): ``'serial'``, ``'parallel_deterministic'`` or
+        ``'parallel'``. See :func:`chainerx.backward`.
 
 Returns:
     list of :class:`~chainerx.ndarray`\\ s:
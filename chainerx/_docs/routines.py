@@ -1186,6 +1186,9 @@ Args:
     t (~chainerx.ndarray): Target variable for regression.
     delta (float): Constant variable for Huber loss function as used in
         definition.
+    reduce (str): Reduction option. ``'no'`` returns the elementwise
+        losses. ``'sum'`` and ``'mean'`` return their sum and mean over all
+        the elements as a 0-dimensional array.
 
 Returns:
     :class:`~chainerx.ndarray`:
@@ -1218,6 +1221,9 @@ Args:
     ln_var (~chainerx.ndarray):
         A variable representing logarithm of
         variance of given gaussian distribution, :math:`\\log(\\sigma^2)`.
+    reduce (str): Reduction option. ``'no'`` returns the elementwise
+        losses. ``'sum'`` and ``'mean'`` return their sum and mean over all
+        the elements as a 0-dimensional array.
 
 Returns:
     :class:`~chainerx.ndarray`:
@@ -1229,7 +1235,7 @@ Returns:
 
     _docs.set_doc(
         chainerx.sigmoid_cross_entropy,
-        """sigmoid_cross_entropy(x1, x2)
+        """sigmoid_cross_entropy(x1, x2, reduce='no')
 
 Element-wise cross entropy loss for pre-sigmoid activations.
 
@@ -1240,6 +1246,10 @@ Args:
         integer vector of ground truth labels 0 or 1. If ``x2[i, j] == -1``,
         corresponding ``x1[i, j]`` is ignored. Loss is zero if all ground truth
         labels are -1.
+    reduce (str): Reduction option. ``'no'`` returns the elementwise
+        losses. ``'sum'`` and ``'mean'`` return their sum and mean over all
+        the elements as a 0-dimensional array.
+        Ignored elements count towards the denominator of ``'mean'``.
 
 Returns:
     :class:`~chainerx.ndarray`: An array of the cross entropy.
@@ -2976,6 +2986,52 @@ astype(np.float32)
     True
 """)
 
+    _docs.set_doc(
+        chainerx.conv_bias_activation,
+        """conv_bias_activation(x, w, b=None, stride=1, pad=0, \
+cover_all=False, activation='relu')
+N-dimensional convolution followed by the bias and the activation, for
+inference.
+
+The result is the same as :func:`~chainerx.conv` followed by the activation,
+but the activation is applied in place on the convolution output without
+allocating another array. Together with
+:func:`~chainerx.fold_fixed_batch_norm`, it computes a convolution, a fixed
+batch normalization and an activation in a single call.
+
+Args:
+    x (~chainerx.ndarray):
+        Input array of shape :math:`(n, c_I, d_1, d_2, ..., d_N)`.
+    w (~chainerx.ndarray):
+        Weight array of shape :math:`(c_O, c_I, k_1, k_2, ..., k_N)`.
+    b (None or ~chainerx.ndarray):
+        One-dimensional bias array with length :math:`c_O` (optional).
+    stride (:class:`int` or :class:`tuple` of :class:`int` s):
+        Stride of filter applications :math:`(s_1, s_2, ..., s_N)`.
+        ``stride=s`` is equivalent to ``(s, s, ..., s)``.
+    pad (:class:`int` or :class:`tuple` of :class:`int` s):
+        Spatial padding width for input arrays
+        :math:`(p_1, p_2, ..., p_N)`. ``pad=p`` is equivalent to
+        ``(p, p, ..., p)``.
+    cover_all (bool): If ``True``, all spatial locations are convoluted
+        into some output pixels. It may make the output size larger.
+        `cover_all` needs to be ``False`` if you want to use ``cuda`` backend.
+    activation (str): Activation applied to the output. Either ``'none'``
+        or ``'relu'``.
+
+Returns:
+    ~chainerx.ndarray:
+        Output array of shape :math:`(n, c_O, l_1, l_2, ..., l_N)`.
+
+Note:
+    The output dtype must be a floating-point dtype.
+
+Note:
+    If any of the inputs require gradients, the output is computed with
+    :func:`~chainerx.conv` and the activation, and the gradients are
+    propagated as usual.
+""")
+
     _docs.set_doc(
         chainerx.conv_transpose,
         """conv_transpose(x, w, b=None, stride=1, pad=0, outsize=None)
@@ -3221,6 +3277,40 @@ See the original paper proposing LSTM with forget gates:
     different kind of input sources.
 """)
 
+    _docs.set_doc(
+        chainerx.scaled_dot_product_attention,
+        """scaled_dot_product_attention(q, k, v, mask=None, scale=None)
+Scaled dot-product attention.
+
+It computes
+
+.. math:: y = \\mathrm{softmax}(\\mathrm{scale} \\cdot qk^\\top) v,
+
+where the softmax is taken over the keys.
+
+The native implementation never stores the :math:`(L_q, L_k)` attention
+probabilities. It computes them tile by tile with a running softmax and
+recomputes them during backpropagation.
+
+Args:
+    q (~chainerx.ndarray): Queries of shape :math:`(..., L_q, d)`.
+    k (~chainerx.ndarray): Keys of shape :math:`(..., L_k, d)`.
+    v (~chainerx.ndarray): Values of shape :math:`(..., L_k, d_v)`.
+    mask (~chainerx.ndarray): Boolean array (optional) broadcastable to
+        :math:`(..., L_q, L_k)`. Keys for which the mask is ``False`` are
+        ignored. Queries whose keys are all masked yield zeros.
+    scale (float): Scale of the scores. The default is
+        :math:`1 / \\sqrt{d}`.
+
+Returns:
+    :class:`~chainerx.ndarray`:
+        Output array of shape :math:`(..., L_q, d_v)`.
+
+Note:
+    During backpropagation, this function propagates the gradient of the
+    output array to input arrays ``q``, ``k`` and ``v``.
+""")
+
 
 def _docs_normalization():
     _docs.set_doc(
@@ -3285,6 +3375,90 @@ Note:
     During backpropagation, this function does not propagate gradients.
 """)
 
+    _docs.set_doc(
+        chainerx.fold_fixed_batch_norm,
+        """fold_fixed_batch_norm(w, b, gamma, beta, mean, var, eps=2e-5)
+Folds fixed batch normalization into the preceding layer's parameters.
+
+Given the weights and the bias of a convolution or a linear layer followed by
+:func:`~chainerx.fixed_batch_norm` over its output channels, computes the
+weights and the bias with which the layer alone gives the normalized
+output. The normalization pass can then be removed at inference.
+
+Args:
+    w (~chainerx.ndarray): Weight array whose first axis is the output
+        channel axis, e.g. of shape :math:`(c_O, c_I, k_1, ..., k_N)` for
+        :func:`~chainerx.conv` or :math:`(c_O, c_I)` for
+        :func:`~chainerx.linear`.
+    b (None or ~chainerx.ndarray): Bias array of shape :math:`(c_O,)`, or
+        ``None`` if the layer has no bias.
+    gamma (~chainerx.ndarray): Scaling parameter of normalized data.
+    beta (~chainerx.ndarray): Shifting parameter of scaled normalized data.
+    mean (~chainerx.ndarray): Shifting parameter of input.
+    var (~chainerx.ndarray): Square of scaling parameter of input.
+    eps (float): Epsilon value for numerical stability.
+
+Returns:
+    tuple of :class:`~chainerx.ndarray` s: The folded weights with the same
+    shape as ``w`` and the folded bias of shape :math:`(c_O,)`.
+""")
+
+    _docs.set_doc(
+        chainerx.layer_norm,
+        """layer_norm(x, gamma, beta, eps=1e-5, axis=-1)
+Layer normalization function.
+
+The input array is normalized over the axes from ``axis`` to the last one
+using statistics computed per sample, and then scaled by ``gamma`` and
+shifted by ``beta``.
+
+Args:
+    x (~chainerx.ndarray): Input array.
+    gamma (~chainerx.ndarray): Scaling parameter of normalized data. Its
+        size must be equal to the size of the normalized axes.
+    beta (~chainerx.ndarray): Shifting parameter of scaled normalized data.
+        Its size must be equal to the size of the normalized axes.
+    eps (float): Epsilon value for numerical stability.
+    axis (int): The first axis to be normalized.
+
+Returns:
+    :class:`~chainerx.ndarray`: Output array with the same shape as ``x``.
+
+Note:
+    During backpropagation, this function propagates the gradient of the
+    output array to the input arrays ``x``, ``gamma`` and ``beta``.
+
+See: `Layer Normalization <https://arxiv.org/abs/1607.06450>`_
+""")
+
+    _docs.set_doc(
+        chainerx.group_norm,
+        """group_norm(x, groups, gamma, beta, eps=1e-5)
+Group normalization function.
+
+The channels of the input array of shape ``(batch_size, channels, ...)``
+are divided into ``groups`` groups. Each group is normalized using
+statistics computed per sample, and then scaled by ``gamma`` and shifted by
+``beta`` per channel.
+
+Args:
+    x (~chainerx.ndarray): Input array.
+    groups (int): The number of channel groups. It must divide the number
+        of channels.
+    gamma (~chainerx.ndarray): Scaling parameter of shape ``(channels,)``.
+    beta (~chainerx.ndarray): Shifting parameter of shape ``(channels,)``.
+    eps (float): Epsilon value for numerical stability.
+
+Returns:
+    :class:`~chainerx.ndarray`: Output array with the same shape as ``x``.
+
+Note:
+    During backpropagation, this function propagates the gradient of the
+    output array to the input arrays ``x``, ``gamma`` and ``beta``.
+
+See: `Group Normalization <https://arxiv.org/abs/1803.08494>`_
+""")
+
 
 def _docs_pooling():
     _docs.set_doc(
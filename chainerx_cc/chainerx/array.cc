@@ -87,7 +87,9 @@ std::vector<std::shared_ptr<ArrayBody>> MoveArrayBodies(std::vector<absl::option
 Array::Array(const Shape& shape, const Strides& strides, Dtype dtype, Device& device, std::shared_ptr<void> data, int64_t offset)
     : body_{internal::CreateArrayBody(shape, strides, dtype, device, std::move(data), offset)} {}
 
-Array Array::operator-() const { return Negative(*this); }
+Array Array::operator-() const& { return Negative(*this); }
+
+Array Array::operator-() && { return Negative(std::move(*this)); }
 
 Array Array::operator==(const Array& rhs) const { return Equal(*this, rhs); }
 
@@ -301,21 +303,53 @@ const Array& Array::operator>>=(Scalar rhs) const {
     return *this;
 }
 
-Array Array::operator+(const Array& rhs) const { return chainerx::Add(*this, rhs); }
+Array Array::operator+(const Array& rhs) const& { return chainerx::Add(*this, rhs); }
+
+Array Array::operator+(const Array& rhs) && { return chainerx::Add(std::move(*this), rhs); }
+
+Array Array::operator+(Array&& rhs) const& { return chainerx::Add(*this, std::move(rhs)); }
+
+Array Array::operator+(Array&& rhs) && { return chainerx::Add(std::move(*this), std::move(rhs)); }
+
+Array Array::operator+(Scalar rhs) const& { return chainerx::Add(*this, rhs); }
+
+Array Array::operator+(Scalar rhs) && { return chainerx::Add(std::move(*this), rhs); }
+
+Array Array::operator-(const Array& rhs) const& { return chainerx::Subtract(*this, rhs); }
+
+Array Array::operator-(const Array& rhs) && { return chainerx::Subtract(std::move(*this), rhs); }
+
+Array Array::operator-(Array&& rhs) const& { return chainerx::Subtract(*this, std::move(rhs)); }
+
+Array Array::operator-(Array&& rhs) && { return chainerx::Subtract(std::move(*this), std::move(rhs)); }
+
+Array Array::operator-(Scalar rhs) const& { return chainerx::Subtract(*this, rhs); }
+
+Array Array::operator-(Scalar rhs) && { return chainerx::Subtract(std::move(*this), rhs); }
+
+Array Array::operator*(const Array& rhs) const& { return Multiply(*this, rhs); }
+
+Array Array::operator*(const Array& rhs) && { return Multiply(std::move(*this), rhs); }
+
+Array Array::operator*(Array&& rhs) const& { return Multiply(*this, std::move(rhs)); }
 
-Array Array::operator+(Scalar rhs) const { return chainerx::Add(*this, rhs); }
+Array Array::operator*(Array&& rhs) && { return Multiply(std::move(*this), std::move(rhs)); }
 
-Array Array::operator-(const Array& rhs) const { return chainerx::Subtract(*this, rhs); }
+Array Array::operator*(Scalar rhs) const& { return Multiply(*this, rhs); }
 
-Array Array::operator-(Scalar rhs) const { return chainerx::Subtract(*this, rhs); }
+Array Array::operator*(Scalar rhs) && { return Multiply(std::move(*this), rhs); }
 
-Array Array::operator*(const Array& rhs) const { return Multiply(*this, rhs); }
+Array Array::operator/(const Array& rhs) const& { return chainerx::Divide(*this, rhs); }
 
-Array Array::operator*(Scalar rhs) const { return Multiply(*this, rhs); }
+Array Array::operator/(const Array& rhs) && { return chainerx::Divide(std::move(*this), rhs); }
 
-Array Array::operator/(const Array& rhs) const { return chainerx::Divide(*this, rhs); }
+Array Array::operator/(Array&& rhs) const& { return chainerx::Divide(*this, std::move(rhs)); }
 
-Array Array::operator/(Scalar rhs) const { return chainerx::Divide(*this, rhs); }
+Array Array::operator/(Array&& rhs) && { return chainerx::Divide(std::move(*this), std::move(rhs)); }
+
+Array Array::operator/(Scalar rhs) const& { return chainerx::Divide(*this, rhs); }
+
+Array Array::operator/(Scalar rhs) && { return chainerx::Divide(std::move(*this), rhs); }
 
 Array Array::operator%(const Array& rhs) const { return chainerx::Mod(*this, rhs); }
 
@@ -440,7 +474,10 @@ Array Array::ToDevice(Device& dst_device) const {
 Array Array::ToNative() const {
     Backend& backend = device().backend();
     Device& native_device = backend.IsNative() ? device() : backend.context().GetNativeBackend().GetDevice(0);
-    return ToDevice(native_device);
+    Array out = ToDevice(native_device);
+    // The data may still be written by kernel calls queued on the native device.
+    native_device.Synchronize();
+    return out;
 }
 
 namespace {
@@ -518,6 +555,22 @@ void Array::SetGrad(Array grad, const absl::optional<BackpropId>& backprop_id) c
     internal::SetGrad(*target_grad, std::move(grad), shape(), dtype(), device());
 }
 
+void Array::ZeroGrad(const absl::optional<BackpropId>& backprop_id) const {
+    BackpropId actual_backprop_id = internal::GetArrayBackpropId(*this, backprop_id);
+    absl::optional<Array>* target_grad = body_->GetGrad(actual_backprop_id);
+    if (target_grad == nullptr) {
+        throw ChainerxError{"Array is constant with respect to the computation for backprop ID: '", actual_backprop_id, "'."};
+    }
+
+    RequireGrad(actual_backprop_id);
+
+    if (target_grad->has_value() && internal::IsGradUniquelyOwned(**target_grad)) {
+        (*target_grad)->Fill(0);
+    } else {
+        *target_grad = Zeros(shape(), dtype(), device());
+    }
+}
+
 void Array::ClearGrad(const absl::optional<BackpropId>& backprop_id) const {
     BackpropId actual_backprop_id = internal::GetArrayBackpropId(*this, backprop_id);
     if (!body_->HasArrayNode(actual_backprop_id)) {
@@ -559,9 +612,12 @@ template Array& Array::RequireGradImpl<Array>(Array& array, const absl::optional
 std::string Array::ToString() const { return ArrayRepr(*this); }
 
 Array operator+(Scalar lhs, const Array& rhs) { return Add(lhs, rhs); }
+Array operator+(Scalar lhs, Array&& rhs) { return Add(lhs, std::move(rhs)); }
 Array operator-(Scalar lhs, const Array& rhs) { return Subtract(lhs, rhs); }
 Array operator*(Scalar lhs, const Array& rhs) { return Multiply(lhs, rhs); }
+Array operator*(Scalar lhs, Array&& rhs) { return Multiply(lhs, std::move(rhs)); }
 Array operator/(Scalar lhs, const Array& rhs) { return Divide(lhs, rhs); }
+Array operator/(Scalar lhs, Array&& rhs) { return Divide(lhs, std::move(rhs)); }
 Array operator%(Scalar lhs, const Array& rhs) { return Mod(lhs, rhs); }
 
 Array operator<<(Scalar lhs, const Array& rhs) { return LeftShift(lhs, rhs); }
@@ -67,7 +67,9 @@ public:
     Array& operator=(const Array&) = default;
     Array& operator=(Array&& other) = default;
 
-    Array operator-() const;
+    // Operators on temporaries may reuse their buffers for the results. See routines/arithmetic.h.
+    Array operator-() const&;
+    Array operator-() &&;
 
     Array operator==(const Array& rhs) const;
     Array operator!=(const Array& rhs) const;
@@ -118,14 +120,30 @@ public:
     const Array& operator>>=(const Array& rhs) const;
     const Array& operator>>=(Scalar rhs) const;
 
-    Array operator+(const Array& rhs) const;
-    Array operator+(Scalar rhs) const;
-    Array operator-(const Array& rhs) const;
-    Array operator-(Scalar rhs) const;
-    Array operator*(const Array& rhs) const;
-    Array operator*(Scalar rhs) const;
-    Array operator/(const Array& rhs) const;
-    Array operator/(Scalar rhs) const;
+    Array operator+(const Array& rhs) const&;
+    Array operator+(const Array& rhs) &&;
+    Array operator+(Array&& rhs) const&;
+    Array operator+(Array&& rhs) &&;
+    Array operator+(Scalar rhs) const&;
+    Array operator+(Scalar rhs) &&;
+    Array operator-(const Array& rhs) const&;
+    Array operator-(const Array& rhs) &&;
+    Array operator-(Array&& rhs) const&;
+    Array operator-(Array&& rhs) &&;
+    Array operator-(Scalar rhs) const&;
+    Array operator-(Scalar rhs) &&;
+    Array operator*(const Array& rhs) const&;
+    Array operator*(const Array& rhs) &&;
+    Array operator*(Array&& rhs) const&;
+    Array operator*(Array&& rhs) &&;
+    Array operator*(Scalar rhs) const&;
+    Array operator*(Scalar rhs) &&;
+    Array operator/(const Array& rhs) const&;
+    Array operator/(const Array& rhs) &&;
+    Array operator/(Array&& rhs) const&;
+    Array operator/(Array&& rhs) &&;
+    Array operator/(Scalar rhs) const&;
+    Array operator/(Scalar rhs) &&;
     Array operator%(const Array& rhs) const;
     Array operator%(Scalar rhs) const;
     Array operator&(const Array& rhs) const;
@@ -225,6 +243,7 @@ public:
     // Transfer the array to the native device. It will be connected to all the graphs.
     //
     // This is a wrapper function which calls Array::ToDevice with the native:0 device.
+    // The data of the returned array can be read on the host, after the native device completes the kernel calls queued on it, if any.
     // See also: Array::ToDevice();
     Array ToNative() const;
 
@@ -260,6 +279,15 @@ public:
     // This function ignores no/force-backprop mode.
     void SetGrad(Array grad, const absl::optional<BackpropId>& backprop_id = absl::nullopt) const;
 
+    // Sets the gradient of the array to zeros.
+    // The buffer of the current gradient is reused if it is not shared with other arrays. Since Backward() accumulates into such a
+    // buffer in place, gradients can be accumulated over multiple backward calls without allocation.
+    // This function also flags the array as requiring gradient.
+    //
+    // ChainerxError is thrown if the array is constant with respect to the computation for the specified backprop ID.
+    // This function ignores no/force-backprop mode.
+    void ZeroGrad(const absl::optional<BackpropId>& backprop_id = absl::nullopt) const;
+
     // Clears the gradient of the array if set.
     // This function does not change the state of the array other than that. For example, if the array is flagged as requiring gradient,
     // that will not change.
@@ -332,9 +360,12 @@ private:
 };
 
 Array operator+(Scalar lhs, const Array& rhs);
+Array operator+(Scalar lhs, Array&& rhs);
 Array operator-(Scalar lhs, const Array& rhs);
 Array operator*(Scalar lhs, const Array& rhs);
+Array operator*(Scalar lhs, Array&& rhs);
 Array operator/(Scalar lhs, const Array& rhs);
+Array operator/(Scalar lhs, Array&& rhs);
 Array operator%(Scalar lhs, const Array& rhs);
 
 Array operator<<(Scalar lhs, const Array& rhs);
@@ -12,6 +12,7 @@
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
+#include "chainerx/graph_node_pool.h"
 #include "chainerx/macro.h"
 
 namespace chainerx {
@@ -43,6 +44,8 @@ std::shared_ptr<ArrayBody> CreateArrayBody(ArrayBody::Params params) {
 
 const std::shared_ptr<ArrayNode> ArrayBody::kNullArrayNode{nullptr};
 
+const ArrayBody::GraphStorage ArrayBody::kEmptyGraphStorage{};
+
 ArrayBody::ArrayBody(
         const Shape& shape,  // NOLINT(modernize-pass-by-value)
         const Strides& strides,  // NOLINT(modernize-pass-by-value)
@@ -62,44 +65,54 @@ const std::shared_ptr<ArrayNode>& ArrayBody::AddNode(const std::shared_ptr<Array
     // as a retained output of backward)
     CHAINERX_ASSERT(array_node->weak_body().expired());
 
-    auto it = std::find_if(body->nodes_.begin(), body->nodes_.end(), [&array_node](const std::shared_ptr<ArrayNode>& existing_node) {
+    GraphStorage& graph = body->GetOrCreateGraphStorage();
+    auto it = std::find_if(graph.nodes.begin(), graph.nodes.end(), [&array_node](const std::shared_ptr<ArrayNode>& existing_node) {
         return existing_node->backprop_id() == array_node->backprop_id();
     });
-    if (it != body->nodes_.end()) {
+    if (it != graph.nodes.end()) {
         return *it;  // Do nothing and return the existing ArrayNode if found for this graph.
     }
 
     // Connect the new backprop ID and the existing backprop IDs in this array body.
-    for (const std::shared_ptr<ArrayNode>& existing_array_node : body->nodes_) {
+    for (const std::shared_ptr<ArrayNode>& existing_array_node : graph.nodes) {
         existing_array_node->device().context().ConnectBackpropIds(existing_array_node->backprop_id(), array_node->backprop_id());
     }
 
     array_node->weak_body_ = body;
 
-    body->nodes_.emplace_back(std::move(array_node));
-    body->grads_.emplace_back(std::make_unique<absl::optional<Array>>(absl::nullopt));
+    graph.nodes.emplace_back(std::move(array_node));
+    graph.grads.emplace_back(std::make_unique<absl::optional<Array>>(absl::nullopt));
 
     body->AssertConsistency();
-    return body->nodes_.back();
+    return graph.nodes.back();
 }
 
 const std::shared_ptr<ArrayNode>& ArrayBody::CreateArrayNode(const std::shared_ptr<ArrayBody>& body, const BackpropId& backprop_id) {
     CHAINERX_ASSERT(GetKind(body->dtype()) == DtypeKind::kFloat);
-    return AddNode(body, std::make_shared<ArrayNode>(body->shape_, body->dtype_, body->device_, backprop_id));
+    return AddNode(body, MakeSharedGraphNode<ArrayNode>(body->shape_, body->dtype_, body->device_, backprop_id));
+}
+
+ArrayBody::GraphStorage& ArrayBody::GetOrCreateGraphStorage() {
+    if (graph_ == nullptr) {
+        graph_ = std::make_unique<GraphStorage>();
+    }
+    return *graph_;
 }
 
 void ArrayBody::AssertConsistency() const {
     if (CHAINERX_DEBUG) {
+        const GraphStorage& graph = graph_ == nullptr ? kEmptyGraphStorage : *graph_;
+
         // Array with integral dtypes can neither have array nodes nor gradients.
         if (GetKind(dtype()) != DtypeKind::kFloat) {
-            CHAINERX_ASSERT(nodes_.empty());
-            CHAINERX_ASSERT(grads_.empty());
+            CHAINERX_ASSERT(graph.nodes.empty());
+            CHAINERX_ASSERT(graph.grads.empty());
         }
 
-        CHAINERX_ASSERT(nodes_.size() == grads_.size());
-        for (size_t i = 0; i < nodes_.size(); ++i) {
-            const std::shared_ptr<ArrayNode>& array_node = nodes_[i];
-            const absl::optional<Array>& grad = *grads_[i];
+        CHAINERX_ASSERT(graph.nodes.size() == graph.grads.size());
+        for (size_t i = 0; i < graph.nodes.size(); ++i) {
+            const std::shared_ptr<ArrayNode>& array_node = graph.nodes[i];
+            const absl::optional<Array>& grad = *graph.grads[i];
             CHAINERX_ASSERT(array_node != nullptr);
             CHAINERX_ASSERT(this == array_node->weak_body().lock().get());
 
@@ -114,8 +127,11 @@ void ArrayBody::AssertConsistency() const {
 }
 
 absl::optional<size_t> ArrayBody::GetNodeIndex(const BackpropId& backprop_id) const {
-    for (size_t i = 0; i < nodes_.size(); ++i) {
-        if (nodes_[i]->backprop_id() == backprop_id) {
+    if (graph_ == nullptr) {
+        return absl::nullopt;
+    }
+    for (size_t i = 0; i < graph_->nodes.size(); ++i) {
+        if (graph_->nodes[i]->backprop_id() == backprop_id) {
             return i;
         }
     }
@@ -140,8 +156,8 @@ ReturnType ArrayBody::GetGradImpl(ThisPtr this_ptr, const BackpropId& backprop_i
     if (!i.has_value()) {
         return nullptr;
     }
-    CHAINERX_ASSERT(*i < this_ptr->grads_.size());
-    return this_ptr->grads_[*i].get();
+    CHAINERX_ASSERT(*i < this_ptr->graph_->grads.size());
+    return this_ptr->graph_->grads[*i].get();
 }
 
 template absl::optional<Array>* ArrayBody::GetGradImpl<ArrayBody*, absl::optional<Array>*>(ArrayBody*, const BackpropId&);
@@ -55,14 +55,17 @@ public:
 
     int64_t offset() const { return offset_; }
 
+    // Replaces the buffer of the array, e.g. to relocate it into a workspace planned for a static graph.
+    // The new buffer must be at least as large as the current one. Its contents are not initialized.
+    void ReplaceData(std::shared_ptr<void> data) { data_ = std::move(data); }
+
     // Returns the list of backprop IDs whose gradients are marked as required.
     // This does not take backprop mode into account.
-    const std::vector<BackpropId>& grad_required_backprop_ids() const { return grad_required_backprop_ids_; }
-
-    const std::vector<std::shared_ptr<ArrayNode>>& nodes() const { return nodes_; }
+    const std::vector<BackpropId>& grad_required_backprop_ids() const {
+        return graph_ == nullptr ? kEmptyGraphStorage.grad_required_backprop_ids : graph_->grad_required_backprop_ids;
+    }
 
-    // TODO(niboshi): Remove this function and add another to assign an array node at a specified index.
-    std::vector<std::shared_ptr<ArrayNode>>& nodes() { return nodes_; }
+    const std::vector<std::shared_ptr<ArrayNode>>& nodes() const { return graph_ == nullptr ? kEmptyGraphStorage.nodes : graph_->nodes; }
 
     int64_t GetItemSize() const { return chainerx::GetItemSize(dtype()); }
 
@@ -72,8 +75,8 @@ public:
     // This does not take backprop mode into account.
     bool IsGradRequired(const BackpropId& backprop_id) const {
         backprop_id.CheckValid();
-        return grad_required_backprop_ids_.end() !=
-               std::find(grad_required_backprop_ids_.begin(), grad_required_backprop_ids_.end(), backprop_id);
+        const std::vector<BackpropId>& ids = grad_required_backprop_ids();
+        return ids.end() != std::find(ids.begin(), ids.end(), backprop_id);
     }
 
     // Mark the gradient of the specified backprop ID as required.
@@ -82,9 +85,8 @@ public:
         backprop_id.CheckValid();
         CHAINERX_ASSERT(GetKind(body->dtype_) == DtypeKind::kFloat);
 
-        if (body->grad_required_backprop_ids_.end() ==
-            std::find(body->grad_required_backprop_ids_.begin(), body->grad_required_backprop_ids_.end(), backprop_id)) {
-            body->grad_required_backprop_ids_.emplace_back(backprop_id);
+        if (!body->IsGradRequired(backprop_id)) {
+            body->GetOrCreateGraphStorage().grad_required_backprop_ids.emplace_back(backprop_id);
 
             if (!body->HasArrayNode(backprop_id)) {
                 CreateArrayNode(body, backprop_id);
@@ -99,7 +101,7 @@ public:
     const std::shared_ptr<ArrayNode>& GetArrayNode(const BackpropId& backprop_id) const {
         absl::optional<size_t> index = GetNodeIndex(backprop_id);
         if (index.has_value()) {
-            return nodes_[*index];
+            return graph_->nodes[*index];
         }
 
         return kNullArrayNode;
@@ -142,6 +144,14 @@ public:
     void ClearGrad(const BackpropId& backprop_id);
 
 private:
+    // Members related to backprop graphs. They are allocated on demand so that arrays which never join a graph, e.g. those computed in
+    // inference, stay small.
+    struct GraphStorage {
+        std::vector<BackpropId> grad_required_backprop_ids;
+        std::vector<std::shared_ptr<ArrayNode>> nodes;
+        std::vector<std::unique_ptr<absl::optional<Array>>> grads;
+    };
+
     friend std::shared_ptr<ArrayBody> CreateArrayBody(
             const Shape& shape, const Strides& strides, Dtype dtype, Device& device, std::shared_ptr<void> data, int64_t offset);
 
@@ -161,10 +171,15 @@ private:
 
     absl::optional<size_t> GetNodeIndex(const BackpropId& backprop_id) const;
 
+    GraphStorage& GetOrCreateGraphStorage();
+
     // The use of non-POD static storage object here is safe, because destructing a shared_ptr with nullptr does not incur any
     // destruction order problem.
     static const std::shared_ptr<ArrayNode> kNullArrayNode;
 
+    // Returned by the accessors of arrays without graph storage. Safe for the same reason as above, since the vectors are always empty.
+    static const GraphStorage kEmptyGraphStorage;
+
     Shape shape_;
     Strides strides_;
     Dtype dtype_;
@@ -172,9 +187,8 @@ private:
     std::shared_ptr<void> data_;
     int64_t offset_;  // in bytes
 
-    std::vector<BackpropId> grad_required_backprop_ids_;
-    std::vector<std::shared_ptr<ArrayNode>> nodes_;
-    std::vector<std::unique_ptr<absl::optional<Array>>> grads_;
+    // Null until the array joins a graph or its gradient is required.
+    std::unique_ptr<GraphStorage> graph_;
 };
 
 std::shared_ptr<ArrayBody> CreateArrayBody(
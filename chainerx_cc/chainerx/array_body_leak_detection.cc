@@ -9,6 +9,7 @@
 #include "chainerx/array.h"
 #include "chainerx/array_body.h"
 #include "chainerx/array_node.h"
+#include "chainerx/device.h"
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
 #include "chainerx/macro.h"
@@ -63,6 +64,10 @@ ArrayBodyLeakDetectionScope ::ArrayBodyLeakDetectionScope(ArrayBodyLeakTracker&
 ArrayBodyLeakDetectionScope ::~ArrayBodyLeakDetectionScope() { array_body_leak_tracker_ = nullptr; }
 
 void CheckAllArrayBodiesFreed(ArrayBodyLeakTracker& tracker) {
+    // Array bodies may still be held by the kernel calls queued on the devices executing kernels asynchronously.
+    for (const std::shared_ptr<ArrayBody>& array_body : tracker.GetAliveArrayBodies()) {
+        array_body->device().Synchronize();
+    }
     std::ostringstream os;
     if (!tracker.IsAllArrayBodiesFreed(os)) {
         throw ChainerxError{os.str()};
@@ -33,6 +33,7 @@
 #include "chainerx/indexable_array.h"
 #include "chainerx/indexer.h"
 #include "chainerx/op_node.h"
+#include "chainerx/routines/creation.h"
 #include "chainerx/routines/indexing.h"
 #include "chainerx/scalar.h"
 #include "chainerx/shape.h"
@@ -674,6 +675,57 @@ TEST_P(ArrayTest, DivideScalar) {
     EXPECT_ARRAY_EQ(e, o);
 }
 
+TEST_P(ArrayTest, ArithmeticDonateTemporaries) {
+    Array a = testing::BuildArray({3, 1}).WithData<float>({1, 2, 3});
+    Array b = testing::BuildArray({3, 1}).WithData<float>({4, 5, 6});
+    Array c = testing::BuildArray({3, 1}).WithData<float>({1, 1, 2});
+    Array e = testing::BuildArray({3, 1}).WithData<float>({-1.5f, -3.5f, -7.f});
+    Device& device = a.device();
+    size_t allocated_bytes = device.allocated_bytes();
+    device.ResetPeakAllocatedBytes();
+
+    // Only the result of a * b is allocated; the other operations write into it.
+    Array o = -((a * b + c) / 2 - a);
+    EXPECT_EQ(allocated_bytes + o.GetNBytes(), device.allocated_bytes());
+    EXPECT_EQ(allocated_bytes + o.GetNBytes(), device.peak_allocated_bytes());
+    EXPECT_ARRAY_EQ(e, o);
+
+    Array t = a * b;
+    const void* t_data = t.raw_data();
+    Array u = std::move(t) + c;
+    EXPECT_EQ(t_data, u.raw_data());
+    EXPECT_ARRAY_EQ(testing::BuildArray({3, 1}).WithData<float>({5, 11, 20}), u);
+}
+
+TEST_P(ArrayTest, ArithmeticDoNotDonate) {
+    Array a = testing::BuildArray({3, 1}).WithData<float>({1, 2, 3});
+    Array b = testing::BuildArray({3, 1}).WithData<float>({4, 5, 6});
+
+    // Named arrays are not overwritten.
+    Array t = a * b;
+    Array o1 = t + a;
+    EXPECT_NE(t.raw_data(), o1.raw_data());
+    EXPECT_ARRAY_EQ(testing::BuildArray({3, 1}).WithData<float>({4, 10, 18}), t);
+
+    // Temporary views share the buffer of another array.
+    Array o2 = a.MakeView() + b;
+    EXPECT_NE(a.raw_data(), o2.raw_data());
+    EXPECT_ARRAY_EQ(testing::BuildArray({3, 1}).WithData<float>({1, 2, 3}), a);
+
+    // Temporaries which are broadcast cannot hold the result.
+    Array c = testing::BuildArray({1}).WithData<float>({2});
+    Array o3 = c * 1 + b;
+    EXPECT_EQ(b.shape(), o3.shape());
+    EXPECT_ARRAY_EQ(testing::BuildArray({3, 1}).WithData<float>({6, 7, 8}), o3);
+
+    // Temporaries in a graph are retained for backward.
+    Array x = testing::BuildArray({3, 1}).WithData<float>({1, 2, 3});
+    x.RequireGrad();
+    Array y = x * x * x;
+    Backward(y);
+    EXPECT_ARRAY_EQ(testing::BuildArray({3, 1}).WithData<float>({3, 12, 27}), *x.GetGrad());
+}
+
 TEST_P(ArrayTest, ComputationalGraph) {
     // c = a + b
     // o = a * c
@@ -1246,6 +1298,24 @@ INSTANTIATE_TEST_CASE_P(
                 std::make_tuple<std::string, int>("native", 0),
                 std::make_tuple<std::string, int>("native", 1)));
 
+TEST(ArrayDonationTest, DoNotDonateForeignData) {
+    testing::DeviceSession device_session{DeviceId{"native", 0}};
+    std::array<float, 3> buffer{1, 2, 3};
+    auto make_foreign_array = [&buffer]() {
+        return FromData({3}, Dtype::kFloat32, std::shared_ptr<void>{buffer.data(), [](void* /*ptr*/) {}});
+    };
+
+    // The use count of the buffer does not include the reference of the caller, which is not overwritten.
+    Array o1 = make_foreign_array() * 2;
+    EXPECT_NE(static_cast<void*>(buffer.data()), o1.raw_data());
+    EXPECT_ARRAY_EQ(testing::BuildArray({3}).WithData<float>({2, 4, 6}), o1);
+
+    // Nor are views of it.
+    Array o2 = make_foreign_array().MakeView() + make_foreign_array();
+    EXPECT_ARRAY_EQ(testing::BuildArray({3}).WithData<float>({2, 4, 6}), o2);
+    EXPECT_EQ((std::array<float, 3>{1, 2, 3}), buffer);
+}
+
 TEST(ArrayGradTest, SetGradFlagsIsGradRequired) {
     testing::ContextSession context_session{};
     BackpropScope backprop_scope{"bp1"};
@@ -1290,6 +1360,59 @@ TEST(ArrayGradTest, InvalidGetGradOnOutputArray) {
     EXPECT_THROW(y.GetGrad(backprop_id), ChainerxError);
 }
 
+TEST(ArrayGradTest, ZeroGrad) {
+    testing::ContextSession context_session{};
+    BackpropScope backprop_scope{"bp1"};
+    BackpropId backprop_id = backprop_scope.backprop_id();
+
+    Array x = Full({2}, 2.0f);
+    x.RequireGrad(backprop_id);
+    x.ZeroGrad(backprop_id);
+
+    EXPECT_TRUE(x.IsGradRequired(backprop_id));
+    ASSERT_TRUE(x.GetGrad(backprop_id).has_value());
+    EXPECT_ARRAY_EQ(Zeros({2}, Dtype::kFloat32), *x.GetGrad(backprop_id));
+}
+
+TEST(ArrayGradTest, ZeroGradReusesUniquelyOwnedBuffer) {
+    testing::ContextSession context_session{};
+    BackpropScope backprop_scope{"bp1"};
+    BackpropId backprop_id = backprop_scope.backprop_id();
+
+    Array x = Full({2}, 2.0f).RequireGrad(backprop_id);
+    x.SetGrad(Full({2}, 3.0f), backprop_id);
+    const void* grad_data = x.GetGrad(backprop_id)->data().get();
+
+    x.ZeroGrad(backprop_id);
+
+    EXPECT_EQ(grad_data, x.GetGrad(backprop_id)->data().get());
+    EXPECT_ARRAY_EQ(Zeros({2}, Dtype::kFloat32), *x.GetGrad(backprop_id));
+}
+
+TEST(ArrayGradTest, ZeroGradDoesNotModifySharedBuffer) {
+    testing::ContextSession context_session{};
+    BackpropScope backprop_scope{"bp1"};
+    BackpropId backprop_id = backprop_scope.backprop_id();
+
+    Array x = Full({2}, 2.0f).RequireGrad(backprop_id);
+    Array gx = Full({2}, 3.0f);
+    x.SetGrad(gx, backprop_id);
+
+    x.ZeroGrad(backprop_id);
+
+    EXPECT_ARRAY_EQ(Full({2}, 3.0f), gx);
+    EXPECT_ARRAY_EQ(Zeros({2}, Dtype::kFloat32), *x.GetGrad(backprop_id));
+}
+
+TEST(ArrayGradTest, ZeroGradThrow) {
+    testing::ContextSession context_session{};
+    BackpropScope backprop_scope{"bp1"};
+    BackpropId backprop_id = backprop_scope.backprop_id();
+
+    Array x = Full({2}, 2.0f);
+    EXPECT_THROW(x.ZeroGrad(backprop_id), ChainerxError);
+}
+
 TEST(ArrayGradTest, ClearGradDoesNotClearIsGradRequired) {
     testing::ContextSession context_session{};
     BackpropScope backprop_scope{"bp1"};
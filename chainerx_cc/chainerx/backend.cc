@@ -1,9 +1,11 @@
 #include "chainerx/backend.h"
 
+#include <memory>
 #include <string>
 #include <utility>
 
 #include "chainerx/device.h"
+#include "chainerx/kernel_queue.h"
 #include "chainerx/kernel_registry.h"
 
 namespace chainerx {
@@ -12,6 +14,19 @@ Backend::~Backend() = default;
 
 Backend::Backend(Context& context) : context_{context} {}
 
+void Backend::WaitForKernelQueues() noexcept {
+    // The devices are not locked, since the queued calls may get devices.
+    for (const std::unique_ptr<Device>& device : devices_) {
+        if (internal::KernelQueue* queue = device == nullptr ? nullptr : device->kernel_queue()) {
+            try {
+                queue->Wait();
+            } catch (...) {
+                // The errors are dropped, as this function is called from destructors.
+            }
+        }
+    }
+}
+
 void Backend::Initialize() { kernel_registry_ = KernelRegistry{&GetParentKernelRegistry()}; }
 
 Device& Backend::GetDevice(int index) {
@@ -7,7 +7,11 @@
 #include <vector>
 
 #include "chainerx/kernel.h"
+#include "chainerx/kernel_autotuner.h"
+#include "chainerx/kernel_call_recorder.h"
+#include "chainerx/kernel_queue.h"
 #include "chainerx/kernel_registry.h"
+#include "chainerx/macro.h"
 
 namespace chainerx {
 
@@ -54,13 +58,43 @@ public:
     virtual bool SupportsTransfer(Device& src_device, Device& dst_device) = 0;
 
     // Calls the kernel implementation.
+    // If candidates of the key kernel are registered, the implementation may be chosen among them by the autotuner; see kernel_autotuner.h.
+    // If the device of the first array argument executes kernels asynchronously, calls without results are deferred to its queue.
     template <typename KernelType, typename... Args>
     auto CallKernel(Args&&... args) {
         Kernel& kernel = kernel_registry_.GetKernel<KernelType>();
-        return dynamic_cast<KernelType&>(kernel).Call(std::forward<Args>(args)...);
+        // Kernels are registered with their key kernel types, of which they are subclasses.
+        CHAINERX_ASSERT(dynamic_cast<KernelType*>(&kernel) != nullptr);
+        auto& registered_kernel = static_cast<KernelType&>(kernel);
+        using Result = decltype(registered_kernel.Call(std::forward<Args>(args)...));
+        KernelType& typed_kernel = internal::MayHaveKernelCandidates<KernelType>()
+                                           ? internal::KernelAutotuning<Result>::Select(
+                                                     kernel_registry_, GetName(), registered_kernel, args...)
+                                           : registered_kernel;
+        internal::KernelQueue* queue = internal::GetKernelQueue(args...);
+        if (internal::KernelCallRecorder* recorder = internal::GetKernelCallRecorder()) {
+            if (queue != nullptr) {
+                // Recorded calls are made synchronously.
+                queue->Wait();
+                internal::SynchronousKernelCallScope scope{};
+                return internal::KernelCallRecording<Result>::template CallAndRecord<KernelType>(
+                        *recorder, typed_kernel, std::forward<Args>(args)...);
+            }
+            return internal::KernelCallRecording<Result>::template CallAndRecord<KernelType>(
+                    *recorder, typed_kernel, std::forward<Args>(args)...);
+        }
+        if (queue != nullptr) {
+            return internal::QueuedKernelCall<Result>::Call(*queue, typed_kernel, std::forward<Args>(args)...);
+        }
+        return typed_kernel.Call(std::forward<Args>(args)...);
     }
 
 protected:
+    // Waits for the kernel calls queued on the devices of this backend, ignoring their errors.
+    // Backends whose devices execute kernels asynchronously call this in their destructors, since the queued calls may use the backend and
+    // the arrays on any of its devices.
+    void WaitForKernelQueues() noexcept;
+
     // Returns a backend-specific global kernel registry.
     virtual KernelRegistry& GetParentKernelRegistry() = 0;
 
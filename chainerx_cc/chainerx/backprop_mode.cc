@@ -56,13 +56,30 @@ template class BackpropModeScope<false>;
 
 }  // namespace backprop_mode_detail
 
+InferenceModeScope::InferenceModeScope() {
+    bool& inference_mode = internal::GetInternalThreadLocalState().inference_mode;
+    prev_inference_mode_ = inference_mode;
+    inference_mode = true;
+}
+
+InferenceModeScope::~InferenceModeScope() { internal::GetInternalThreadLocalState().inference_mode = prev_inference_mode_; }
+
+bool IsInferenceMode() { return internal::GetInternalThreadLocalState().inference_mode; }
+
 bool IsBackpropRequired(Context& context) {
+    if (IsInferenceMode()) {
+        return false;
+    }
     BackpropId backprop_id = context.default_backprop_id();
     return IsBackpropRequired(backprop_id);
 }
 
 bool IsBackpropRequired(const BackpropId& backprop_id) {
-    BackpropModeStack& bms = internal::GetInternalThreadLocalState().backprop_mode_stack;
+    internal::InternalThreadLocalState& state = internal::GetInternalThreadLocalState();
+    if (state.inference_mode) {
+        return false;
+    }
+    BackpropModeStack& bms = state.backprop_mode_stack;
     auto it = std::find_if(bms.rbegin(), bms.rend(), [&backprop_id](const internal::BackpropMode& bm) {
         if (bm.backprop_id().has_value()) {
             return backprop_id == *bm.backprop_id();
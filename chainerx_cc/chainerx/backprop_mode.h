@@ -76,6 +76,29 @@ using NoBackpropModeScope = backprop_mode_detail::BackpropModeScope<false>;
 // Make a context which enables back-propagation.
 using ForceBackpropModeScope = backprop_mode_detail::BackpropModeScope<true>;
 
+// Make a context which disables back-propagation for all graphs of all contexts on the current thread, for inference.
+//
+// Unlike NoBackpropModeScope, the mode is determined by a single flag, which takes precedence over any backprop mode scope. BackwardBuilder
+// reads it once on construction and skips inspecting the graphs of the inputs altogether, and outputs of routines never allocate graph
+// storage. This minimizes the per-op overhead of serving small batches.
+class InferenceModeScope {
+public:
+    InferenceModeScope();
+
+    InferenceModeScope(const InferenceModeScope&) = delete;
+    InferenceModeScope(InferenceModeScope&& other) = delete;
+    InferenceModeScope& operator=(const InferenceModeScope&) = delete;
+    InferenceModeScope& operator=(InferenceModeScope&& other) = delete;
+
+    ~InferenceModeScope();
+
+private:
+    bool prev_inference_mode_;
+};
+
+// Returns whether the current thread is in the inference mode.
+bool IsInferenceMode();
+
 bool IsBackpropRequired(Context& context = GetDefaultContext());
 bool IsBackpropRequired(const BackpropId& backprop_id);
 
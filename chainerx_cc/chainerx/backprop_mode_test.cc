@@ -4,11 +4,16 @@
 
 #include <gtest/gtest.h>
 
+#include "chainerx/array.h"
+#include "chainerx/array_body.h"
 #include "chainerx/backprop_scope.h"
 #include "chainerx/constant.h"
 #include "chainerx/context.h"
+#include "chainerx/device_id.h"
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
+#include "chainerx/native/native_backend.h"
+#include "chainerx/routines/explog.h"
 #include "chainerx/testing/array.h"
 #include "chainerx/testing/context_session.h"
 #include "chainerx/testing/device_session.h"
@@ -438,5 +443,53 @@ TEST(BackpropModeScopeTest, BackpropModeScopeWithAnotherContext) {
     EXPECT_THROW(NoBackpropModeScope({backprop_id, another_backprop_id}), ContextError);
 }
 
+TEST(BackpropModeScopeTest, InferenceModeScope) {
+    testing::ContextSession context_session{};
+
+    BackpropScope backprop_scope{"bp1"};
+    BackpropId backprop_id = backprop_scope.backprop_id();
+
+    Context another_context{};
+    BackpropScope another_backprop_scope{"another_backprop", another_context};
+    BackpropId another_backprop_id = another_backprop_scope.backprop_id();
+
+    EXPECT_FALSE(IsInferenceMode());
+    {
+        InferenceModeScope scope{};
+        EXPECT_TRUE(IsInferenceMode());
+        EXPECT_FALSE(IsBackpropRequired());
+        EXPECT_FALSE(IsBackpropRequired(backprop_id));
+        EXPECT_FALSE(IsBackpropRequired(another_backprop_id));
+        {
+            // Takes precedence over backprop mode scopes.
+            ForceBackpropModeScope force_scope{};
+            EXPECT_FALSE(IsBackpropRequired(backprop_id));
+        }
+        {
+            InferenceModeScope nested_scope{};
+            EXPECT_TRUE(IsInferenceMode());
+        }
+        EXPECT_TRUE(IsInferenceMode());
+    }
+    EXPECT_FALSE(IsInferenceMode());
+    EXPECT_TRUE(IsBackpropRequired(backprop_id));
+    EXPECT_TRUE(IsBackpropRequired(another_backprop_id));
+}
+
+TEST(BackpropModeScopeTest, InferenceModeScopeRecordsNoGraph) {
+    testing::DeviceSession device_session{DeviceId{native::NativeBackend::kDefaultName, 0}};
+
+    Array x = testing::BuildArray({2, 3}).WithLinearData<float>().WithPadding(1);
+    x.RequireGrad();
+    {
+        InferenceModeScope scope{};
+        Array y = Exp(x * x);
+        EXPECT_FALSE(y.IsBackpropRequired(AnyGraph{}));
+        EXPECT_TRUE(internal::GetArrayBody(y)->nodes().empty());
+    }
+    Array y = Exp(x * x);
+    EXPECT_TRUE(y.IsBackpropRequired());
+}
+
 }  // namespace
 }  // namespace chainerx
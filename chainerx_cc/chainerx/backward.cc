@@ -1,9 +1,15 @@
 #include "chainerx/backward.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <functional>
 #include <memory>
-#include <type_traits>
+#include <mutex>
+#include <queue>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -15,6 +21,7 @@
 #include "chainerx/array.h"
 #include "chainerx/array_body.h"
 #include "chainerx/array_node.h"
+#include "chainerx/backend.h"
 #include "chainerx/backprop_mode.h"
 #include "chainerx/backward_context.h"
 #include "chainerx/backward_fwd.h"
@@ -23,10 +30,16 @@
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
+#include "chainerx/kernels/arithmetic.h"
+#include "chainerx/kernels/misc.h"
 #include "chainerx/macro.h"
 #include "chainerx/op_node.h"
 #include "chainerx/routines/creation.h"
+#include "chainerx/routines/logic.h"
+#include "chainerx/routines/manipulation.h"
 #include "chainerx/shape.h"
+#include "chainerx/thread_local_state.h"
+#include "chainerx/thread_pool.h"
 
 namespace chainerx {
 namespace {
@@ -55,10 +68,22 @@ void CheckGradCompatible(const Array& grad, const Shape& shape, Dtype dtype, Dev
 
 }  // namespace
 
+bool IsGradUniquelyOwned(const Array& grad) {
+    const std::shared_ptr<ArrayBody>& body = GetArrayBody(grad);
+    return body.use_count() == 1 && grad.data().use_count() == 1 && body->nodes().empty() && grad.IsContiguous() &&
+           !IsForeignData(grad.data());
+}
+
 void AccumulateGrad(absl::optional<Array>& target_grad, Array partial_grad, const Shape& shape, Dtype dtype, Device& device) {
     CheckGradCompatible(partial_grad, shape, dtype, device);
     if (target_grad.has_value()) {
-        target_grad = *target_grad + partial_grad;
+        // Sum in place unless the target is shared with other arrays or a graph needs to be recorded for double backprop.
+        if (IsGradUniquelyOwned(*target_grad) && GetArrayBody(partial_grad)->nodes().empty()) {
+            NoBackpropModeScope scope{};
+            device.backend().CallKernel<AddKernel>(*target_grad, partial_grad, *target_grad);
+        } else {
+            target_grad = *target_grad + partial_grad;
+        }
     } else {
         target_grad = std::move(partial_grad);
     }
@@ -77,120 +102,166 @@ struct OpNodeComparator {
     bool operator()(const std::shared_ptr<OpNode>& lhs, const std::shared_ptr<OpNode>& rhs) const { return lhs->rank() < rhs->rank(); }
 };
 
-// Pushes an ArrayNode or an OpNode to the given container if not already seen. Does nothing otherwise.
-// This function is called when traversing the graph to extract a subgraph when inputs are given to backward.
-// Returns true if the node was inserted, false otherwise.
-template <typename T>
-bool PushNodeIfNotSeen(std::vector<T*>& nodes, T* node, std::unordered_set<T*>& seen_nodes) {
-    static_assert(
-            std::is_same<T, ArrayNode>::value || std::is_same<T, OpNode>::value, "Only ArrayNodes or OpNodes are allowed to be pushed.");
-    CHAINERX_ASSERT(node != nullptr);
+// Source of the epochs identifying subgraph extractions. Epoch 0 is never used, so that fresh nodes do not belong to any subgraph.
+std::atomic<uint64_t> g_subgraph_epoch{0};
 
-    bool emplaced = seen_nodes.emplace(node).second;
-    if (emplaced) {
-        nodes.emplace_back(node);
-    }
-    return emplaced;
-}
-
-// Returns a subgraph that contains only the nodes that are necessary for computing the gradients w.r.t. the given inputs.
-// The subgraph is represented by a mapping from op nodes to boolean flags corresponding their inputs.
-// The flags are true for inputs that require backprop and false otherwise.
-std::unordered_map<OpNode*, std::vector<uint8_t>> CreateSubgraph(
+// Extracts a subgraph that contains only the nodes that are necessary for computing the gradients w.r.t. the given inputs and returns the
+// epoch identifying it.
+// The op nodes in the subgraph are stamped with the epoch and hold boolean flags corresponding to their inputs. The flags are true for
+// inputs that require backprop and false otherwise.
+// Only the op nodes between the inputs and the outputs are stamped, so that backward computations of graphs that share inputs, e.g.
+// parameters, can run at the same time. The inputs themselves are tracked locally.
+uint64_t CreateSubgraph(
         const std::vector<ConstArrayRef>& inputs,
         const std::vector<std::reference_wrapper<const std::shared_ptr<ArrayNode>>>& output_array_nodes,
         const BackpropId& backprop_id) {
-    // To extract a subgraph, the graph must be traversed "forwards" starting from the inputs towards the outputs.
-
-    // A "forward" mapping of array nodes to op nodes of which the array nodes are inputs.
-    std::unordered_multimap<ArrayNode*, OpNode*> forward_op_nodes;
-    {
-        std::unordered_set<OpNode*> seen_op_nodes;
-        std::vector<OpNode*> candidate_op_nodes;
-        candidate_op_nodes.reserve(output_array_nodes.size());
+    uint64_t epoch = ++g_subgraph_epoch;
 
-        // Initialize op node queue starting from outputs.
-        for (const std::shared_ptr<ArrayNode>& array_node : output_array_nodes) {
-            if (array_node != nullptr) {
-                const std::shared_ptr<OpNode>& op_node = array_node->creator_op_node();
-                if (op_node != nullptr) {
-                    PushNodeIfNotSeen(candidate_op_nodes, op_node.get(), seen_op_nodes);
-                }
-            }
+    // Collect the op nodes from which the outputs can be reached, traversing the graph from the outputs towards the inputs.
+    std::vector<OpNode*> op_nodes;
+    auto push_creator_op_node = [epoch, &op_nodes](const std::shared_ptr<ArrayNode>& array_node) {
+        if (array_node == nullptr) {
+            return;
+        }
+        const std::shared_ptr<OpNode>& op_node = array_node->creator_op_node();
+        if (op_node != nullptr && op_node->visit_epoch() != epoch) {  // Creator op node is nullptr for inputs which should be skipped.
+            op_node->set_visit_epoch(epoch);
+            op_nodes.emplace_back(op_node.get());
         }
+    };
+    for (const std::shared_ptr<ArrayNode>& array_node : output_array_nodes) {
+        push_creator_op_node(array_node);
+    }
+    for (size_t i = 0; i < op_nodes.size(); ++i) {
+        for (const std::shared_ptr<ArrayNode>& array_node : op_nodes[i]->input_array_nodes()) {
+            push_creator_op_node(array_node);
+        }
+    }
 
-        // Traverse op node queue towards inputs.
-        while (!candidate_op_nodes.empty()) {
-            OpNode* op_node = candidate_op_nodes.back();
-            candidate_op_nodes.pop_back();
+    // Traverse the collected op nodes "forwards" from the inputs towards the outputs, in a topological order.
+    // The rank of an op node is greater than the ranks of the creators of its inputs.
+    std::sort(op_nodes.begin(), op_nodes.end(), [](const OpNode* lhs, const OpNode* rhs) { return lhs->rank() < rhs->rank(); });
 
-            for (const std::shared_ptr<ArrayNode>& array_node : op_node->input_array_nodes()) {
-                if (array_node != nullptr) {
-                    forward_op_nodes.emplace(array_node.get(), op_node);
-                    const std::shared_ptr<OpNode>& creator_op_node = array_node->creator_op_node();
-                    if (creator_op_node != nullptr) {  // Creator op node is nullptr for inputs which should be skipped.
-                        PushNodeIfNotSeen(candidate_op_nodes, creator_op_node.get(), seen_op_nodes);
-                    }
-                }
+    // Sorted, so that they can be looked up by binary search.
+    std::vector<const ArrayNode*> input_array_nodes;
+    input_array_nodes.reserve(inputs.size());
+    for (const Array& input : inputs) {
+        if (const std::shared_ptr<ArrayNode>& array_node = internal::GetArrayBody(input)->GetArrayNode(backprop_id)) {
+            input_array_nodes.emplace_back(array_node.get());
+        }
+    }
+    std::sort(input_array_nodes.begin(), input_array_nodes.end());
+
+    // An array node is in the subgraph if it is one of the inputs or its creator is in the subgraph. The creator of an array node precedes
+    // the op nodes consuming it in the topological order, hence it has already been added if it is in the subgraph.
+    auto is_in_subgraph = [epoch, &input_array_nodes](ArrayNode& array_node) {
+        const std::shared_ptr<OpNode>& creator_op_node = array_node.creator_op_node();
+        return (creator_op_node != nullptr && creator_op_node->IsInSubgraph(epoch)) ||
+               std::binary_search(input_array_nodes.begin(), input_array_nodes.end(), &array_node);
+    };
+
+    for (OpNode* op_node : op_nodes) {
+        const internal::OpNodeInputArrayNodes& op_input_array_nodes = op_node->input_array_nodes();
+        internal::InputRequiredFlags flags(op_input_array_nodes.size());
+        bool is_any_input_required = false;
+        for (size_t i_input = 0; i_input < op_input_array_nodes.size(); ++i_input) {
+            const std::shared_ptr<ArrayNode>& input_array_node = op_input_array_nodes[i_input];
+            if (input_array_node != nullptr && is_in_subgraph(*input_array_node)) {
+                flags[i_input] = static_cast<uint8_t>(true);
+                is_any_input_required = true;
             }
         }
+        if (is_any_input_required) {
+            op_node->AddToSubgraph(epoch, std::move(flags));
+        }
     }
+    return epoch;
+}
 
-    // Create the subgraph.
-    std::unordered_map<OpNode*, std::vector<uint8_t>> input_required_flags;
-    {
-        std::unordered_set<ArrayNode*> seen_array_nodes;
-        std::vector<ArrayNode*> candidate_input_array_nodes;
-        std::vector<std::shared_ptr<ArrayNode>> candidate_input_array_nodes_keep_alive;
-        candidate_input_array_nodes.reserve(inputs.size());
-
-        // Initialize array node queue with inputs.
-        for (const Array& input : inputs) {
-            const std::shared_ptr<ArrayBody>& array_body = internal::GetArrayBody(input);
-            if (const std::shared_ptr<ArrayNode>& array_node = array_body->GetArrayNode(backprop_id)) {
-                PushNodeIfNotSeen(candidate_input_array_nodes, array_node.get(), seen_array_nodes);
+// Measures the peak of the bytes allocated on the devices of the given arrays while the scope is alive.
+// The peaks recorded before the scope are restored when the scope ends, so that the devices keep reporting their overall peaks.
+class PeakAllocatedBytesScope {
+public:
+    explicit PeakAllocatedBytesScope(const std::vector<ConstArrayRef>& arrays) {
+        for (const Array& array : arrays) {
+            Device& device = array.device();
+            if (std::none_of(previous_peaks_.begin(), previous_peaks_.end(), [&device](const std::pair<Device*, size_t>& pair) {
+                    return pair.first == &device;
+                })) {
+                previous_peaks_.emplace_back(&device, device.ResetPeakAllocatedBytes());
             }
         }
+    }
 
-        // "Forward" traverse array node queue towards outputs.
-        while (!candidate_input_array_nodes.empty()) {
-            ArrayNode* array_node = candidate_input_array_nodes.back();
-            candidate_input_array_nodes.pop_back();
+    ~PeakAllocatedBytesScope() {
+        for (const std::pair<Device*, size_t>& pair : previous_peaks_) {
+            pair.first->RaisePeakAllocatedBytes(pair.second);
+        }
+    }
 
-            auto it_op_node = forward_op_nodes.find(array_node);
-            // A single array node could have been an input to multiple op nodes.
-            while (it_op_node != forward_op_nodes.end()) {
-                OpNode* op_node = it_op_node->second;
-                std::vector<uint8_t>& flags = input_required_flags[op_node];
-                if (flags.empty()) {
-                    flags.resize(op_node->input_array_node_count());
-                }
+    PeakAllocatedBytesScope(const PeakAllocatedBytesScope&) = delete;
+    PeakAllocatedBytesScope(PeakAllocatedBytesScope&&) = delete;
+    PeakAllocatedBytesScope& operator=(const PeakAllocatedBytesScope&) = delete;
+    PeakAllocatedBytesScope& operator=(PeakAllocatedBytesScope&&) = delete;
 
-                const std::vector<std::shared_ptr<ArrayNode>>& input_array_nodes = op_node->input_array_nodes();
-                for (size_t i_input = 0; i_input < op_node->input_array_node_count(); ++i_input) {
-                    if (input_array_nodes[i_input].get() == array_node) {
-                        flags[i_input] = static_cast<int8_t>(true);
-                        // Cannot break since the same inputs may appear more than once in an op node.
-                    }
-                }
+    size_t GetPeakAllocatedBytes() const {
+        size_t peak_allocated_bytes = 0;
+        for (const std::pair<Device*, size_t>& pair : previous_peaks_) {
+            peak_allocated_bytes += pair.first->peak_allocated_bytes();
+        }
+        return peak_allocated_bytes;
+    }
 
-                for (const absl::optional<std::weak_ptr<ArrayNode>>& output_array_node : op_node->output_array_nodes()) {
-                    if (output_array_node.has_value()) {
-                        if (std::shared_ptr<ArrayNode> out = output_array_node->lock()) {
-                            if (PushNodeIfNotSeen(candidate_input_array_nodes, out.get(), seen_array_nodes)) {
-                                candidate_input_array_nodes_keep_alive.emplace_back(std::move(out));
-                            }
-                        }
-                    }
-                }
-                forward_op_nodes.erase(it_op_node);
+private:
+    std::vector<std::pair<Device*, size_t>> previous_peaks_;
+};
 
-                // Find the next op node that has this array node as input.
-                it_op_node = forward_op_nodes.find(array_node);
-            }
+// Scales back gradients computed with a loss scale and returns whether any of the results contains infinity or NaN.
+//
+// The gradients on each device are scaled back and checked by a single kernel call. They are updated in place if they are uniquely owned
+// and replaced with new arrays otherwise. Gradients belonging to graphs, i.e. those computed with double backprop, are divided by
+// differentiable routines instead.
+bool UnscaleGrads(const std::vector<absl::optional<Array>*>& grads, float loss_scale) {
+    struct DeviceGrads {
+        Device* device;
+        std::vector<Array> xs;
+        std::vector<Array> outs;
+    };
+    std::vector<DeviceGrads> device_grads_list;
+    bool found_non_finite = false;
+
+    for (absl::optional<Array>* grad : grads) {
+        CHAINERX_ASSERT(grad->has_value());
+        Array& g = **grad;
+        if (g.IsBackpropRequired(AnyGraph{})) {
+            g = g / loss_scale;
+            found_non_finite |= !static_cast<bool>(AsScalar(All(IsFinite(g))));
+            continue;
+        }
+
+        Device& device = g.device();
+        auto it = std::find_if(device_grads_list.begin(), device_grads_list.end(), [&device](const DeviceGrads& device_grads) {
+            return device_grads.device == &device;
+        });
+        if (it == device_grads_list.end()) {
+            device_grads_list.emplace_back(DeviceGrads{&device, {}, {}});
+            it = device_grads_list.end() - 1;
+        }
+        bool in_place = internal::IsGradUniquelyOwned(g);
+        it->xs.emplace_back(g);
+        it->outs.emplace_back(in_place ? g : EmptyLike(g, device));
+        if (!in_place) {
+            g = it->outs.back();
         }
     }
-    return input_required_flags;
+
+    for (const DeviceGrads& device_grads : device_grads_list) {
+        Device& device = *device_grads.device;
+        Array found = Zeros({}, Dtype::kBool, device);
+        device.backend().CallKernel<UnscaleGradsKernel>(device_grads.xs, Scalar{1.0f / loss_scale}, device_grads.outs, found);
+        found_non_finite |= static_cast<bool>(AsScalar(found));
+    }
+    return found_non_finite;
 }
 
 class BackwardImpl {
@@ -202,14 +273,18 @@ public:
             DoubleBackpropOption double_backprop,
             std::unordered_map<ArrayNode*, internal::GradRef> array_node_grad_map,
             bool retain_grad,
-            absl::optional<float> loss_scale)
+            absl::optional<float> loss_scale,
+            BackwardExecutionMode execution_mode,
+            GradReadyCallback grad_ready_callback)
         : inputs_{inputs},
           outputs_{outputs},
           backprop_id_{backprop_id},
           double_backprop_{double_backprop},
           array_node_grad_map_{std::move(array_node_grad_map)},
           retain_grad_{retain_grad},
-          loss_scale_{loss_scale} {
+          loss_scale_{loss_scale},
+          execution_mode_{execution_mode},
+          grad_ready_callback_{std::move(grad_ready_callback)} {
         if (!outputs_.empty()) {
             // Collect output array nodes (can be nullptr).
             output_array_nodes_.reserve(outputs.size());
@@ -230,7 +305,17 @@ public:
             }
 
             if (!inputs.empty()) {
-                input_required_flags_ = CreateSubgraph(inputs, output_array_nodes_, backprop_id);
+                subgraph_epoch_ = CreateSubgraph(inputs, output_array_nodes_, backprop_id);
+            }
+        }
+
+        // Backward functions can only run concurrently if none of them records a graph, i.e. all graphs are stopped during the
+        // backward computation. Loss scaling depends on the order in which the op nodes are unchained and is therefore run serially.
+        // Nested backward calls from the workers are run serially as well so that the workers do not wait for each other.
+        if (execution_mode_ != BackwardExecutionMode::kSerial) {
+            if (double_backprop_ == DoubleBackpropOption::kEnable || loss_scale_.has_value() ||
+                backprop_id_ != backprop_id_.context().default_backprop_id() || internal::GetSharedThreadPool().IsWorkerThread()) {
+                execution_mode_ = BackwardExecutionMode::kSerial;
             }
         }
     }
@@ -240,11 +325,23 @@ public:
             const std::vector<ConstArrayRef>& outputs,
             const BackpropId& backprop_id,
             DoubleBackpropOption double_backprop,
-            absl::optional<float> loss_scale)
-        : BackwardImpl{inputs, outputs, backprop_id, double_backprop, {}, false, loss_scale} {}
+            absl::optional<float> loss_scale,
+            BackwardExecutionMode execution_mode,
+            GradReadyCallback grad_ready_callback)
+        : BackwardImpl{
+                  inputs, outputs, backprop_id, double_backprop, {}, false, loss_scale, execution_mode, std::move(grad_ready_callback)} {}
 
-    void Run() {
+    BackwardStats Run() {
         CHAINERX_ASSERT(output_array_nodes_.size() == outputs_.size());
+        PeakAllocatedBytesScope peak_allocated_bytes_scope{outputs_};
+
+        // The schedule is built before the graph is modified by pushing the creator op nodes of the outputs.
+        if (execution_mode_ != BackwardExecutionMode::kSerial) {
+            BuildSchedule();
+        }
+        if (grad_ready_callback_) {
+            CountLeafConsumers();
+        }
 
         float initial_out_value = loss_scale_.has_value() ? loss_scale_.value() : 1.0;
         // Push initial output array nodes
@@ -266,6 +363,86 @@ public:
         }
 
         // Backpropagation
+        if (execution_mode_ == BackwardExecutionMode::kSerial) {
+            RunSerial();
+        } else {
+            RunParallel();
+        }
+
+        if (loss_scale_.has_value()) {
+            std::vector<absl::optional<Array>*> grads;
+            grads.reserve(to_scale_back_nodes_.size());
+            for (internal::GradRef* grad_ref : to_scale_back_nodes_) {
+                if (grad_ref->get().has_value()) {
+                    grads.emplace_back(&grad_ref->get());
+                }
+            }
+            found_non_finite_grads_ |= UnscaleGrads(grads, loss_scale_.value());
+        }
+
+        // Register this graph as backpropped.
+        backprop_id_.context().SetBackpropDone(backprop_id_);
+
+        BackwardStats stats{};
+        stats.peak_allocated_bytes = peak_allocated_bytes_scope.GetPeakAllocatedBytes();
+        stats.found_non_finite_grads = found_non_finite_grads_;
+        return stats;
+    }
+
+private:
+    // State of the backward computation of a single op node.
+    // The backward functions may be run on a worker thread, while the rest of the state is only touched by the thread that called
+    // Backward().
+    struct OpNodeBackward {
+        std::shared_ptr<OpNode> op_node;
+
+        // Output array nodes. May be nullptr if the node is gone.
+        std::vector<std::shared_ptr<ArrayNode>> output_array_nodes;
+
+        // `temp_output_grads` is a set of temporary GradRefs of this op node's output array nodes.
+        // This is used for output array nodes which are either dead at the moment or alive but have not been involved in the preceding
+        // backpropagation.
+        // This vector is just a keeper and not used in any other way. output_grads holds the pointer to it.
+        // These GradRefs are only valid in the backward functions of this op node.
+        // Be careful not to cause reallocation in this vector. Otherwise the pointers would be invalidated.
+        std::vector<internal::GradRef> temp_output_grads;
+
+        std::vector<internal::GradRef*> output_grads;
+
+        // Backward entries to be called and the gradients computed by each of them.
+        std::vector<const internal::OpNodeBackwardEntry*> backward_entries;
+        std::vector<std::vector<Array>> computed_input_grads;
+
+        // Exception thrown by a backward function run on a worker thread.
+        std::exception_ptr error;
+    };
+
+    // An op node in the order in which the serial engine would visit it.
+    struct ScheduledOpNode {
+        std::shared_ptr<OpNode> op_node;
+
+        // Indices of the distinct creator op nodes of the inputs in the schedule.
+        std::vector<size_t> creator_indices;
+
+        // Number of distinct op nodes in the schedule which consume the outputs and have not been processed yet.
+        size_t pending_consumer_count{0};
+
+        std::unique_ptr<OpNodeBackward> backward;
+    };
+
+    // Partial gradients of an array node, buffered until they can be accumulated in the order of the serial engine.
+    struct OrderedGradAccumulation {
+        std::shared_ptr<ArrayNode> array_node;
+
+        // Schedule indices of the consumer op nodes, in ascending order.
+        std::vector<size_t> contributors;
+
+        std::vector<std::vector<Array>> partial_grads;
+        std::vector<uint8_t> finished;
+        size_t flushed_count{0};
+    };
+
+    void RunSerial() {
         while (!candidate_op_nodes_.empty()) {
             std::pop_heap(candidate_op_nodes_.begin(), candidate_op_nodes_.end(), OpNodeComparator{});
             std::shared_ptr<OpNode> op_node = std::move(candidate_op_nodes_.back());
@@ -280,65 +457,305 @@ public:
 
             // Backpropagate gradients from the output array nodes into the input array nodes.
             {
-                std::vector<absl::optional<Array>> gxs = ComputeInputGradients(op_node);
+                std::unique_ptr<OpNodeBackward> backward = PrepareOpNodeBackward(op_node);
+                CallBackwardFunctions(*backward);
+                std::vector<absl::optional<Array>> gxs = CollectInputGradients(*backward);
                 AccumulateInputGradients(*op_node, std::move(gxs));
             }
 
-            // Push the creator op nodes into the queue
-            for (const auto& input_array_node : op_node->input_array_nodes()) {
+            NotifyGradReady(*op_node);
+            ReleaseOpNode(op_node);
+        }
+    }
+
+    // Runs the backward functions of independent op nodes concurrently on the backward thread pool.
+    //
+    // An op node is dispatched once all the op nodes consuming its outputs have been processed. Everything but the backward functions
+    // themselves, i.e. the bookkeeping of gradients and the graph, is done on this thread.
+    void RunParallel() {
+        internal::ThreadPool& pool = internal::GetSharedThreadPool();
+        ThreadLocalState thread_local_state = ThreadLocalState::Get();
+
+        // Gradient references of all the input array nodes are created before any backward function runs, since the backward
+        // functions may fabricate array bodies for the array nodes.
+        for (const ScheduledOpNode& scheduled : schedule_) {
+            for (const std::shared_ptr<ArrayNode>& input_array_node : scheduled.op_node->input_array_nodes()) {
                 if (input_array_node != nullptr) {
-                    PushCreatorOpNode(input_array_node);
+                    array_node_grad_map_.emplace(input_array_node.get(), internal::GradRef{*input_array_node});
                 }
             }
+        }
 
-            if (double_backprop_ == DoubleBackpropOption::kDisable) {
-                op_node->Unchain();
+        // Ready op nodes, ordered by their indices in the schedule.
+        std::priority_queue<size_t, std::vector<size_t>, std::greater<size_t>> ready;
+        for (size_t i = 0; i < schedule_.size(); ++i) {
+            if (schedule_[i].pending_consumer_count == 0) {
+                ready.push(i);
+            }
+        }
+
+        // Indices of op nodes whose backward functions have returned, guarded by the mutex.
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::vector<size_t> finished;
+
+        size_t running_count = 0;
+        size_t processed_count = 0;
+        std::exception_ptr error{};
+
+        while (true) {
+            if (error == nullptr) {
+                try {
+                    while (!ready.empty()) {
+                        size_t index = ready.top();
+                        ready.pop();
+                        ScheduledOpNode& scheduled = schedule_[index];
+                        scheduled.backward = PrepareOpNodeBackward(scheduled.op_node);
+                        ++running_count;
+                        pool.Submit([this, backward = scheduled.backward.get(), index, &thread_local_state, &mutex, &cv, &finished]() {
+                            ThreadLocalState previous_thread_local_state = ThreadLocalState::Get();
+                            ThreadLocalState::Set(thread_local_state);
+                            try {
+                                CallBackwardFunctions(*backward);
+                            } catch (...) {
+                                backward->error = std::current_exception();
+                            }
+                            ThreadLocalState::Set(previous_thread_local_state);
+
+                            // Notify while holding the lock, since the synchronization objects are gone once the last op node is
+                            // processed.
+                            std::lock_guard<std::mutex> lock{mutex};
+                            finished.emplace_back(index);
+                            cv.notify_one();
+                        });
+                    }
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            }
+
+            if (running_count == 0) {
+                break;
             }
 
-            // Erase the array node's temporarily held grad
+            std::vector<size_t> newly_finished;
             {
-                auto range = output_array_node_keeper_.equal_range(op_node.get());
-                for (auto it = range.first; it != range.second; ++it) {
-                    size_t n_removed = array_node_grad_map_.erase(it->second.get());
-                    CHAINERX_ASSERT(n_removed > 0);
+                std::unique_lock<std::mutex> lock{mutex};
+                cv.wait(lock, [&finished]() { return !finished.empty(); });
+                newly_finished.swap(finished);
+            }
+
+            for (size_t index : newly_finished) {
+                --running_count;
+                ++processed_count;
+                ScheduledOpNode& scheduled = schedule_[index];
+                if (error == nullptr) {
+                    try {
+                        if (scheduled.backward->error != nullptr) {
+                            std::rethrow_exception(scheduled.backward->error);
+                        }
+                        CompleteScheduledOpNode(index, ready);
+                    } catch (...) {
+                        error = std::current_exception();
+                    }
                 }
+                scheduled.backward.reset();
+                scheduled.op_node.reset();
             }
         }
 
-        if (loss_scale_.has_value()) {
-            for (auto grad_ref : to_scale_back_nodes_) {
-                if (grad_ref->get().has_value()) {
-                    Array& grad = grad_ref->get().value();
-                    grad = grad / loss_scale_.value();
+        if (error != nullptr) {
+            std::rethrow_exception(error);
+        }
+        CHAINERX_ASSERT(processed_count == schedule_.size());
+    }
+
+    // Accumulates the gradients computed by a scheduled op node, releases it and marks its creators ready if possible.
+    void CompleteScheduledOpNode(size_t index, std::priority_queue<size_t, std::vector<size_t>, std::greater<size_t>>& ready) {
+        ScheduledOpNode& scheduled = schedule_[index];
+        const std::shared_ptr<OpNode>& op_node = scheduled.op_node;
+
+        std::vector<absl::optional<Array>> gxs = CollectInputGradients(*scheduled.backward);
+        if (execution_mode_ == BackwardExecutionMode::kParallelDeterministic) {
+            AccumulateInputGradientsInOrder(index, *op_node, std::move(gxs));
+        } else {
+            AccumulateInputGradients(*op_node, std::move(gxs));
+        }
+        NotifyGradReady(*op_node);
+
+        for (size_t creator_index : scheduled.creator_indices) {
+            ScheduledOpNode& creator = schedule_[creator_index];
+            CHAINERX_ASSERT(creator.pending_consumer_count > 0);
+            if (--creator.pending_consumer_count == 0) {
+                ready.push(creator_index);
+            }
+        }
+
+        ReleaseOpNode(op_node);
+    }
+
+    // Builds the schedule by simulating the order in which the serial engine visits the op nodes, without modifying the graph.
+    void BuildSchedule() {
+        std::vector<std::shared_ptr<OpNode>> candidate_op_nodes;
+        std::unordered_set<const OpNode*> seen_op_nodes;
+        auto push_creator_op_node = [this, &candidate_op_nodes, &seen_op_nodes](const std::shared_ptr<ArrayNode>& array_node) {
+            const std::shared_ptr<OpNode>& creator_op_node = array_node->creator_op_node();
+            if (creator_op_node == nullptr) {
+                return;
+            }
+            if (!IsInSubgraph(*creator_op_node)) {
+                return;
+            }
+            if (seen_op_nodes.emplace(creator_op_node.get()).second) {
+                candidate_op_nodes.emplace_back(creator_op_node);
+                std::push_heap(candidate_op_nodes.begin(), candidate_op_nodes.end(), OpNodeComparator{});
+            }
+        };
+
+        for (const std::shared_ptr<ArrayNode>& array_node : output_array_nodes_) {
+            if (array_node != nullptr) {
+                push_creator_op_node(array_node);
+            }
+        }
+
+        std::unordered_map<const OpNode*, size_t> schedule_indices;
+        while (!candidate_op_nodes.empty()) {
+            std::pop_heap(candidate_op_nodes.begin(), candidate_op_nodes.end(), OpNodeComparator{});
+            std::shared_ptr<OpNode> op_node = std::move(candidate_op_nodes.back());
+            candidate_op_nodes.pop_back();
+
+            size_t index = schedule_.size();
+            schedule_indices.emplace(op_node.get(), index);
+            for (const std::shared_ptr<ArrayNode>& input_array_node : op_node->input_array_nodes()) {
+                if (input_array_node != nullptr) {
+                    push_creator_op_node(input_array_node);
                 }
             }
+            schedule_.emplace_back();
+            schedule_.back().op_node = std::move(op_node);
         }
 
-        // Register this graph as backpropped.
-        backprop_id_.context().SetBackpropDone(backprop_id_);
+        // Record the dependencies between the op nodes and the order in which the gradients of each array node are accumulated.
+        for (size_t index = 0; index < schedule_.size(); ++index) {
+            ScheduledOpNode& scheduled = schedule_[index];
+            for (const std::shared_ptr<ArrayNode>& input_array_node : scheduled.op_node->input_array_nodes()) {
+                if (input_array_node == nullptr) {
+                    continue;
+                }
+
+                if (execution_mode_ == BackwardExecutionMode::kParallelDeterministic) {
+                    OrderedGradAccumulation& accumulation = ordered_grad_accumulations_[input_array_node.get()];
+                    if (accumulation.contributors.empty() || accumulation.contributors.back() != index) {
+                        accumulation.array_node = input_array_node;
+                        accumulation.contributors.emplace_back(index);
+                        accumulation.partial_grads.emplace_back();
+                        accumulation.finished.emplace_back(static_cast<uint8_t>(false));
+                    }
+                }
+
+                const std::shared_ptr<OpNode>& creator_op_node = input_array_node->creator_op_node();
+                if (creator_op_node == nullptr) {
+                    continue;
+                }
+                auto it = schedule_indices.find(creator_op_node.get());
+                if (it == schedule_indices.end()) {
+                    // Not in the subgraph.
+                    continue;
+                }
+                size_t creator_index = it->second;
+                if (std::find(scheduled.creator_indices.begin(), scheduled.creator_indices.end(), creator_index) ==
+                    scheduled.creator_indices.end()) {
+                    scheduled.creator_indices.emplace_back(creator_index);
+                    ++schedule_[creator_index].pending_consumer_count;
+                }
+            }
+        }
     }
 
-private:
-    // Runs backward functions to compute gradients of input array nodes.
-    std::vector<absl::optional<Array>> ComputeInputGradients(const std::shared_ptr<OpNode>& op_node) {
+    // Counts the op nodes to be processed that consume each array node without a creator, so that it can be told when its gradient is
+    // final.
+    void CountLeafConsumers() {
+        std::vector<const OpNode*> op_nodes;
+        std::unordered_set<const OpNode*> seen_op_nodes;
+        auto push_creator_op_node = [this, &op_nodes, &seen_op_nodes](const std::shared_ptr<ArrayNode>& array_node) {
+            const std::shared_ptr<OpNode>& creator_op_node = array_node->creator_op_node();
+            if (IsInSubgraph(*creator_op_node) && seen_op_nodes.emplace(creator_op_node.get()).second) {
+                op_nodes.emplace_back(creator_op_node.get());
+            }
+        };
+
+        for (const std::shared_ptr<ArrayNode>& array_node : output_array_nodes_) {
+            if (array_node != nullptr && array_node->creator_op_node() != nullptr) {
+                push_creator_op_node(array_node);
+            }
+        }
+
+        for (size_t i = 0; i < op_nodes.size(); ++i) {
+            const internal::OpNodeInputArrayNodes& input_array_nodes = op_nodes[i]->input_array_nodes();
+            for (auto it = input_array_nodes.begin(); it != input_array_nodes.end(); ++it) {
+                const std::shared_ptr<ArrayNode>& input_array_node = *it;
+                if (input_array_node == nullptr) {
+                    continue;
+                }
+                if (input_array_node->creator_op_node() != nullptr) {
+                    push_creator_op_node(input_array_node);
+                } else if (std::find(input_array_nodes.begin(), it, input_array_node) == it) {
+                    // An op node is counted once even if the same array node appears more than once in its inputs.
+                    ++pending_leaf_consumer_counts_[input_array_node.get()];
+                }
+            }
+        }
+    }
+
+    // Calls the callback for the inputs of a processed op node whose gradients have become final.
+    // This must be called before the op node is unchained.
+    void NotifyGradReady(const OpNode& op_node) {
+        if (!grad_ready_callback_) {
+            return;
+        }
+        const internal::OpNodeInputArrayNodes& input_array_nodes = op_node.input_array_nodes();
+        for (auto it = input_array_nodes.begin(); it != input_array_nodes.end(); ++it) {
+            const std::shared_ptr<ArrayNode>& input_array_node = *it;
+            if (input_array_node == nullptr || std::find(input_array_nodes.begin(), it, input_array_node) != it) {
+                continue;
+            }
+            auto count_it = pending_leaf_consumer_counts_.find(input_array_node.get());
+            if (count_it == pending_leaf_consumer_counts_.end()) {
+                continue;
+            }
+            CHAINERX_ASSERT(count_it->second > 0);
+            if (--count_it->second > 0) {
+                continue;
+            }
+            pending_leaf_consumer_counts_.erase(count_it);
+
+            std::shared_ptr<ArrayBody> body = input_array_node->weak_body().lock();
+            if (body == nullptr) {
+                // The gradient is discarded.
+                continue;
+            }
+            internal::GradRef& grad_ref = array_node_grad_map_.at(input_array_node.get());
+            absl::optional<Array>& grad = grad_ref.get();
+            if (!grad.has_value()) {
+                continue;
+            }
+            if (loss_scale_.has_value() && to_scale_back_nodes_.erase(&grad_ref) > 0) {
+                found_non_finite_grads_ |= UnscaleGrads({&grad}, loss_scale_.value());
+            }
+            grad_ready_callback_(Array{std::move(body)}, *grad);
+        }
+    }
+
+    // Collects the output gradients of an op node and the backward entries to be called.
+    std::unique_ptr<OpNodeBackward> PrepareOpNodeBackward(const std::shared_ptr<OpNode>& op_node) {
         // A single op node has multiple backward functions, each of which computes the gradients of a subset of the inputs.
         // They are responsible for non-overlapping subsets of inputs.
-        // This function calls these backward functions, collects the gradients computed by them and returns the collected gradients.
         CHAINERX_ASSERT(op_node != nullptr);
 
-        // Output array nodes. May be nullptr if the node is gone.
-        std::vector<std::shared_ptr<ArrayNode>> output_array_nodes;
-
-        // `temp_output_grads` is a set of temporary GradRefs of this op node's output array nodes.
-        // This is used for output array nodes which are either dead at the moment or alive but have not been involved in the preceding
-        // backpropagation.
-        // This vector is just a keeper and not used in any other way. output_grads holds the pointer to it.
-        // These GradRefs are only valid in the backward functions of this op node.
-        // Be careful not to cause reallocation in this vector. Otherwise the pointers would be invalidated.
-        std::vector<internal::GradRef> temp_output_grads;
-        temp_output_grads.reserve(op_node->output_array_nodes().size());
+        auto backward = std::make_unique<OpNodeBackward>();
+        backward->op_node = op_node;
+        backward->temp_output_grads.reserve(op_node->output_array_nodes().size());
 
-        std::vector<internal::GradRef*> output_grads;
         for (const absl::optional<std::weak_ptr<ArrayNode>>& maybe_output_array_node : op_node->output_array_nodes()) {
             std::shared_ptr<ArrayNode> output_array_node = maybe_output_array_node.has_value() ? maybe_output_array_node->lock() : nullptr;
 
@@ -349,38 +766,80 @@ private:
                 if (it != array_node_grad_map_.end()) {
                     // The grad mapping has the gradient for the array node.
                     // Keep a pointer to the gradient in the map.
-                    output_grads.emplace_back(&it->second);
+                    backward->output_grads.emplace_back(&it->second);
                 } else {
                     // The grad mapping has no entry for the array node.
                     // Create a new entry in temporary gradients and keep a pointer to it.
-                    temp_output_grads.emplace_back(*output_array_node);
-                    output_grads.emplace_back(&temp_output_grads.back());
+                    backward->temp_output_grads.emplace_back(*output_array_node);
+                    backward->output_grads.emplace_back(&backward->temp_output_grads.back());
                 }
             } else {
                 // Output array node is dead.
                 // Keep a pointer to the temporary gradient vector.
-                temp_output_grads.emplace_back(absl::nullopt);
-                output_grads.emplace_back(&temp_output_grads.back());
+                backward->temp_output_grads.emplace_back(absl::nullopt);
+                backward->output_grads.emplace_back(&backward->temp_output_grads.back());
             }
 
-            output_array_nodes.emplace_back(std::move(output_array_node));
+            backward->output_array_nodes.emplace_back(std::move(output_array_node));
         }
 
-        // Call the backward functions and collects their gradients.
-        std::vector<absl::optional<Array>> input_grads;
-        input_grads.resize(op_node->input_array_node_count());
-
-        const std::vector<uint8_t>& requires_grad = input_required_flags_[op_node.get()];
+        const internal::InputRequiredFlags& requires_grad = op_node->input_required_flags();
         for (const internal::OpNodeBackwardEntry& backward_entry : op_node->backward_entries()) {
-            // Compute and set gradients at the appropriate indices.
             if (inputs_.empty() || std::any_of(
                                            backward_entry.input_array_node_indices().begin(),
                                            backward_entry.input_array_node_indices().end(),
                                            [&requires_grad](size_t i_input) { return static_cast<bool>(requires_grad[i_input]); })) {
-                CallBackwardForSubsetOfInputGradients(op_node, backward_entry, output_array_nodes, input_grads, output_grads);
+                backward->backward_entries.emplace_back(&backward_entry);
+            }
+        }
+        backward->computed_input_grads.resize(backward->backward_entries.size());
+
+        return backward;
+    }
+
+    // Calls the backward functions of an op node. This may be called on a worker thread.
+    void CallBackwardFunctions(OpNodeBackward& backward) const {
+        for (size_t i = 0; i < backward.backward_entries.size(); ++i) {
+            const internal::OpNodeBackwardEntry& backward_entry = *backward.backward_entries[i];
+
+            // `computed_input_grads` holds the storage of gradients of all the inputs of the op node.
+            // The given backward entry will compute and store a subset of those gradients.
+            // The backward entry may compute and store the gradients of other inputs as well, which will be ignored.
+            std::vector<Array>& computed_input_grads = backward.computed_input_grads[i];
+            computed_input_grads.resize(backward.op_node->input_array_node_count());
+
+            // Call backward.
+            BackwardContext bctx{backward.op_node,
+                                 backward_entry,
+                                 absl::MakeSpan(backward.output_array_nodes),
+                                 absl::MakeSpan(backward.output_grads),
+                                 computed_input_grads,
+                                 double_backprop_};
+            {
+                NoBackpropModeScope scope{backprop_ids_to_stop_gradient_};
+                backward_entry.backward_func()(bctx);
             }
         }
 
+        // Without double backprop, the backward functions are never called again. They are released here rather than when the op node
+        // is unchained, so that the retained arrays are freed before the gradients are accumulated.
+        if (double_backprop_ == DoubleBackpropOption::kDisable) {
+            backward.op_node->ReleaseBackwardFunctions();
+        }
+    }
+
+    // Collects the gradients computed by the backward functions of an op node and returns them.
+    std::vector<absl::optional<Array>> CollectInputGradients(OpNodeBackward& backward) {
+        const std::shared_ptr<OpNode>& op_node = backward.op_node;
+        std::vector<std::shared_ptr<ArrayNode>>& output_array_nodes = backward.output_array_nodes;
+
+        std::vector<absl::optional<Array>> input_grads;
+        input_grads.resize(op_node->input_array_node_count());
+
+        for (size_t i = 0; i < backward.backward_entries.size(); ++i) {
+            SetSubsetOfInputGradients(op_node, *backward.backward_entries[i], backward.computed_input_grads[i], input_grads);
+        }
+
         // Make a view if the input gradient whose array body is identical to one of other output or input gradients.
         // Otherwise modifying operations such as requiring grad on one gradient would be transferred to other gradients.
         // TODO(niboshi): View is needed to make new nodes. Come up with a solution to avoid extra backward insertion.
@@ -418,42 +877,21 @@ private:
             }
         }
 
-        // Erase processed OpNode from the map
-        output_array_node_keeper_.erase(op_node.get());
-
         return input_grads;
     }
 
-    // Calls a single backward function that computes a subset of the gradients and returns the result.
-    void CallBackwardForSubsetOfInputGradients(
+    // Sets the gradients computed by a single backward entry at the appropriate indices of the input gradients.
+    void SetSubsetOfInputGradients(
             const std::shared_ptr<OpNode>& op_node,
             const internal::OpNodeBackwardEntry& backward_entry,
-            std::vector<std::shared_ptr<ArrayNode>>& output_array_nodes,
-            std::vector<absl::optional<Array>>& input_grads,
-            std::vector<internal::GradRef*>& output_grads) {
-        // `computed_input_grads` holds the storage of gradients of all the inputs of the op node.
-        // The given backward entry will compute and store a subset of those gradients.
-        // The backward entry may compute and store the gradients of other inputs as well, which will be ignored.
-        std::vector<Array> computed_input_grads(input_grads.size());
-
-        // Call backward.
-        BackwardContext bctx{op_node,
-                             backward_entry,
-                             absl::MakeSpan(output_array_nodes),
-                             absl::MakeSpan(output_grads),
-                             computed_input_grads,
-                             double_backprop_};
-        {
-            NoBackpropModeScope scope{backprop_ids_to_stop_gradient_};
-            backward_entry.backward_func()(bctx);
-        }
-
+            std::vector<Array>& computed_input_grads,
+            std::vector<absl::optional<Array>>& input_grads) {
         for (size_t i_input_grad : backward_entry.input_array_node_indices()) {
             // Continue if input grad is not required.
             if (!op_node->HasInputArrayNode(i_input_grad)) {
                 continue;
             }
-            if (!inputs_.empty() && !static_cast<bool>(input_required_flags_[op_node.get()][i_input_grad])) {
+            if (!inputs_.empty() && !static_cast<bool>(op_node->input_required_flags()[i_input_grad])) {
                 // Traversing through subgraph but input is not a part of it.
                 continue;
             }
@@ -542,6 +980,87 @@ private:
         }
     }
 
+    // Buffers the gradients computed by the op node at the given index of the schedule and accumulates the buffered gradients in the
+    // order of the serial engine, as far as the preceding contributions are available.
+    void AccumulateInputGradientsInOrder(size_t index, const OpNode& op_node, std::vector<absl::optional<Array>> gxs) {
+        absl::Span<const std::shared_ptr<ArrayNode>> input_array_nodes = op_node.input_array_nodes();
+        CHAINERX_ASSERT(input_array_nodes.size() == gxs.size());
+
+        auto contributor_position = [index](const OrderedGradAccumulation& accumulation) {
+            auto it = std::lower_bound(accumulation.contributors.begin(), accumulation.contributors.end(), index);
+            CHAINERX_ASSERT(it != accumulation.contributors.end() && *it == index);
+            return static_cast<size_t>(it - accumulation.contributors.begin());
+        };
+
+        for (size_t i = 0; i < input_array_nodes.size(); ++i) {
+            absl::optional<Array>& gx = gxs[i];
+            if (gx.has_value()) {
+                CHAINERX_ASSERT(input_array_nodes[i] != nullptr);
+                OrderedGradAccumulation& accumulation = ordered_grad_accumulations_.at(input_array_nodes[i].get());
+                accumulation.partial_grads[contributor_position(accumulation)].emplace_back(std::move(*gx));
+            }
+        }
+
+        for (const std::shared_ptr<ArrayNode>& input_array_node : input_array_nodes) {
+            if (input_array_node == nullptr) {
+                continue;
+            }
+            // The entry is already gone if the same array node appears more than once in the inputs.
+            auto it = ordered_grad_accumulations_.find(input_array_node.get());
+            if (it == ordered_grad_accumulations_.end()) {
+                continue;
+            }
+            OrderedGradAccumulation& accumulation = it->second;
+            accumulation.finished[contributor_position(accumulation)] = static_cast<uint8_t>(true);
+
+            const ArrayNode& array_node = *accumulation.array_node;
+            while (accumulation.flushed_count < accumulation.contributors.size() &&
+                   static_cast<bool>(accumulation.finished[accumulation.flushed_count])) {
+                internal::GradRef& input_grad = array_node_grad_map_.at(accumulation.array_node.get());
+                for (Array& partial_grad : accumulation.partial_grads[accumulation.flushed_count]) {
+                    internal::AccumulateGrad(
+                            input_grad.get(), std::move(partial_grad), array_node.shape(), array_node.dtype(), array_node.device());
+                }
+                accumulation.partial_grads[accumulation.flushed_count].clear();
+                ++accumulation.flushed_count;
+            }
+            if (accumulation.flushed_count == accumulation.contributors.size()) {
+                ordered_grad_accumulations_.erase(it);
+            }
+        }
+    }
+
+    // Pushes the creator op nodes of the inputs of a processed op node and releases the resources held for the op node.
+    void ReleaseOpNode(const std::shared_ptr<OpNode>& op_node) {
+        // Push the creator op nodes into the queue
+        for (const auto& input_array_node : op_node->input_array_nodes()) {
+            if (input_array_node != nullptr) {
+                PushCreatorOpNode(input_array_node);
+            }
+        }
+
+        if (double_backprop_ == DoubleBackpropOption::kDisable) {
+            op_node->Unchain();
+        }
+
+        // Erase the output array nodes' gradient references, which may hold temporary gradients of arrays that are already gone, as the
+        // gradients have been propagated to the inputs. References to be scaled back at the end are kept.
+        {
+            auto range = output_array_node_keeper_.equal_range(op_node.get());
+            for (auto it = range.first; it != range.second; ++it) {
+                auto grad_it = array_node_grad_map_.find(it->second.get());
+                CHAINERX_ASSERT(grad_it != array_node_grad_map_.end());
+                if (to_scale_back_nodes_.find(&grad_it->second) == to_scale_back_nodes_.end()) {
+                    array_node_grad_map_.erase(grad_it);
+                }
+            }
+            output_array_node_keeper_.erase(range.first, range.second);
+        }
+    }
+
+    // Returns true if the op node is necessary for computing the gradients w.r.t. the inputs.
+    bool IsInSubgraph(const OpNode& op_node) const { return inputs_.empty() || op_node.IsInSubgraph(subgraph_epoch_); }
+
     void PushCreatorOpNode(const std::shared_ptr<ArrayNode>& array_node) {
         // When double backprop is disabled, array_node releases the pointer to the creator op node here. After this operation, array_node
         // will look like a leaf node of the graph. Note that this move does not invalidates the array_node object itself; it is guaranteed
@@ -551,7 +1070,7 @@ private:
 
         if (creator_op_node) {
             // If inputs are specified, only push back creator op nodes that are included in the subgraph.
-            if (!inputs_.empty() && input_required_flags_.find(creator_op_node.get()) == input_required_flags_.end()) {
+            if (!IsInSubgraph(*creator_op_node)) {
                 return;
             }
 
@@ -560,8 +1079,9 @@ private:
                 // First appearance of the combination of op node and input array node.
                 bool is_first_visit = range.first == range.second;
                 output_array_node_keeper_.emplace(creator_op_node.get(), array_node);  // Iterators are invalidated here.
-                if (is_first_visit) {
+                if (is_first_visit && execution_mode_ == BackwardExecutionMode::kSerial) {
                     // First appearance of this op node. Push it to the queue.
+                    // In parallel execution, the op nodes are dispatched according to the schedule instead.
                     candidate_op_nodes_.push_back(std::move(creator_op_node));
                     std::push_heap(candidate_op_nodes_.begin(), candidate_op_nodes_.end(), OpNodeComparator{});
                 }
@@ -572,6 +1092,12 @@ private:
     // Op nodes to be visited. This is a max heap ordered by the rank of each op node (see OpNodeComparator).
     std::vector<std::shared_ptr<OpNode>> candidate_op_nodes_;
 
+    // Op nodes in the order of the serial engine, used in parallel execution only.
+    std::vector<ScheduledOpNode> schedule_;
+
+    // Pending partial gradients of array nodes, used in deterministic parallel execution only.
+    std::unordered_map<const ArrayNode*, OrderedGradAccumulation> ordered_grad_accumulations_;
+
     // This mapping is used to keep output array nodes alive (referenced from op nodes as weak pointers).
     std::unordered_multimap<const OpNode*, std::shared_ptr<ArrayNode>> output_array_node_keeper_;
 
@@ -589,9 +1115,9 @@ private:
 
     std::vector<BackpropId> backprop_ids_to_stop_gradient_;
 
-    // Represents the subgraph required for backprop in case any inputs are specified.
-    // Specifically, stores for an op nodes a vector of boolean flags whether an input at that index is included in the subgraph.
-    std::unordered_map<OpNode*, std::vector<uint8_t>> input_required_flags_;
+    // Identifies the subgraph required for backprop in case any inputs are specified.
+    // The op nodes in the subgraph hold boolean flags whether an input at that index is included in the subgraph.
+    uint64_t subgraph_epoch_{0};
 
     // To mark if grads of intermediate nodes in the graph should be kept
     bool retain_grad_;
@@ -600,30 +1126,44 @@ private:
     absl::optional<float> loss_scale_;
 
     std::unordered_set<internal::GradRef*> to_scale_back_nodes_;
+
+    // Whether any of the gradients scaled back with the loss scale contains infinity or NaN.
+    bool found_non_finite_grads_{false};
+
+    BackwardExecutionMode execution_mode_;
+
+    GradReadyCallback grad_ready_callback_;
+
+    // Number of op nodes yet to be processed that consume each array node without a creator, used only if grad_ready_callback_ is set.
+    std::unordered_map<const ArrayNode*, size_t> pending_leaf_consumer_counts_;
 };
 
 }  // namespace
 
-void Backward(
+BackwardStats Backward(
         const Array& output,
         const absl::optional<BackpropId>& backprop_id,
         DoubleBackpropOption double_backprop,
-        absl::optional<float> loss_scale) {
+        absl::optional<float> loss_scale,
+        BackwardExecutionMode execution_mode,
+        const GradReadyCallback& grad_ready_callback) {
     BackpropId actual_backprop_id = internal::GetArrayBackpropId(output, backprop_id);
     std::vector<ConstArrayRef> outputs{output};  // Do not inline it; we need to guarantee that the vector is alive until Run() finishes.
-    BackwardImpl{{}, outputs, actual_backprop_id, double_backprop, loss_scale}.Run();
+    return BackwardImpl{{}, outputs, actual_backprop_id, double_backprop, loss_scale, execution_mode, grad_ready_callback}.Run();
 }
 
-void Backward(
+BackwardStats Backward(
         const std::vector<ConstArrayRef>& outputs,
         const absl::optional<BackpropId>& backprop_id,
         DoubleBackpropOption double_backprop,
-        absl::optional<float> loss_scale) {
+        absl::optional<float> loss_scale,
+        BackwardExecutionMode execution_mode,
+        const GradReadyCallback& grad_ready_callback) {
     if (outputs.empty()) {
-        return;
+        return {};
     }
     BackpropId actual_backprop_id = internal::GetArrayBackpropId(outputs.front().get(), backprop_id);
-    BackwardImpl{{}, outputs, actual_backprop_id, double_backprop, loss_scale}.Run();
+    return BackwardImpl{{}, outputs, actual_backprop_id, double_backprop, loss_scale, execution_mode, grad_ready_callback}.Run();
 }
 
 std::vector<absl::optional<Array>> Grad(
@@ -634,7 +1174,8 @@ std::vector<absl::optional<Array>> Grad(
         bool set_grad,
         bool retain_grad,
         const std::vector<ConstArrayRef>& grad_outputs,
-        absl::optional<float> loss_scale) {
+        absl::optional<float> loss_scale,
+        BackwardExecutionMode execution_mode) {
     if (inputs.empty()) {
         return {};
     }
@@ -674,7 +1215,17 @@ std::vector<absl::optional<Array>> Grad(
             array_node_grad_map.emplace(array_node.get(), internal::GradRef{&output_grads.back()});
         }
     }
-    BackwardImpl{inputs, outputs, actual_backprop_id, double_backprop, std::move(array_node_grad_map), retain_grad, loss_scale}.Run();
+    BackwardImpl{
+            inputs,
+            outputs,
+            actual_backprop_id,
+            double_backprop,
+            std::move(array_node_grad_map),
+            retain_grad,
+            loss_scale,
+            execution_mode,
+            nullptr}
+            .Run();
 
     for (size_t i = 0; i < input_grads.size(); ++i) {
         absl::optional<Array>& grad = input_grads[i];
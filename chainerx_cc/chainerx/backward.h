@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <functional>
 #include <vector>
 
 #include <absl/types/optional.h>
@@ -20,6 +22,13 @@ namespace internal {
 class ArrayBody;
 class ArrayNode;
 
+// Returns whether a gradient can be updated in place, i.e. neither its body nor its buffer is shared with other arrays and it does not
+// belong to any graph. Buffers shared with the callers of FromData() are never updated in place.
+bool IsGradUniquelyOwned(const Array& grad);
+
+// Adds the partial gradient to the target gradient.
+// The target gradient is updated in place if it is uniquely owned, and replaced with the sum otherwise.
+//
 // Throws GradientError in case of mismatch in gradient array props.
 void AccumulateGrad(absl::optional<Array>& target_grad, Array partial_grad, const Shape& shape, Dtype dtype, Device& device);
 
@@ -28,23 +37,52 @@ void SetGrad(absl::optional<Array>& target_grad, Array grad, const Shape& shape,
 
 }  // namespace internal
 
+// Statistics of a backward computation.
+struct BackwardStats {
+    // Largest number of bytes allocated on the devices of the output arrays during the computation, summed over the devices.
+    // See Device::peak_allocated_bytes(). Allocations made concurrently by other threads on the same devices are included.
+    size_t peak_allocated_bytes{0};
+
+    // Whether any of the gradients scaled back with the loss scale contains infinity or NaN. Always false if no loss scale is given.
+    bool found_non_finite_grads{false};
+};
+
+// Function called by Backward() as soon as the gradient of an array without a creator, e.g. a parameter, is final.
+// The arguments are the array and its gradient. The gradient is already scaled back if a loss scale is given.
+using GradReadyCallback = std::function<void(const Array& array, const Array& grad)>;
+
 // Updates the gradients held by the input arrays using backpropagation.
 //
 // This functions is not thread safe.
-void Backward(
+//
+// If grad_ready_callback is given, it is called on the calling thread for each array without a creator once no other op node in the
+// graph can contribute to its gradient, while the rest of the graph is still being backpropped. This allows, e.g., communicating the
+// gradients of parameters concurrently with the backward computation. The callback should return quickly, e.g. by starting an
+// asynchronous operation, since the backward computation waits for it.
+//
+// When double backprop is disabled, the backward functions of an op node, and the arrays they retain, are released as soon as they have
+// been called. Gradients of intermediate arrays that are no longer referenced are released once they have been propagated.
+//
+// The parallel execution modes are used only when double backprop is disabled and the graph is the default (outermost) graph of the
+// context, since backward functions may otherwise record new nodes concurrently. The serial mode is used in other cases.
+BackwardStats Backward(
         const Array& output,
         const absl::optional<BackpropId>& backprop_id = absl::nullopt,
         DoubleBackpropOption double_backprop = DoubleBackpropOption::kDisable,
-        absl::optional<float> loss_scale = absl::nullopt);
+        absl::optional<float> loss_scale = absl::nullopt,
+        BackwardExecutionMode execution_mode = BackwardExecutionMode::kSerial,
+        const GradReadyCallback& grad_ready_callback = nullptr);
 
 // Updates the gradients held by the input arrays using backpropagation.
 //
 // This functions is not thread safe.
-void Backward(
+BackwardStats Backward(
         const std::vector<ConstArrayRef>& outputs,
         const absl::optional<BackpropId>& backprop_id = absl::nullopt,
         DoubleBackpropOption double_backprop = DoubleBackpropOption::kDisable,
-        absl::optional<float> loss_scale = absl::nullopt);
+        absl::optional<float> loss_scale = absl::nullopt,
+        BackwardExecutionMode execution_mode = BackwardExecutionMode::kSerial,
+        const GradReadyCallback& grad_ready_callback = nullptr);
 
 // Returns gradient arrays for all inputs.
 std::vector<absl::optional<Array>> Grad(
@@ -55,6 +93,7 @@ std::vector<absl::optional<Array>> Grad(
         bool set_grad = false,
         bool retain_grad = false,
         const std::vector<ConstArrayRef>& grad_outputs = {},
-        absl::optional<float> loss_scale = absl::nullopt);
+        absl::optional<float> loss_scale = absl::nullopt,
+        BackwardExecutionMode execution_mode = BackwardExecutionMode::kSerial);
 
 }  // namespace chainerx
@@ -16,9 +16,14 @@
 #include "chainerx/array_node.h"
 #include "chainerx/backprop_mode.h"
 #include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
 #include "chainerx/graph.h"
+#include "chainerx/kernels/misc.h"
 #include "chainerx/macro.h"
 #include "chainerx/op_node.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/shape.h"
 
 namespace chainerx {
 namespace {
@@ -30,6 +35,10 @@ using internal::OpNode;
 
 BackwardBuilder::Target::Target(BackwardBuilder& builder, std::vector<size_t> input_indices)
     : builder_{builder}, input_indices_{std::move(input_indices)} {
+    if (builder_.inference_mode_) {
+        return;
+    }
+
     // All input arrays must have the same device.
     CHAINERX_ASSERT(std::all_of(input_indices.begin(), input_indices.end(), [this](size_t input_index) {
         return &gsl::at(builder_.inputs_, input_index).get().device() == &(builder_.inputs_.front().get().device());
@@ -48,7 +57,7 @@ absl::flat_hash_map<BackpropId, BackwardBuilder::Target::InputArrayNodes> Backwa
             // Need to access the input array via the builder.
             const Array& input = gsl::at(builder_.inputs_, input_index);
 
-            for (std::shared_ptr<ArrayNode>& input_array_node : internal::GetArrayBody(input)->nodes()) {
+            for (const std::shared_ptr<ArrayNode>& input_array_node : internal::GetArrayBody(input)->nodes()) {
                 const BackpropId& backprop_id = input_array_node->backprop_id();
                 if (!IsBackpropRequired(backprop_id)) {
                     continue;
@@ -108,13 +117,18 @@ void BackwardBuilder::Target::Define(const BackwardFunction& backward_func) {
 BackwardBuilder::BackwardBuilder(const char* op_name, std::vector<ConstArrayRef> inputs, std::vector<ConstArrayRef> outputs)
     : op_name_{op_name},
       context_{inputs.front().get().context()},
+      inference_mode_{IsInferenceMode()},
       inputs_{std::move(inputs)},
-      inputs_target_created_(inputs_.size()),
+      inputs_target_created_(inference_mode_ ? 0 : inputs_.size()),
       outputs_{std::move(outputs)},
       input_retention_record_{inputs_.size()},
       output_retention_record_{outputs_.size()} {
     CHAINERX_ASSERT(!inputs_.empty());
     CHAINERX_ASSERT(!outputs_.empty());
+    if (inference_mode_) {
+        has_any_applicable_outputs_ = false;
+        return;
+    }
     CHAINERX_ASSERT(inputs_.size() == inputs_target_created_.size());
     CHAINERX_ASSERT(
             std::all_of(inputs_.begin(), inputs_.end(), [](const Array& input) { return internal::GetArrayBody(input) != nullptr; }));
@@ -179,8 +193,28 @@ std::vector<RetainedOutputToken> BackwardBuilder::RetainOutput(std::vector<size_
     return token;
 }
 
+RetainedCompactArrayToken BackwardBuilder::RetainMask(const Array& mask) {
+    if (mask.dtype() != Dtype::kBool) {
+        throw DtypeError{"Mask to retain must be a boolean array, but got ", GetDtypeName(mask.dtype()), "."};
+    }
+    NoBackpropModeScope scope{context_};
+    Array mask_contiguous = AsContiguous(mask);
+    Array packed = Empty(Shape{(mask.GetTotalSize() + 7) / 8}, Dtype::kUInt8, mask.device());
+    mask.device().backend().CallKernel<PackBitsKernel>(mask_contiguous, packed);
+    return {std::move(packed), mask.shape(), Dtype::kBool};
+}
+
+RetainedCompactArrayToken BackwardBuilder::RetainAsType(const Array& array, Dtype dtype) {
+    NoBackpropModeScope scope{context_};
+    return {array.AsGradStopped().AsType(dtype, false), array.shape(), array.dtype()};
+}
+
 void BackwardBuilder::Finalize() {
     CHAINERX_ASSERT(!is_finalized_);
+    if (inference_mode_) {
+        is_finalized_ = true;
+        return;
+    }
     // Checks that the backward definitions cover all the input arrays.
     CHAINERX_ASSERT(std::all_of(inputs_target_created_.begin(), inputs_target_created_.end(), [](bool done) { return done; }));
 
@@ -242,12 +276,15 @@ void BackwardBuilder::AddEdgesFromOpNodeToArrayNodeOfOuterGraphsForRetention() {
     // Add edges to input array nodes
     if (input_retention_record_.IsAnyRecorded()) {
         // Collect graphs to which the retained inputs belong.
+        // Graphs in which the op is not recorded, e.g. those stopped by NoBackpropModeScope, are excluded.
         // TODO(beam2d): Use a lighter container.
         std::unordered_set<BackpropId> retained_graphs{};
         for (size_t i = 0; i < input_retention_record_.size(); ++i) {
             if (input_retention_record_.IsRecorded(i)) {
                 for (const std::shared_ptr<ArrayNode>& array_node : internal::GetArrayBody(gsl::at(inputs_, i))->nodes()) {
-                    retained_graphs.emplace(array_node->backprop_id());
+                    if (op_node_map_.find(array_node->backprop_id()) != op_node_map_.end()) {
+                        retained_graphs.emplace(array_node->backprop_id());
+                    }
                 }
             }
         }
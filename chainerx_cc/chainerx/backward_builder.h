@@ -89,6 +89,37 @@ using RetainedInputToken = backward_builder_detail::RetainedArrayToken<struct In
 // See BackwardBuilder::RetainOutput() for details.
 using RetainedOutputToken = backward_builder_detail::RetainedArrayToken<struct OutputTag>;
 
+// An object used by op implementations to bridge between BackwardBuilder::RetainMask() or BackwardBuilder::RetainAsType() and
+// BackwardContext::GetRetainedCompactArray().
+//
+// It holds a compact copy of an array that is not connected to any graph.
+class RetainedCompactArrayToken {
+public:
+    ~RetainedCompactArrayToken() = default;
+
+    RetainedCompactArrayToken(const RetainedCompactArrayToken&) = default;
+    RetainedCompactArrayToken(RetainedCompactArrayToken&&) noexcept = default;
+    RetainedCompactArrayToken& operator=(const RetainedCompactArrayToken&) = default;
+    RetainedCompactArrayToken& operator=(RetainedCompactArrayToken&&) = default;  // NOLINT(performance-noexcept-move-constructor)
+
+    // Returns the number of bytes of the retained data.
+    int64_t GetNBytes() const { return data_.GetNBytes(); }
+
+private:
+    friend class BackwardBuilder;
+    friend class BackwardContext;
+
+    RetainedCompactArrayToken(Array data, Shape shape, Dtype dtype) : data_{std::move(data)}, shape_{std::move(shape)}, dtype_{dtype} {}
+
+    // The bits of a boolean array packed into a 1-dimensional uint8 array, or a copy of an array in another, usually lower-precision,
+    // dtype.
+    Array data_;
+
+    // Shape and dtype of the original array.
+    Shape shape_;
+    Dtype dtype_;
+};
+
 // A class that is used to define backward operations and connect the graph.
 //
 // This class is not thread safe.
@@ -142,6 +173,10 @@ public:
 
     // Creates a backward target for the specified inputs.
     Target CreateTarget(std::vector<size_t> input_indices) {
+        if (inference_mode_) {
+            return Target{*this, {}};
+        }
+
         // input_indices shouldn't have duplicates.
         CHAINERX_ASSERT((std::set<size_t>{input_indices.begin(), input_indices.end()}.size() == input_indices.size()));
 
@@ -154,10 +189,19 @@ public:
     }
 
     // Creates a backward target for the specified input.
-    Target CreateTarget(size_t input_index) { return CreateTarget(std::vector<size_t>{input_index}); }
+    Target CreateTarget(size_t input_index) {
+        if (inference_mode_) {
+            return Target{*this, {}};
+        }
+        return CreateTarget(std::vector<size_t>{input_index});
+    }
 
     // Creates a backward target for all the inputs.
     Target CreateTarget() {
+        if (inference_mode_) {
+            return Target{*this, {}};
+        }
+
         std::vector<size_t> input_indices;
         input_indices.resize(inputs_.size());
         std::iota(input_indices.begin(), input_indices.end(), size_t{0});
@@ -188,9 +232,30 @@ public:
     RetainedOutputToken RetainOutput(size_t output_index);
     std::vector<RetainedOutputToken> RetainOutput(std::vector<size_t> indices);
 
+    // Retains a boolean array for use in the backward pass, packing its elements into bits.
+    //
+    // This is meant for ops whose backward only needs a mask of the inputs, e.g. the sign pattern of the input of ReLU; retaining the
+    // mask instead of the input takes 1 bit per element. In the backward pass, the mask can be retrieved with
+    // BackwardContext::GetRetainedCompactArray().
+    //
+    // Unlike RetainInput() and RetainOutput(), the retained array is not connected to any graph, i.e. it is treated as a constant in
+    // double backprop.
+    RetainedCompactArrayToken RetainMask(const Array& mask);
+
+    // Retains a copy of an array cast to the given dtype for use in the backward pass.
+    //
+    // This is meant for ops which can tolerate the precision loss of their retained arrays, e.g. storing float32 activations in float16
+    // halves their memory. In the backward pass, the array cast back to its original dtype can be retrieved with
+    // BackwardContext::GetRetainedCompactArray().
+    //
+    // Like RetainMask(), the retained array is not connected to any graph. It must not be used where the backward function needs to be
+    // differentiated with respect to the array.
+    RetainedCompactArrayToken RetainAsType(const Array& array, Dtype dtype);
+
     // Finalizes the builder.
     //
-    // This functions must be called when targets have been created for all inputs.
+    // This functions must be called when targets have been created for all inputs, except in the inference mode (see InferenceModeScope),
+    // in which the builder records nothing and targets need not be created.
     void Finalize();
 
 private:
@@ -209,6 +274,9 @@ private:
 
     Context& context_;
 
+    // Whether the builder was constructed in the inference mode, in which it records nothing.
+    bool inference_mode_;
+
     // Input arrays of the op.
     std::vector<ConstArrayRef> inputs_;
 
@@ -8,6 +8,8 @@
 #include "chainerx/backward.h"
 #include "chainerx/backward_context.h"
 #include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/graph.h"
 #include "chainerx/macro.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/shape.h"
@@ -219,5 +221,72 @@ TEST(BackwardBuilderTest, FloatToInt_GetIntRetainOutputArrayNodeIsGone) {
     EXPECT_ARRAY_EQ(e, *x.GetGrad());
 }
 
+TEST(BackwardBuilderTest, RetainMask) {
+    testing::ContextSession context_session;
+    Shape shape{3, 5};
+
+    // Take a non-contiguous mask whose size is not a multiple of 8.
+    Array mask = testing::BuildArray({5, 3}).WithData<bool>(
+            {true, false, false, true, true, false, false, false, true, true, false, true, false, true, true});
+    mask = mask.Transpose();
+    ASSERT_FALSE(mask.IsContiguous());
+    Array x = Ones(shape, Dtype::kFloat32).RequireGrad();
+    Array y = Ones(shape, Dtype::kFloat32);
+    {
+        BackwardBuilder bb{"forward", x, y};
+        BackwardBuilder::Target bt = bb.CreateTarget(0);
+        RetainedCompactArrayToken mask_tok = bb.RetainMask(mask);
+        EXPECT_EQ(2, mask_tok.GetNBytes());
+        bt.Define([mask_tok = std::move(mask_tok), expected_mask = mask.Copy()](BackwardContext& bctx) {
+            Array retained_mask = bctx.GetRetainedCompactArray(mask_tok);
+            EXPECT_FALSE(retained_mask.IsBackpropRequired(AnyGraph{}));
+            EXPECT_ARRAY_EQ(expected_mask, retained_mask);
+            bctx.input_grad() = *bctx.output_grad() * retained_mask;
+        });
+        bb.Finalize();
+    }
+
+    y.SetGrad(Full(shape, 2.0f));
+    Backward(y);
+    EXPECT_ARRAY_EQ(mask.AsType(Dtype::kFloat32) * 2, *x.GetGrad());
+}
+
+TEST(BackwardBuilderTest, RetainMaskNonBool) {
+    testing::ContextSession context_session;
+    Array x = Ones({2, 3}, Dtype::kFloat32).RequireGrad();
+    Array y = Ones({2, 3}, Dtype::kFloat32);
+    BackwardBuilder bb{"forward", x, y};
+    BackwardBuilder::Target bt = bb.CreateTarget(0);
+    EXPECT_THROW(bb.RetainMask(x), DtypeError);
+    bt.Define([](BackwardContext& bctx) { bctx.input_grad() = *bctx.output_grad(); });
+    bb.Finalize();
+}
+
+TEST(BackwardBuilderTest, RetainAsType) {
+    testing::ContextSession context_session;
+    Shape shape{2, 3};
+
+    Array x = testing::BuildArray(shape).WithData<double>({1, -2, 0.5, 4, -0.25, 6});
+    x.RequireGrad();
+    Array y = EmptyLike(x);
+    {
+        BackwardBuilder bb{"square", x, y};
+        BackwardBuilder::Target bt = bb.CreateTarget(0);
+        RetainedCompactArrayToken x_tok = bb.RetainAsType(x, Dtype::kFloat16);
+        EXPECT_EQ(x.GetNBytes() / 4, x_tok.GetNBytes());
+        bt.Define([x_tok = std::move(x_tok)](BackwardContext& bctx) {
+            Array retained_x = bctx.GetRetainedCompactArray(x_tok);
+            EXPECT_EQ(Dtype::kFloat64, retained_x.dtype());
+            EXPECT_FALSE(retained_x.IsBackpropRequired(AnyGraph{}));
+            bctx.input_grad() = *bctx.output_grad() * 2 * retained_x;
+        });
+        bb.Finalize();
+    }
+
+    y.SetGrad(Ones(shape, Dtype::kFloat64));
+    Backward(y);
+    EXPECT_ARRAY_EQ(testing::BuildArray(shape).WithData<double>({2, -4, 1, 8, -0.5, 12}), *x.GetGrad());
+}
+
 }  // namespace
 }  // namespace chainerx
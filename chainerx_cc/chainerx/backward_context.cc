@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -16,10 +17,13 @@
 #include "chainerx/array_node.h"
 #include "chainerx/backprop_mode.h"
 #include "chainerx/device.h"
+#include "chainerx/dtype.h"
 #include "chainerx/error.h"
+#include "chainerx/kernels/misc.h"
 #include "chainerx/macro.h"
 #include "chainerx/op_node.h"
 #include "chainerx/routines/creation.h"
+#include "chainerx/shape.h"
 
 namespace chainerx {
 namespace {
@@ -82,7 +86,7 @@ BackwardContext::BackwardContext(
     CHAINERX_ASSERT(input_grads_.size() == op_node->input_array_node_count());
 
     // Input grads must be initialized with null-body arrays.
-    const std::vector<size_t>& input_grad_indices = backward_entry.input_array_node_indices();
+    const internal::InputArrayNodeIndices& input_grad_indices = backward_entry.input_array_node_indices();
     CHAINERX_ASSERT(std::all_of(input_grad_indices.begin(), input_grad_indices.end(), [&](const size_t& index) {
         return internal::GetArrayBody(gsl::at(input_grads_, index)) == nullptr;
     }));
@@ -96,7 +100,7 @@ BackwardContext::BackwardContext(
 bool BackwardContext::HasOutputGrad(size_t output_index) const { return gsl::at(output_grads_, output_index)->get().has_value(); }
 
 bool BackwardContext::is_input_grad_required(size_t input_index) const {
-    const std::vector<size_t>& input_grad_indices = backward_entry_.input_array_node_indices();
+    const internal::InputArrayNodeIndices& input_grad_indices = backward_entry_.input_array_node_indices();
     CHAINERX_ASSERT(std::find(input_grad_indices.begin(), input_grad_indices.end(), input_index) != input_grad_indices.end());
 
     return op_node_->HasInputArrayNode(input_index);
@@ -111,7 +115,7 @@ const absl::optional<Array>& BackwardContext::output_grad(size_t output_index) c
 }
 
 Array& BackwardContext::input_grad() {
-    const std::vector<size_t>& input_grad_indices = backward_entry_.input_array_node_indices();
+    const internal::InputArrayNodeIndices& input_grad_indices = backward_entry_.input_array_node_indices();
     CHAINERX_ASSERT(input_grad_indices.size() == 1);
     return input_grad(input_grad_indices.front());
 }
@@ -157,6 +161,10 @@ Array BackwardContext::GetRetainedInput(const RetainedInputToken& token) {
         // Otherwise, create a new array body and put the nodes into it.
         std::shared_ptr<ArrayBody> array_body{};
         {
+            // Backward functions of different op nodes may run concurrently and retain the same input.
+            static std::mutex fabrication_mutex;
+            std::lock_guard<std::mutex> lock{fabrication_mutex};
+
             auto it = std::find_if(
                     input_array_nodes.begin(), input_array_nodes.end(), [](const std::shared_ptr<ArrayNode>* input_array_node_ptr) {
                         return *input_array_node_ptr != nullptr;
@@ -229,6 +237,16 @@ Array BackwardContext::GetRetainedOutput(const RetainedOutputToken& token) {
     return Array{kept_body};
 }
 
+Array BackwardContext::GetRetainedCompactArray(const RetainedCompactArrayToken& token) const {
+    const Array& data = token.data_;
+    if (token.dtype_ == Dtype::kBool) {
+        Array mask = Empty(Shape{token.shape_.GetTotalSize()}, Dtype::kBool, data.device());
+        data.device().backend().CallKernel<UnpackBitsKernel>(data, mask);
+        return mask.Reshape(token.shape_);
+    }
+    return data.AsType(token.dtype_, false);
+}
+
 std::shared_ptr<ArrayBody> BackwardContext::GetFabricatedArrayBodyWithNodes(const RetainedOutputToken& token) const {
     std::vector<std::shared_ptr<ArrayNode>> new_output_array_nodes;
 
@@ -123,6 +123,11 @@ public:
     // retains array nodes for other graphs.
     Array GetRetainedOutput(const RetainedOutputToken& token);
 
+    // Returns the array retained by BackwardBuilder::RetainMask() or BackwardBuilder::RetainAsType(), restored to its original shape and
+    // dtype.
+    // The resulting array is not connected to any graph.
+    Array GetRetainedCompactArray(const RetainedCompactArrayToken& token) const;
+
 private:
     std::shared_ptr<internal::ArrayBody> GetFabricatedArrayBodyWithNodes(const RetainedOutputToken& token) const;
 
@@ -7,4 +7,16 @@ enum class DoubleBackpropOption : bool {
     kEnable = true,
 };
 
+// Specifies how Backward and Grad process the op nodes of a graph.
+enum class BackwardExecutionMode {
+    // Op nodes are processed one at a time on the calling thread.
+    kSerial = 1,
+    // Op nodes whose output gradients are ready are processed concurrently by worker threads.
+    // Partial gradients are accumulated in the order kSerial would accumulate them, so that the results are bit-exact with kSerial.
+    kParallelDeterministic,
+    // Like kParallelDeterministic, but partial gradients are accumulated as soon as they are computed.
+    // Floating-point results may therefore differ between runs.
+    kParallel,
+};
+
 }  // namespace chainerx
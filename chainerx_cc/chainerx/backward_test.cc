@@ -1,6 +1,7 @@
 #include "chainerx/backward.h"
 
 #include <algorithm>
+#include <array>
 #include <map>
 #include <memory>
 #include <string>
@@ -20,6 +21,7 @@
 #include "chainerx/backward_context.h"
 #include "chainerx/check_backward.h"
 #include "chainerx/context.h"
+#include "chainerx/device.h"
 #include "chainerx/device_id.h"
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
@@ -28,10 +30,13 @@
 #include "chainerx/op_node.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/explog.h"
+#include "chainerx/routines/logic.h"
+#include "chainerx/routines/manipulation.h"
 #include "chainerx/shape.h"
 #include "chainerx/testing/array.h"
 #include "chainerx/testing/array_check.h"
 #include "chainerx/testing/device_session.h"
+#include "chainerx/testing/threading.h"
 
 namespace chainerx {
 namespace {
@@ -539,6 +544,134 @@ TEST_F(BackpropTest, BackwardInputToMultipleOps) {
     CheckBackpropSingleElementExtraInputs({2.0f}, {3.0f}, {7.0f}, [](auto& xs, auto& ys) { return xs[0] * (xs[0] + ys[0]); });
 }
 
+TEST_F(BackpropTest, GradReadyCallbackArrayUsedTwice) {
+    Array x = Full({1}, 2.0f).RequireGrad();
+    Array w = Full({1}, 3.0f).RequireGrad();
+    Array y = (x * w) * w;
+
+    std::vector<Array> w_grads;
+    auto callback = [&w, &w_grads](const Array& array, const Array& grad) {
+        if (internal::GetArrayBody(array) == internal::GetArrayBody(w)) {
+            w_grads.emplace_back(grad.Copy());
+        }
+    };
+    Backward(y, absl::nullopt, DoubleBackpropOption::kDisable, absl::nullopt, BackwardExecutionMode::kSerial, callback);
+
+    // The callback is called once, after both the contributions are accumulated.
+    ASSERT_EQ(1U, w_grads.size());
+    ExpectEqual<float>(Full({1}, 12.0f), w_grads[0]);
+}
+
+TEST_F(BackpropTest, GradReadyCallbackWithLossScale) {
+    Array x = Full({1}, 2.0f).RequireGrad();
+    Array y = x * x * 3;
+
+    std::vector<Array> grads;
+    auto callback = [&grads](const Array& /*array*/, const Array& grad) { grads.emplace_back(grad.Copy()); };
+    Backward(y, absl::nullopt, DoubleBackpropOption::kDisable, 10.0f, BackwardExecutionMode::kSerial, callback);
+
+    // The gradient is scaled back before the callback is called, and only once.
+    ASSERT_EQ(1U, grads.size());
+    ExpectEqual<float>(Full({1}, 12.0f), grads[0]);
+    ExpectEqual<float>(Full({1}, 12.0f), *x.GetGrad());
+}
+
+TEST_F(BackpropTest, LossScaleFoundNonFiniteGrads) {
+    Array x1 = Full({2}, 2.0f).RequireGrad();
+    Array x2 = Full({2}, 3.0f).RequireGrad();
+    Array y = x1 * x2 * 1e30f;
+
+    // The scaled gradient of x2 overflows while that of x1 does not.
+    BackwardStats stats = Backward(y, absl::nullopt, DoubleBackpropOption::kDisable, 1e9f);
+    EXPECT_TRUE(stats.found_non_finite_grads);
+    EXPECT_FALSE(static_cast<bool>(AsScalar(All(IsFinite(*x2.GetGrad())))));
+
+    x1.ClearGrad();
+    x2.ClearGrad();
+    Array z = x1 * x2;
+    stats = Backward(z, absl::nullopt, DoubleBackpropOption::kDisable, 1e9f);
+    EXPECT_FALSE(stats.found_non_finite_grads);
+    ExpectEqual<float>(Full({2}, 3.0f), *x1.GetGrad());
+    ExpectEqual<float>(Full({2}, 2.0f), *x2.GetGrad());
+}
+
+TEST_F(BackpropTest, LossScaleSharedGrad) {
+    Array x = Full({2}, 2.0f).RequireGrad();
+    Array y = x + 0.0f;
+
+    // The backward of the addition passes the gradient of y, which is the scaled initial gradient, through as the gradient of x. The
+    // gradient of x must be scaled back without modifying that of y.
+    y.RequireGrad();
+    Backward(y, absl::nullopt, DoubleBackpropOption::kDisable, 4.0f);
+    ExpectEqual<float>(Full({2}, 1.0f), *x.GetGrad());
+    ExpectEqual<float>(Full({2}, 4.0f), *y.GetGrad());
+}
+
+TEST_F(BackpropTest, LossScaleFloat16Grad) {
+    // 2^-25, the inverse of the loss scale, is not representable in float16.
+    constexpr float kLossScale = 33554432.0f;
+    constexpr float kCoeff = 1.0f / 16384.0f;
+    Array x = Full({2}, 1.0f, Dtype::kFloat16).RequireGrad();
+    Array y = x.AsType(Dtype::kFloat32) * kCoeff;
+
+    // The scaled gradient of x, 2^11, is cast to float16 in the backward of AsType.
+    BackwardStats stats = Backward(y, absl::nullopt, DoubleBackpropOption::kDisable, kLossScale);
+    EXPECT_FALSE(stats.found_non_finite_grads);
+    EXPECT_ARRAY_EQ(Full({2}, kCoeff, Dtype::kFloat16), *x.GetGrad());
+}
+
+TEST_F(BackpropTest, GradWithDifferentInputsOnSameGraph) {
+    Array x1 = Full({1}, 2.0f).RequireGrad();
+    Array x2 = Full({1}, 3.0f).RequireGrad();
+    Array x3 = Full({1}, 5.0f).RequireGrad();
+    Array y = x1 * x2 + x2 * x3;
+
+    // Each call extracts its own subgraph from the graph kept alive by double backprop.
+    std::vector<absl::optional<Array>> gx1 = Grad({y}, {x1}, absl::nullopt, DoubleBackpropOption::kEnable);
+    ASSERT_TRUE(gx1[0].has_value());
+    ExpectEqual<float>(Full({1}, 3.0f), *gx1[0]);
+
+    std::vector<absl::optional<Array>> gx3 = Grad({y}, {x3}, absl::nullopt, DoubleBackpropOption::kEnable);
+    ASSERT_TRUE(gx3[0].has_value());
+    ExpectEqual<float>(Full({1}, 3.0f), *gx3[0]);
+
+    std::vector<absl::optional<Array>> gx2 = Grad({y}, {x2, x3}, absl::nullopt, DoubleBackpropOption::kEnable);
+    ASSERT_TRUE(gx2[0].has_value());
+    ASSERT_TRUE(gx2[1].has_value());
+    ExpectEqual<float>(Full({1}, 7.0f), *gx2[0]);
+    ExpectEqual<float>(Full({1}, 3.0f), *gx2[1]);
+
+    EXPECT_FALSE(x1.GetGrad().has_value());
+    EXPECT_FALSE(x2.GetGrad().has_value());
+    EXPECT_FALSE(x3.GetGrad().has_value());
+}
+
+TEST_F(BackpropTest, GradWithSharedInputThreadSafe) {
+    static constexpr size_t kThreadCount = 16;
+    static constexpr int kIterationCount = 64;
+    Context& ctx = context();
+    Device& device = GetDefaultDevice();
+    Array w = Full({4}, 2.0f).RequireGrad();
+
+    // Each thread extracts subgraphs of its own graphs, which share the input. The input is consumed by the last op node of each graph.
+    testing::RunThreads(kThreadCount, [&ctx, &device, &w](size_t thread_index) {
+        ContextScope context_scope{ctx};
+        DeviceScope device_scope{device};
+        for (int i = 0; i < kIterationCount; ++i) {
+            Array x = Full({4}, static_cast<float>(thread_index * kIterationCount + i)).RequireGrad();
+            Array h = x;
+            for (int j = 0; j < 1024; ++j) {
+                h = h + x;
+            }
+            Array y = w * h;
+            std::vector<absl::optional<Array>> gw = Grad({y}, {w});
+            ASSERT_TRUE(gw[0].has_value());
+            EXPECT_ARRAY_EQ(h.AsGradStopped(), *gw[0]);
+        }
+    });
+    EXPECT_FALSE(w.GetGrad().has_value());
+}
+
 TEST_F(BackpropTest, BackwardIdenticalInputs) {
     CheckBackpropSingleElement({2.0f}, {2.0f}, [](auto& xs) { return xs[0] + xs[0]; });
     CheckBackpropSingleElement({3.0f}, {6.0f}, [](auto& xs) { return xs[0] * xs[0]; });
@@ -569,6 +702,114 @@ TEST_F(BackpropTest, BackwardGivenOutputGrad) {
     CheckBackpropSingleElementExtraInputs({2.0f}, {3.0f}, {6.0f}, fprop);
 }
 
+TEST_F(BackpropTest, BackwardAccumulatesIntoUniquelyOwnedGradInPlace) {
+    Array x = Full({3}, 2.0f).RequireGrad();
+    x.ZeroGrad();
+    const void* grad_data = x.GetGrad()->data().get();
+
+    for (int i = 0; i < 3; ++i) {
+        Array y = x * x + x * 3;
+        Backward(y);
+    }
+
+    // Gradients of all the backward calls, as well as the two partial gradients within each of them, are summed in the same buffer.
+    EXPECT_EQ(grad_data, x.GetGrad()->data().get());
+    EXPECT_ARRAY_EQ(Full({3}, 21.0f), *x.GetGrad());
+}
+
+TEST_F(BackpropTest, BackwardDoesNotModifySharedGrad) {
+    Array x = Full({3}, 2.0f).RequireGrad();
+    Array gx = Full({3}, 1.0f);
+    x.SetGrad(gx);
+
+    Array y = x * 3;
+    Backward(y);
+
+    EXPECT_ARRAY_EQ(Full({3}, 1.0f), gx);
+    EXPECT_ARRAY_EQ(Full({3}, 4.0f), *x.GetGrad());
+}
+
+TEST_F(BackpropTest, BackwardDoesNotModifyForeignGrad) {
+    Array x = Full({3}, 2.0f).RequireGrad();
+    std::array<float, 3> buffer{1, 1, 1};
+    x.SetGrad(FromData({3}, Dtype::kFloat32, std::shared_ptr<void>{buffer.data(), [](void* /*ptr*/) {}}));
+
+    Array y = x * 3;
+    Backward(y);
+
+    EXPECT_EQ((std::array<float, 3>{1, 1, 1}), buffer);
+    EXPECT_ARRAY_EQ(Full({3}, 4.0f), *x.GetGrad());
+}
+
+TEST_F(BackpropTest, BackwardDoesNotModifyGradInPlaceWithDoubleBackprop) {
+    Array x = Full({1}, 2.0f).RequireGrad();
+    Array y = x * x + x * 3;
+    Backward(y, absl::nullopt, DoubleBackpropOption::kEnable);
+
+    // The accumulated gradient is recorded to the graph.
+    Array gx = *x.GetGrad();
+    EXPECT_ARRAY_EQ(Full({1}, 7.0f), gx);
+    x.ClearGrad();
+    Backward(gx);
+    EXPECT_ARRAY_EQ(Full({1}, 2.0f), *x.GetGrad());
+}
+
+TEST_F(BackpropTest, BackwardReleasesRetainedArraysBeforeCreators) {
+    std::weak_ptr<void> retained_data{};
+    bool retained_data_released = false;
+
+    Array x = Full({2}, 3.0f).RequireGrad();
+    Array z{};
+    {
+        Array y = x.AsGradStopped() * 2;
+        {
+            BackwardBuilder bb{"first", x, y};
+            bb.CreateTarget(0).Define([&retained_data, &retained_data_released](BackwardContext& bctx) {
+                // The second op node has been processed, so the input it retained must have been freed.
+                retained_data_released = retained_data.expired();
+                bctx.input_grad() = *bctx.output_grad() * 2;
+            });
+            bb.Finalize();
+        }
+
+        z = y.AsGradStopped() * y.AsGradStopped();
+        {
+            BackwardBuilder bb{"second", y, z};
+            bb.CreateTarget(0).Define([y_tok = bb.RetainInput(0)](BackwardContext& bctx) {
+                bctx.input_grad() = *bctx.output_grad() * 2 * bctx.GetRetainedInput(y_tok);
+            });
+            bb.Finalize();
+        }
+        retained_data = y.data();
+    }
+    ASSERT_FALSE(retained_data.expired());
+
+    Backward(z);
+
+    EXPECT_TRUE(retained_data_released);
+    EXPECT_ARRAY_EQ(Full({2}, 24.0f), *x.GetGrad());
+}
+
+TEST_F(BackpropTest, BackwardReleasesGradientsOfIntermediateArrays) {
+    constexpr int kDepth = 20;
+    Device& device = GetDefaultDevice();
+    Array x = Full({1000}, 1.0f).RequireGrad();
+    Array y = x;
+    for (int i = 0; i < kDepth; ++i) {
+        // The intermediate arrays are gone once they are overwritten, leaving the gradients of their array nodes to the backward engine.
+        y = y * 2;
+    }
+    size_t allocated_bytes = device.allocated_bytes();
+
+    BackwardStats stats = Backward(y);
+
+    // The gradient of each intermediate array node is released once it has been propagated, so that only a few gradients are held at a
+    // time rather than one per op.
+    EXPECT_LE(allocated_bytes, stats.peak_allocated_bytes);
+    EXPECT_GT(allocated_bytes + 5 * x.GetNBytes(), stats.peak_allocated_bytes);
+    EXPECT_ARRAY_EQ(Full({1000}, static_cast<float>(1 << kDepth)), *x.GetGrad());
+}
+
 TEST_F(BackpropTest, MultipleGraphsBasic) {
     Array x1 = Full({1}, 2.0f);
     Array x2 = Full({1}, 5.0f);
@@ -1387,6 +1628,146 @@ TEST_F(BackpropTest, GradDoubleBackwardWithBackward) {
     EXPECT_ARRAY_EQ(Full({1}, 38.0f), *x2.GetGrad(backprop_id_1));  // (Initial 6) + 24 + 8
 }
 
+// Builds a graph with many independent branches that share the inputs and returns the output.
+Array ForwardBranchingGraph(const Array& x1, const Array& x2) {
+    Array y = x1 * x2;
+    for (int i = 1; i <= 16; ++i) {
+        Array h = Exp(x1 * (0.1 * i)) * x2 + x1 / (x2 + i);
+        y = y + h * h;
+    }
+    return y.Sum();
+}
+
+class BackwardExecutionModeTest : public ::testing::TestWithParam<BackwardExecutionMode> {
+protected:
+    void SetUp() override { device_session_.emplace(DeviceId{native::NativeBackend::kDefaultName, 0}); }
+
+    void TearDown() override { device_session_.reset(); }
+
+    Array MakeInput(float offset) const { return (Arange(0, 1, 0.01, Dtype::kFloat32) + offset).RequireGrad(); }
+
+    void CheckGrads(const std::vector<Array>& expected_grads, const std::vector<Array>& actual_grads) const {
+        ASSERT_EQ(expected_grads.size(), actual_grads.size());
+        for (size_t i = 0; i < expected_grads.size(); ++i) {
+            if (GetParam() == BackwardExecutionMode::kParallel) {
+                // The order of accumulation is not specified.
+                EXPECT_ARRAY_ALL_CLOSE(expected_grads[i], actual_grads[i], 1e-5, 1e-6);
+            } else {
+                EXPECT_ARRAY_EQ(expected_grads[i], actual_grads[i]);
+            }
+        }
+    }
+
+private:
+    absl::optional<testing::DeviceSession> device_session_;
+};
+
+TEST_P(BackwardExecutionModeTest, Backward) {
+    Array x1 = MakeInput(0.5f);
+    Array x2 = MakeInput(1.5f);
+    Backward(ForwardBranchingGraph(x1, x2));
+
+    Array x1_actual = MakeInput(0.5f);
+    Array x2_actual = MakeInput(1.5f);
+    Backward(ForwardBranchingGraph(x1_actual, x2_actual), absl::nullopt, DoubleBackpropOption::kDisable, absl::nullopt, GetParam());
+
+    CheckGrads({*x1.GetGrad(), *x2.GetGrad()}, {*x1_actual.GetGrad(), *x2_actual.GetGrad()});
+}
+
+TEST_P(BackwardExecutionModeTest, BackwardMultipleOutputs) {
+    Array x1 = MakeInput(0.5f);
+    Array x2 = MakeInput(1.5f);
+    Array y1 = ForwardBranchingGraph(x1, x2);
+    Array y2 = (x1 * x2).Sum();
+    Backward({y1, y2});
+
+    Array x1_actual = MakeInput(0.5f);
+    Array x2_actual = MakeInput(1.5f);
+    Array y1_actual = ForwardBranchingGraph(x1_actual, x2_actual);
+    Array y2_actual = (x1_actual * x2_actual).Sum();
+    Backward({y1_actual, y2_actual}, absl::nullopt, DoubleBackpropOption::kDisable, absl::nullopt, GetParam());
+
+    CheckGrads({*x1.GetGrad(), *x2.GetGrad()}, {*x1_actual.GetGrad(), *x2_actual.GetGrad()});
+}
+
+TEST_P(BackwardExecutionModeTest, Grad) {
+    Array x1 = MakeInput(0.5f);
+    Array x2 = MakeInput(1.5f);
+    Array y = ForwardBranchingGraph(x1, x2);
+    Array y_actual = ForwardBranchingGraph(x1, x2);
+
+    std::vector<absl::optional<Array>> expected_grads = Grad({y}, {x2});
+    std::vector<absl::optional<Array>> actual_grads =
+            Grad({y_actual}, {x2}, absl::nullopt, DoubleBackpropOption::kDisable, false, false, {}, absl::nullopt, GetParam());
+
+    ASSERT_EQ(1U, actual_grads.size());
+    ASSERT_TRUE(actual_grads[0].has_value());
+    CheckGrads({*expected_grads[0]}, {*actual_grads[0]});
+    EXPECT_FALSE(x1.GetGrad().has_value());
+    EXPECT_FALSE(x2.GetGrad().has_value());
+}
+
+TEST_P(BackwardExecutionModeTest, DoubleBackprop) {
+    // Double backprop is run serially regardless of the execution mode.
+    Array x1 = MakeInput(0.5f);
+    Array x2 = MakeInput(1.5f);
+    Backward(ForwardBranchingGraph(x1, x2), absl::nullopt, DoubleBackpropOption::kEnable);
+
+    Array x1_actual = MakeInput(0.5f);
+    Array x2_actual = MakeInput(1.5f);
+    Backward(ForwardBranchingGraph(x1_actual, x2_actual), absl::nullopt, DoubleBackpropOption::kEnable, absl::nullopt, GetParam());
+
+    EXPECT_ARRAY_EQ(*x1.GetGrad(), *x1_actual.GetGrad());
+    EXPECT_ARRAY_EQ(*x2.GetGrad(), *x2_actual.GetGrad());
+}
+
+TEST_P(BackwardExecutionModeTest, BackwardFunctionThrows) {
+    Array x1 = MakeInput(0.5f);
+    Array x2 = MakeInput(1.5f);
+    Array y = x1.AsGradStopped() * 2;
+    {
+        BackwardBuilder bb{"func", x1, y};
+        bb.CreateTarget(0).Define([](BackwardContext& /*bctx*/) { throw ChainerxError{"error in backward"}; });
+        bb.Finalize();
+    }
+    Array z = ForwardBranchingGraph(y, x2);
+
+    EXPECT_THROW(Backward(z, absl::nullopt, DoubleBackpropOption::kDisable, absl::nullopt, GetParam()), ChainerxError);
+}
+
+TEST_P(BackwardExecutionModeTest, GradReadyCallback) {
+    Array x1 = MakeInput(0.5f);
+    Array x2 = MakeInput(1.5f);
+    Array w = MakeInput(2.5f);
+    Array z = (ForwardBranchingGraph(x1, x2) * w).Sum();
+
+    std::vector<std::pair<Array, Array>> ready_grads;
+    auto callback = [&x1, &w, &ready_grads](const Array& array, const Array& grad) {
+        if (internal::GetArrayBody(array) == internal::GetArrayBody(w)) {
+            // The gradient of w is final before any gradient is propagated to x1.
+            EXPECT_FALSE(x1.GetGrad().has_value());
+        }
+        ready_grads.emplace_back(array, grad.Copy());
+    };
+    Backward(z, absl::nullopt, DoubleBackpropOption::kDisable, absl::nullopt, GetParam(), callback);
+
+    ASSERT_EQ(3U, ready_grads.size());
+    for (const Array& array : {x1, x2, w}) {
+        auto it = std::find_if(ready_grads.begin(), ready_grads.end(), [&array](const std::pair<Array, Array>& ready_grad) {
+            return internal::GetArrayBody(ready_grad.first) == internal::GetArrayBody(array);
+        });
+        ASSERT_NE(ready_grads.end(), it);
+        EXPECT_ARRAY_EQ(*array.GetGrad(), it->second);
+    }
+    EXPECT_EQ(internal::GetArrayBody(w), internal::GetArrayBody(ready_grads.front().first));
+}
+
+INSTANTIATE_TEST_CASE_P(
+        Params,
+        BackwardExecutionModeTest,
+        ::testing::Values(
+                BackwardExecutionMode::kSerial, BackwardExecutionMode::kParallelDeterministic, BackwardExecutionMode::kParallel));
+
 class BackpropFunctionTest : public ::testing::TestWithParam<DoubleBackpropOption> {};
 
 TEST_P(BackpropFunctionTest, OneToOneFunc) {
@@ -0,0 +1,103 @@
+#include "chainerx/checkpoint.h"
+
+#include <cstddef>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <absl/types/optional.h>
+
+#include "chainerx/array.h"
+#include "chainerx/backprop_mode.h"
+#include "chainerx/backprop_scope.h"
+#include "chainerx/backward.h"
+#include "chainerx/backward_builder.h"
+#include "chainerx/backward_context.h"
+#include "chainerx/context.h"
+#include "chainerx/error.h"
+#include "chainerx/graph.h"
+
+namespace chainerx {
+
+std::vector<Array> Checkpoint(const CheckpointFunction& func, const std::vector<ConstArrayRef>& inputs) {
+    std::vector<Array> outputs{};
+    {
+        NoBackpropModeScope scope{inputs.empty() ? GetDefaultContext() : inputs.front().get().context()};
+        outputs = func(std::vector<Array>{inputs.begin(), inputs.end()});
+
+        // The outputs may be the inputs themselves or arrays which belong to graphs outside of the segment.
+        for (Array& output : outputs) {
+            output = output.AsGradStopped();
+        }
+    }
+    if (inputs.empty() || outputs.empty()) {
+        return outputs;
+    }
+
+    BackwardBuilder bb{"checkpoint", inputs, std::vector<ConstArrayRef>{outputs.begin(), outputs.end()}};
+    if (BackwardBuilder::Target bt = bb.CreateTarget()) {
+        std::vector<size_t> input_indices(inputs.size());
+        std::iota(input_indices.begin(), input_indices.end(), size_t{0});
+        bt.Define([func, input_toks = bb.RetainInput(std::move(input_indices))](BackwardContext& bctx) {
+            // Rebuild the graph of the segment from the retained inputs.
+            // The retained inputs keep the array nodes of the outer graphs, as well as the current graph if double backprop is enabled, so
+            // that the recomputation and the gradients are recorded in these graphs as with any other backward function.
+            BackpropScope backprop_scope{"checkpoint", bctx.GetRetainedInput(input_toks.front()).context()};
+            BackpropId backprop_id = backprop_scope.backprop_id();
+            // The graph must be recorded even if backprop is disabled for all graphs by an enclosing scope.
+            ForceBackpropModeScope backprop_mode_scope{backprop_id};
+
+            std::vector<Array> xs;
+            std::vector<ConstArrayRef> target_xs;
+            std::vector<size_t> target_input_indices;
+            xs.reserve(input_toks.size());
+            for (size_t i = 0; i < input_toks.size(); ++i) {
+                // Retained inputs are views with their own bodies, so that the array nodes of the recomputation graph, which is discarded
+                // with its backprop ID, are not added to the bodies of the inputs, e.g. parameters which outlive the backprop.
+                xs.emplace_back(bctx.GetRetainedInput(input_toks[i]));
+                if (bctx.is_input_grad_required(i)) {
+                    xs.back().RequireGrad(backprop_id);
+                    target_input_indices.emplace_back(i);
+                }
+            }
+            for (size_t i : target_input_indices) {
+                target_xs.emplace_back(xs[i]);
+            }
+
+            std::vector<Array> ys = func(xs);
+            if (ys.size() != bctx.output_count()) {
+                throw ChainerxError{
+                        "Checkpointed computation returned ",
+                        ys.size(),
+                        " outputs on recomputation while ",
+                        bctx.output_count(),
+                        " were expected."};
+            }
+
+            std::vector<ConstArrayRef> target_ys;
+            std::vector<ConstArrayRef> gys;
+            for (size_t i = 0; i < ys.size(); ++i) {
+                if (bctx.HasOutputGrad(i) && ys[i].IsBackpropRequired(backprop_id)) {
+                    target_ys.emplace_back(ys[i]);
+                    gys.emplace_back(*bctx.output_grad(i));
+                }
+            }
+            if (target_ys.empty()) {
+                return;
+            }
+
+            std::vector<absl::optional<Array>> gxs =
+                    Grad(target_ys, target_xs, backprop_id, DoubleBackpropOption::kDisable, false, false, gys);
+            for (size_t k = 0; k < target_input_indices.size(); ++k) {
+                if (gxs[k].has_value()) {
+                    bctx.input_grad(target_input_indices[k]) = std::move(*gxs[k]);
+                }
+            }
+        });
+    }
+    bb.Finalize();
+
+    return outputs;
+}
+
+}  // namespace chainerx
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "chainerx/array.h"
+
+namespace chainerx {
+
+// A segment of a computation to be checkpointed, which computes output arrays from input arrays.
+using CheckpointFunction = std::function<std::vector<Array>(const std::vector<Array>&)>;
+
+// Computes the outputs of a segment without keeping its intermediate arrays for backprop, a.k.a. gradient checkpointing.
+//
+// The segment is run with backprop disabled, and a single op node is recorded in its place which retains only the input arrays. Its
+// backward function runs the segment again under a new backprop ID to rebuild the graph of the segment, and backpropagates the output
+// gradients through it. This trades an extra forward computation of the segment for the memory of its intermediate arrays.
+//
+// `func` must compute the same outputs from the same inputs every time it is called. Arrays that it uses other than `inputs`, e.g.
+// captured parameters, are treated as constants; pass them as inputs to compute their gradients.
+std::vector<Array> Checkpoint(const CheckpointFunction& func, const std::vector<ConstArrayRef>& inputs);
+
+}  // namespace chainerx
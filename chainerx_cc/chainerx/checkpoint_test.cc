@@ -0,0 +1,143 @@
+#include "chainerx/checkpoint.h"
+
+#include <cstddef>
+#include <vector>
+
+#include <absl/types/optional.h>
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/array_body.h"
+#include "chainerx/backward.h"
+#include "chainerx/check_backward.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dtype.h"
+#include "chainerx/graph.h"
+#include "chainerx/native/native_backend.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/explog.h"
+#include "chainerx/routines/reduction.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace {
+
+class CheckpointTest : public ::testing::Test {
+protected:
+    void SetUp() override { device_session_.emplace(DeviceId{native::NativeBackend::kDefaultName, 0}); }
+
+    void TearDown() override { device_session_.reset(); }
+
+private:
+    absl::optional<testing::DeviceSession> device_session_;
+};
+
+std::vector<Array> Segment(const std::vector<Array>& xs) { return {Exp(xs[0]) * xs[1], Sum(xs[0] * xs[0])}; }
+
+TEST_F(CheckpointTest, Forward) {
+    Array x0 = (*testing::BuildArray({2, 3}).WithLinearData<double>(-1.0, 0.25)).RequireGrad();
+    Array x1 = testing::BuildArray({2, 3}).WithLinearData<double>(0.5, 0.5);
+
+    std::vector<Array> expected = Segment({x0, x1});
+    std::vector<Array> ys = Checkpoint(Segment, {x0, x1});
+
+    ASSERT_EQ(expected.size(), ys.size());
+    for (size_t i = 0; i < ys.size(); ++i) {
+        EXPECT_ARRAY_EQ(expected[i], ys[i]);
+        EXPECT_TRUE(ys[i].IsBackpropRequired());
+    }
+}
+
+TEST_F(CheckpointTest, RecomputeInBackward) {
+    int call_count = 0;
+    auto func = [&call_count](const std::vector<Array>& xs) -> std::vector<Array> {
+        ++call_count;
+        return Segment(xs);
+    };
+
+    Array x0 = (*testing::BuildArray({2, 3}).WithLinearData<double>(-1.0, 0.25)).RequireGrad();
+    Array x1 = (*testing::BuildArray({2, 3}).WithLinearData<double>(0.5, 0.5)).RequireGrad();
+    Array x0_expected = x0.AsGradStopped(CopyKind::kCopy).RequireGrad();
+    Array x1_expected = x1.AsGradStopped(CopyKind::kCopy).RequireGrad();
+
+    std::vector<Array> ys = Checkpoint(func, {x0, x1});
+    EXPECT_EQ(1, call_count);
+    Backward(Sum(ys[0]) + ys[1]);
+    EXPECT_EQ(2, call_count);
+
+    std::vector<Array> expected_ys = Segment({x0_expected, x1_expected});
+    Backward(Sum(expected_ys[0]) + expected_ys[1]);
+    EXPECT_ARRAY_ALL_CLOSE(*x0_expected.GetGrad(), *x0.GetGrad(), 1e-12, 1e-12);
+    EXPECT_ARRAY_ALL_CLOSE(*x1_expected.GetGrad(), *x1.GetGrad(), 1e-12, 1e-12);
+}
+
+TEST_F(CheckpointTest, Backward) {
+    Array x0 = (*testing::BuildArray({2, 3}).WithLinearData<double>(-1.0, 0.25)).RequireGrad();
+    Array x1 = (*testing::BuildArray({2, 3}).WithLinearData<double>(0.5, 0.5)).RequireGrad();
+    Array go0 = testing::BuildArray({2, 3}).WithLinearData<double>(-0.3, 0.1);
+    Array go1 = testing::BuildArray({}).WithData<double>({0.7});
+    Array eps = Full({2, 3}, 1e-3, Dtype::kFloat64);
+
+    CheckBackward(
+            [](const std::vector<Array>& xs) { return Checkpoint(Segment, {xs[0], xs[1]}); },
+            {x0, x1},
+            {go0, go1},
+            {eps, eps},
+            2,
+            1e-6,
+            1e-5);
+}
+
+TEST_F(CheckpointTest, BackwardPartialOutputsAndInputs) {
+    Array x0 = (*testing::BuildArray({2, 3}).WithLinearData<double>(-1.0, 0.25)).RequireGrad();
+    Array x1 = testing::BuildArray({2, 3}).WithLinearData<double>(0.5, 0.5);
+
+    // Only the second output, which does not depend on x1, is backpropagated.
+    std::vector<Array> ys = Checkpoint(Segment, {x0, x1});
+    Backward(ys[1]);
+
+    EXPECT_ARRAY_ALL_CLOSE(2 * x0, *x0.GetGrad(), 1e-12, 1e-12);
+    EXPECT_THROW(x1.GetGrad(), ChainerxError);
+}
+
+TEST_F(CheckpointTest, RepeatedBackwardDoesNotAddArrayNodesToInputs) {
+    Array x0 = (*testing::BuildArray({2, 3}).WithLinearData<double>(-1.0, 0.25)).RequireGrad();
+    Array x1 = (*testing::BuildArray({2, 3}).WithLinearData<double>(0.5, 0.5)).RequireGrad();
+    size_t x0_node_count = internal::GetArrayBody(x0)->nodes().size();
+    size_t x1_node_count = internal::GetArrayBody(x1)->nodes().size();
+
+    for (int i = 0; i < 3; ++i) {
+        std::vector<Array> ys = Checkpoint(Segment, {x0, x1});
+        Backward(Sum(ys[0]) + ys[1]);
+        EXPECT_EQ(x0_node_count, internal::GetArrayBody(x0)->nodes().size());
+        EXPECT_EQ(x1_node_count, internal::GetArrayBody(x1)->nodes().size());
+    }
+}
+
+TEST_F(CheckpointTest, DoubleBackward) {
+    Array x0 = (*testing::BuildArray({2, 3}).WithLinearData<double>(-1.0, 0.25)).RequireGrad();
+    Array x1 = (*testing::BuildArray({2, 3}).WithLinearData<double>(0.5, 0.5)).RequireGrad();
+    Array go0 = (*testing::BuildArray({2, 3}).WithLinearData<double>(-0.3, 0.1)).RequireGrad();
+    Array go1 = (*testing::BuildArray({}).WithData<double>({0.7})).RequireGrad();
+    Array ggi0 = testing::BuildArray({2, 3}).WithLinearData<double>(0.2, -0.1);
+    Array ggi1 = testing::BuildArray({2, 3}).WithLinearData<double>(-0.1, 0.05);
+    Array eps = Full({2, 3}, 1e-3, Dtype::kFloat64);
+    Array eps_go1 = Full({}, 1e-3, Dtype::kFloat64);
+
+    // Checked on a single thread, since a backprop ID created for recomputation on a thread is prohibited once another thread finishes
+    // backprop of the default graph.
+    CheckDoubleBackwardComputation(
+            [](const std::vector<Array>& xs) { return Checkpoint(Segment, {xs[0], xs[1]}); },
+            {x0, x1},
+            {go0, go1},
+            {ggi0, ggi1},
+            {eps, eps, eps, eps_go1},
+            1,
+            1e-6,
+            1e-5);
+}
+
+}  // namespace
+}  // namespace chainerx
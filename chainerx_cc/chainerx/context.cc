@@ -2,8 +2,12 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <tuple>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -37,10 +41,24 @@ std::string GetChainerxPath() {
 
 }  // namespace
 
+constexpr const char* Context::kKernelPluginsEnvVarName;
+constexpr BackpropOrdinal Context::kDefaultBackpropOrdinal;
+
 Context::Context() {
     // Register the default backprop ID
     static constexpr const char* kDefaultBackpropName = "<default>";
     MakeBackpropId(kDefaultBackpropName);
+
+    if (absl::optional<std::string> plugin_paths = GetEnv(kKernelPluginsEnvVarName)) {
+        size_t begin = 0;
+        while (begin <= plugin_paths->size()) {
+            size_t end = std::min(plugin_paths->find(':', begin), plugin_paths->size());
+            if (end > begin) {
+                LoadKernelPlugin(plugin_paths->substr(begin, end - begin));
+            }
+            begin = end + 1;
+        }
+    }
 }
 
 Context::~Context() {
@@ -119,17 +137,60 @@ Device& Context::GetDevice(const DeviceId& device_id) {
     return backend.GetDevice(device_id.index());
 }
 
+void Context::LoadKernelPlugin(const std::string& plugin_path) {
+    void* handle{nullptr};
+    try {
+        handle = DlOpen(plugin_path);
+    } catch (const ChainerxError&) {
+        throw ContextError{"Kernel plugin not found: '", plugin_path, "'"};
+    }
+
+    std::lock_guard<std::mutex> lock{mutex_};
+    dlopen_handles_.push_back(handle);
+
+    void* ptr_register_kernels{nullptr};
+    try {
+        ptr_register_kernels = DlSym(handle, "RegisterKernels");
+    } catch (const ChainerxError&) {
+    }
+    if (ptr_register_kernels == nullptr) {
+        throw ContextError{"Invalid kernel plugin: RegisterKernels is not found in '", plugin_path, "'."};
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto register_kernels = reinterpret_cast<void (*)(Backend&)>(ptr_register_kernels);
+    kernel_plugins_.emplace_back(KernelPlugin{plugin_path, register_kernels});
+    for (const auto& pair : backends_) {
+        ApplyKernelPlugin(kernel_plugins_.back(), pair.first, *pair.second);
+    }
+}
+
+std::vector<KernelOverride> Context::GetKernelOverrides() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return kernel_overrides_;
+}
+
+void Context::ApplyKernelPlugin(const KernelPlugin& plugin, const std::string& backend_name, Backend& backend) {
+    std::vector<std::string> names = backend.kernel_registry().GetKernelNames();
+    std::unordered_set<std::string> registered_names{names.begin(), names.end()};
+    plugin.register_kernels(backend);
+    for (std::string& name : backend.kernel_registry().GetKernelNames()) {
+        if (registered_names.count(name) == 0) {
+            kernel_overrides_.emplace_back(KernelOverride{plugin.path, backend_name, std::move(name)});
+        }
+    }
+}
+
 BackpropId Context::MakeBackpropId(std::string backprop_name) {
     // Create new backprop ID
-    std::lock_guard<std::mutex> lock{mutex_};
-    backprop_set_.emplace_back(next_backprop_ordinal_, std::move(backprop_name));
+    std::lock_guard<std::shared_timed_mutex> lock{backprop_mutex_};
+    backprop_set_.emplace(next_backprop_ordinal_, BackpropSetItem{std::move(backprop_name)});
     return BackpropId{*this, next_backprop_ordinal_++};
 }
 
 void Context::ReleaseBackpropId(const BackpropId& backprop_id) {
     CheckValidBackpropId(backprop_id);
 
-    if (backprop_id.ordinal() == 0) {
+    if (backprop_id.ordinal() == kDefaultBackpropOrdinal) {
         throw ChainerxError{"The default backprop ID cannot be released."};
     }
 
@@ -137,35 +198,36 @@ void Context::ReleaseBackpropId(const BackpropId& backprop_id) {
 }
 
 void Context::ReleaseBackpropIdNoExcept(const BackpropId& backprop_id) noexcept {
-    std::lock_guard<std::mutex> lock{mutex_};
+    std::lock_guard<std::shared_timed_mutex> lock{backprop_mutex_};
     BackpropSetItem* item = GetBackpropSetItem(backprop_id.ordinal());
     if (item == nullptr) {
         return;
     }
 
-    // Remove the connection pairs involving the backprop ID
-    backprop_connections_.erase(
-            std::remove_if(
-                    backprop_connections_.begin(),
-                    backprop_connections_.end(),
-                    [ordinal = backprop_id.ordinal()](const std::pair<BackpropOrdinal, BackpropOrdinal>& pair) {
-                        return pair.first == ordinal || pair.second == ordinal;
-                    }),
-            backprop_connections_.end());
+    // Remove the connections involving the backprop ID
+    auto disconnect = [ordinal = backprop_id.ordinal()](std::vector<BackpropOrdinal>& ordinals) {
+        ordinals.erase(std::remove(ordinals.begin(), ordinals.end(), ordinal), ordinals.end());
+    };
+    for (BackpropOrdinal inner_ordinal : item->inner_ordinals) {
+        disconnect(GetBackpropSetItem(inner_ordinal)->outer_ordinals);
+    }
+    for (BackpropOrdinal outer_ordinal : item->outer_ordinals) {
+        disconnect(GetBackpropSetItem(outer_ordinal)->inner_ordinals);
+    }
 
     // Remove the backprop ID.
-    backprop_set_.erase(
-            std::find_if(backprop_set_.begin(), backprop_set_.end(), [ordinal = backprop_id.ordinal()](const BackpropSetItem& item) {
-                return item.ordinal == ordinal;
-            }));
+    backprop_set_.erase(backprop_id.ordinal());
 }
 
 void Context::CheckValidBackpropId(const BackpropId& backprop_id) const {
     if (&backprop_id.context() != this) {
         throw ChainerxError{"Invalid context in backprop ID: ", backprop_id};
     }
+    if (backprop_id.ordinal() == kDefaultBackpropOrdinal) {
+        return;
+    }
 
-    std::lock_guard<std::mutex> lock{mutex_};
+    std::shared_lock<std::shared_timed_mutex> lock{backprop_mutex_};
     if (GetBackpropSetItem(backprop_id.ordinal()) == nullptr) {
         throw ChainerxError{"Invalid backprop ID, maybe already expired: ", ToBackpropIdString(backprop_id.ordinal())};
     }
@@ -179,35 +241,47 @@ void Context::ConnectBackpropIds(const BackpropId& backprop_id1, const BackpropI
         return;
     }
 
-    std::lock_guard<std::mutex> lock{mutex_};
+    BackpropOrdinal outer_ordinal{};
+    BackpropOrdinal inner_ordinal{};
+    std::tie(outer_ordinal, inner_ordinal) = std::minmax(backprop_id1.ordinal(), backprop_id2.ordinal());
 
-    BackpropSetItem* item1 = GetBackpropSetItem(backprop_id1.ordinal());
-    BackpropSetItem* item2 = GetBackpropSetItem(backprop_id2.ordinal());
-    if (item1 == nullptr || item2 == nullptr) {
-        // At least one cannot be found
-        return;
+    // Returns true if there is nothing to do, i.e. at least one cannot be found or they are already in connection.
+    auto is_connected = [this, outer_ordinal, inner_ordinal]() {
+        const BackpropSetItem* outer_item = GetBackpropSetItem(outer_ordinal);
+        if (outer_item == nullptr || GetBackpropSetItem(inner_ordinal) == nullptr) {
+            return true;
+        }
+        const std::vector<BackpropOrdinal>& inner_ordinals = outer_item->inner_ordinals;
+        return inner_ordinals.end() != std::find(inner_ordinals.begin(), inner_ordinals.end(), inner_ordinal);
+    };
+
+    // Connections are made once and then checked on every operation involving both, so the check is done under the shared lock first.
+    {
+        std::shared_lock<std::shared_timed_mutex> lock{backprop_mutex_};
+        if (is_connected()) {
+            return;
+        }
     }
 
-    std::pair<BackpropOrdinal, BackpropOrdinal> pair = std::minmax(backprop_id1.ordinal(), backprop_id2.ordinal());
-    if (backprop_connections_.end() != std::find(backprop_connections_.begin(), backprop_connections_.end(), pair)) {
-        // Already in connection
+    std::lock_guard<std::shared_timed_mutex> lock{backprop_mutex_};
+    if (is_connected()) {
         return;
     }
 
     // Add a new connection
-    backprop_connections_.emplace_back(pair);
+    GetBackpropSetItem(outer_ordinal)->inner_ordinals.emplace_back(inner_ordinal);
+    GetBackpropSetItem(inner_ordinal)->outer_ordinals.emplace_back(outer_ordinal);
 }
 
 std::string Context::GetBackpropName(const BackpropId& backprop_id) {
-    // Note: backprop name cannot be returned by reference, as the reference may be invalidated when a new graph is pushed to the backprop
-    // set.
-    std::lock_guard<std::mutex> lock{mutex_};
+    // Note: backprop name cannot be returned by reference, as the reference may be invalidated when the backprop ID is released.
+    std::shared_lock<std::shared_timed_mutex> lock{backprop_mutex_};
     return ToBackpropIdString(backprop_id.ordinal());
 }
 
 void Context::CheckBackpropAllowed(const BackpropId& backprop_id) {
-    std::lock_guard<std::mutex> lock{mutex_};
-    BackpropSetItem* item = GetBackpropSetItem(backprop_id.ordinal());
+    std::shared_lock<std::shared_timed_mutex> lock{backprop_mutex_};
+    const BackpropSetItem* item = GetBackpropSetItem(backprop_id.ordinal());
     if (item == nullptr) {
         throw ChainerxError{"Backprop ID not found: ", ToBackpropIdString(backprop_id.ordinal())};
     }
@@ -221,20 +295,22 @@ void Context::CheckBackpropAllowed(const BackpropId& backprop_id) {
 }
 
 void Context::SetBackpropDone(const BackpropId& backprop_id) {
-    std::lock_guard<std::mutex> lock{mutex_};
-
-    CHAINERX_ASSERT(GetBackpropSetItem(backprop_id.ordinal()) != nullptr);
-
-    // Find connected backprop IDs
-    std::vector<BackpropOrdinal> ordinals_to_prohibit;
-    for (const std::pair<BackpropOrdinal, BackpropOrdinal>& pair : backprop_connections_) {
-        if (pair.first == backprop_id.ordinal()) {
-            ordinals_to_prohibit.emplace_back(pair.second);
+    {
+        // Most backprop IDs, e.g. the default one in the absence of higher order graphs, have no connected backprop IDs to prohibit.
+        std::shared_lock<std::shared_timed_mutex> lock{backprop_mutex_};
+        const BackpropSetItem* item = GetBackpropSetItem(backprop_id.ordinal());
+        CHAINERX_ASSERT(item != nullptr);
+        if (item->inner_ordinals.empty()) {
+            return;
         }
     }
 
+    std::lock_guard<std::shared_timed_mutex> lock{backprop_mutex_};
+    BackpropSetItem* item = GetBackpropSetItem(backprop_id.ordinal());
+    CHAINERX_ASSERT(item != nullptr);
+
     // Mark connected backprop IDs as prohibited.
-    for (BackpropOrdinal ord : ordinals_to_prohibit) {
+    for (BackpropOrdinal ord : item->inner_ordinals) {
         BackpropSetItem* item2 = GetBackpropSetItem(ord);
         if (!item2->prohibiting_ordinal.has_value()) {
             item2->prohibiting_ordinal = backprop_id.ordinal();
@@ -245,12 +321,14 @@ void Context::SetBackpropDone(const BackpropId& backprop_id) {
 std::vector<BackpropId> Context::GetInnerBackpropIds(const BackpropId& backprop_id) {
     std::vector<BackpropId> inner_backprop_ids;
 
-    std::lock_guard<std::mutex> lock{mutex_};
-    inner_backprop_ids.reserve(backprop_set_.size());
-    for (const std::pair<BackpropOrdinal, BackpropOrdinal>& pair : backprop_connections_) {
-        if (pair.first == backprop_id.ordinal()) {
-            inner_backprop_ids.emplace_back(BackpropId{*this, pair.second});
-        }
+    std::shared_lock<std::shared_timed_mutex> lock{backprop_mutex_};
+    const BackpropSetItem* item = GetBackpropSetItem(backprop_id.ordinal());
+    if (item == nullptr) {
+        return inner_backprop_ids;
+    }
+    inner_backprop_ids.reserve(item->inner_ordinals.size());
+    for (BackpropOrdinal ordinal : item->inner_ordinals) {
+        inner_backprop_ids.emplace_back(BackpropId{*this, ordinal});
     }
     return inner_backprop_ids;
 }
@@ -265,20 +343,13 @@ std::pair<Backend&, bool> Context::RegisterBackend(
     if (!pair.second) {
         return {*pair.first->second, false};
     }
-    pair.first->second->Initialize();
-    return {*pair.first->second, true};
-}
-
-template <typename ThisPtr, typename ReturnType>
-ReturnType Context::GetBackpropSetItemImpl(ThisPtr this_ptr, BackpropOrdinal ordinal) {
-    // using reverse iterator because it's more likely to find earlier
-    auto it = std::find_if(this_ptr->backprop_set_.rbegin(), this_ptr->backprop_set_.rend(), [ordinal](const BackpropSetItem& item) {
-        return item.ordinal == ordinal;
-    });
-    if (it == this_ptr->backprop_set_.rend()) {
-        return nullptr;
+    Backend& registered_backend = *pair.first->second;
+    registered_backend.Initialize();
+    // The kernel registry of the backend is set up by Initialize().
+    for (const KernelPlugin& plugin : kernel_plugins_) {
+        ApplyKernelPlugin(plugin, backend_name, registered_backend);
     }
-    return &*it;
+    return {registered_backend, true};
 }
 
 std::string Context::ToBackpropIdString(BackpropOrdinal ordinal) const {
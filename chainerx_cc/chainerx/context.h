@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -41,11 +42,25 @@ private:
 
 }  // namespace context_detail
 
+// A kernel registered by a kernel plugin to a backend, hiding the one registered to the parent kernel registry of the backend if any.
+struct KernelOverride {
+    std::string plugin_path;
+    std::string backend_name;
+    std::string kernel_name;
+};
+
 // TODO(sonots): Hide BackpropId-related functions from users.
 // TODO(sonots): Move implementations of BackpropId-releated functions into another class.
-// TODO(niboshi): Make BackpropId-related functions thread-safe.
+//
+// BackpropId-related functions are thread safe. Their state is guarded by a reader-writer lock separate from that of the backends, and
+// the functions which do not modify it, as well as those called repeatedly with the same arguments such as ConnectBackpropIds(), only take
+// the lock shared. The default backprop ID is never released and is handled without locking.
 class Context {
 public:
+    // Name of the environment variable specifying the kernel plugins loaded on construction, separated by colons.
+    static constexpr const char* kKernelPluginsEnvVarName = "CHAINERX_KERNEL_PLUGINS";
+
+    // Loads the kernel plugins specified by the environment variable.
     Context();
     ~Context();
 
@@ -78,6 +93,21 @@ public:
     // If the backend and/or device do not exist, this function automatically creates them.
     Device& GetDevice(const DeviceId& device_id);
 
+    // Loads a kernel plugin, i.e. a shared library which exports the following function.
+    //
+    //     extern "C" void RegisterKernels(chainerx::Backend& backend);
+    //
+    // The function is called with each backend of this context, including the ones created afterwards, and may register kernels to
+    // kernel_registry() of the backend, e.g. only if GetName() of the backend is "native". Such kernels take priority over the ones
+    // registered to the global kernel registry of the backend. Kernels must not be registered to global kernel registries, which outlive
+    // the library.
+    //
+    // The function is called with a lock of this context held, and must not create backends.
+    void LoadKernelPlugin(const std::string& plugin_path);
+
+    // Returns the kernels registered by the kernel plugins, in the order of registration.
+    std::vector<KernelOverride> GetKernelOverrides() const;
+
     BackpropId MakeBackpropId(std::string backprop_name);
 
     void ReleaseBackpropId(const BackpropId& backprop_id);
@@ -114,12 +144,7 @@ public:
     // TODO(sonots): Hide from users
     std::vector<BackpropId> GetInnerBackpropIds(const BackpropId& backprop_id);
 
-    BackpropId default_backprop_id() {
-        // The first entry is always the default backprop ID.
-        std::lock_guard<std::mutex> lock{mutex_};
-        CHAINERX_ASSERT(!backprop_set_.empty());
-        return BackpropId{*this, backprop_set_.front().ordinal};
-    }
+    BackpropId default_backprop_id() { return BackpropId{*this, kDefaultBackpropOrdinal}; }
 
 private:
     // If a backend associated with backend_name is already registered, returns a pair of the a reference to the backend already registered
@@ -127,33 +152,46 @@ private:
     std::pair<Backend&, bool> RegisterBackend(
             const std::string& backend_name, std::unique_ptr<Backend, context_detail::BackendDeleter> backend);
 
-    // TODO(niboshi): Support multi-thread usage
+    struct KernelPlugin {
+        std::string path;
+        void (*register_kernels)(Backend&);
+    };
+
+    // Calls the entry point of a kernel plugin with a backend, and records the kernels registered by it.
+    // Note that this function is not thread safe.
+    void ApplyKernelPlugin(const KernelPlugin& plugin, const std::string& backend_name, Backend& backend);
+
+    // The ordinal of the default backprop ID, which is registered first on construction.
+    static constexpr BackpropOrdinal kDefaultBackpropOrdinal = 0;
+
     struct BackpropSetItem {
-        BackpropSetItem(BackpropOrdinal ordinal, std::string name) : ordinal{ordinal}, name{std::move(name)} {}
+        explicit BackpropSetItem(std::string name) : name{std::move(name)} {}
 
-        BackpropOrdinal ordinal;
         std::string name;
 
         // If this member has a value, it indicates that this Backprop ID is prohibited for further backprop.
         // Its value is the backprop ID which caused the prohibition.
         absl::optional<BackpropOrdinal> prohibiting_ordinal{absl::nullopt};
+
+        // Backprop IDs connected to this one, with greater and smaller ordinals, respectively, in the order of connection.
+        std::vector<BackpropOrdinal> inner_ordinals{};
+        std::vector<BackpropOrdinal> outer_ordinals{};
     };
 
-    // Finds the BackpropSetItem instance.
+    // Finds the BackpropSetItem instance, or returns nullptr if not found.
     // Note that this function is not thread safe.
     const BackpropSetItem* GetBackpropSetItem(BackpropOrdinal ordinal) const {
-        return GetBackpropSetItemImpl<const Context*, const BackpropSetItem*>(this, ordinal);
+        auto it = backprop_set_.find(ordinal);
+        return it == backprop_set_.end() ? nullptr : &it->second;
     }
 
-    // Finds the BackpropSetItem instance.
+    // Finds the BackpropSetItem instance, or returns nullptr if not found.
     // Note that this function is not thread safe.
     BackpropSetItem* GetBackpropSetItem(BackpropOrdinal ordinal) {
-        return GetBackpropSetItemImpl<Context*, BackpropSetItem*>(this, ordinal);
+        auto it = backprop_set_.find(ordinal);
+        return it == backprop_set_.end() ? nullptr : &it->second;
     }
 
-    template <typename ThisPtr, typename ReturnType>
-    static ReturnType GetBackpropSetItemImpl(ThisPtr this_ptr, BackpropOrdinal ordinal);
-
     // Returns a string representation of a backprop ID given its ordinal.
     // A special string is returned if the given ordinal has already expired.
     // Note that this function is not thread safe.
@@ -161,15 +199,17 @@ private:
 
     std::unordered_map<std::string, std::unique_ptr<Backend, context_detail::BackendDeleter>> backends_;
     std::vector<void*> dlopen_handles_;
+    std::vector<KernelPlugin> kernel_plugins_;
+    std::vector<KernelOverride> kernel_overrides_;
     mutable std::mutex mutex_;
 
-    BackpropOrdinal next_backprop_ordinal_{0};
+    // Guards the members below.
+    mutable std::shared_timed_mutex backprop_mutex_;
 
-    std::vector<BackpropSetItem> backprop_set_{};
+    BackpropOrdinal next_backprop_ordinal_{kDefaultBackpropOrdinal};
 
-    // List of pairs of connected backprop IDs.
-    // The first ordinal is always less than the second, which means backpropping on the first will prohibit future backprop on the second.
-    std::vector<std::pair<BackpropOrdinal, BackpropOrdinal>> backprop_connections_;
+    // Backprop IDs which have not been released. Backpropping on a backprop ID prohibits future backprop on its inner backprop IDs.
+    std::unordered_map<BackpropOrdinal, BackpropSetItem> backprop_set_{};
 };
 
 // Gets/sets the context that used by default when current context is not set.
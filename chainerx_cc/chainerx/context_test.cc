@@ -2,15 +2,26 @@
 
 #include <cstdlib>
 #include <future>
+#include <string>
 #include <vector>
 
 #include <absl/types/optional.h>
 #include <gtest/gtest.h>
 
+#include "chainerx/array.h"
 #include "chainerx/backend.h"
+#include "chainerx/backprop_scope.h"
+#include "chainerx/backward.h"
 #include "chainerx/device.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
 #include "chainerx/native/native_backend.h"
 #include "chainerx/native/native_device.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/explog.h"
+#include "chainerx/routines/reduction.h"
+#include "chainerx/testing/array_check.h"
 #include "chainerx/testing/threading.h"
 #include "chainerx/util.h"
 
@@ -113,6 +124,42 @@ TEST(ContextTest, BackpropIdThreadSafe) {
     });
 }
 
+TEST(ContextTest, BuildGraphsThreadSafe) {
+    static constexpr size_t kThreadCount = 64;
+    static constexpr int kIterationCount = 16;
+    Context ctx{};
+    Device& device = ctx.GetDevice(DeviceId{native::NativeBackend::kDefaultName, 0});
+
+    // Each thread builds its own graphs on the shared context, including ones connecting backprop IDs created by the thread.
+    testing::RunThreads(kThreadCount, [&ctx, &device](size_t thread_index) {
+        ContextScope context_scope{ctx};
+        for (int i = 0; i < kIterationCount; ++i) {
+            BackpropScope backprop_scope1{"bp1", ctx};
+            BackpropScope backprop_scope2{"bp2", ctx};
+            BackpropId bp1 = backprop_scope1.backprop_id();
+            BackpropId bp2 = backprop_scope2.backprop_id();
+
+            Array w = Full({4}, static_cast<float>(thread_index), device);
+            w.RequireGrad();
+            Backward(Sum(w * w));
+            EXPECT_ARRAY_EQ(2 * w, *w.GetGrad());
+
+            Array x = Full({4}, static_cast<float>(thread_index), device);
+            x.RequireGrad(bp1).RequireGrad(bp2);
+            Array y = Sum(x * x);
+            EXPECT_EQ(std::vector<BackpropId>({bp2}), ctx.GetInnerBackpropIds(bp1));
+
+            // Backprop on the outer graph prohibits that on the inner one.
+            Backward(y, bp1);
+            EXPECT_ARRAY_EQ(2 * x, *x.GetGrad(bp1));
+            EXPECT_THROW(Backward(y, bp2), ChainerxError);
+        }
+    });
+
+    // Only the default backprop ID is left.
+    EXPECT_EQ(std::vector<BackpropId>{}, ctx.GetInnerBackpropIds(ctx.default_backprop_id()));
+}
+
 TEST(ContextTest, DefaultContext) {
     SetGlobalDefaultContext(nullptr);
     SetDefaultContext(nullptr);
@@ -252,6 +299,74 @@ TEST(ContextTest, UserDefinedBackend) {
     EXPECT_EQ(&backend0, &device0.backend());
 }
 
+constexpr const char* kKernelPluginPath = CHAINERX_TEST_DIR "/backend_testdata/kernel_plugins/kernel_plugin0.so";
+
+TEST(ContextTest, LoadKernelPlugin) {
+    Context ctx;
+    ContextScope context_scope{ctx};
+    Device& device = ctx.GetDevice({"native:0"});
+    Array x = Zeros({2, 3}, Dtype::kFloat32, device);
+    EXPECT_ARRAY_EQ(OnesLike(x), Exp(x));
+
+    // Overrides the kernel of the existing native backend.
+    ctx.LoadKernelPlugin(kKernelPluginPath);
+    EXPECT_ARRAY_EQ(FullLike(x, 42.0f), Exp(x));
+    std::vector<KernelOverride> overrides = ctx.GetKernelOverrides();
+    ASSERT_EQ(1U, overrides.size());
+    EXPECT_EQ(kKernelPluginPath, overrides[0].plugin_path);
+    EXPECT_EQ("native", overrides[0].backend_name);
+    EXPECT_EQ("Exp", overrides[0].kernel_name);
+
+    // Another context is not affected.
+    Context ctx_another;
+    ContextScope context_scope_another{ctx_another};
+    Array y = Zeros({2, 3}, Dtype::kFloat32, ctx_another.GetDevice({"native:0"}));
+    EXPECT_ARRAY_EQ(OnesLike(y), Exp(y));
+    EXPECT_TRUE(ctx_another.GetKernelOverrides().empty());
+}
+
+TEST(ContextTest, LoadKernelPluginBeforeBackend) {
+    absl::optional<std::string> chainerx_path = GetEnv("CHAINERX_PATH");
+    SetEnv("CHAINERX_PATH", CHAINERX_TEST_DIR "/backend_testdata");
+    Context ctx;
+    ContextScope context_scope{ctx};
+    ctx.LoadKernelPlugin(kKernelPluginPath);
+    EXPECT_TRUE(ctx.GetKernelOverrides().empty());
+
+    // Backends created afterwards are given the kernels, unless the plugin skips them.
+    Device& native_device = ctx.GetDevice({"native:0"});
+    Device& backend0_device = ctx.GetDevice({"backend0:0"});
+    if (chainerx_path.has_value()) {
+        SetEnv("CHAINERX_PATH", *chainerx_path);
+    } else {
+        UnsetEnv("CHAINERX_PATH");
+    }
+
+    Array x = Zeros({2, 3}, Dtype::kFloat32, native_device);
+    EXPECT_ARRAY_EQ(FullLike(x, 42.0f), Exp(x));
+    Array y = Zeros({2, 3}, Dtype::kFloat32, backend0_device);
+    EXPECT_ARRAY_EQ(OnesLike(y, y.device()), Exp(y));
+    ASSERT_EQ(1U, ctx.GetKernelOverrides().size());
+    EXPECT_EQ("native", ctx.GetKernelOverrides()[0].backend_name);
+}
+
+TEST(ContextTest, LoadKernelPluginFromEnv) {
+    SetEnv(Context::kKernelPluginsEnvVarName, std::string{":"} + kKernelPluginPath);
+    Context ctx;
+    UnsetEnv(Context::kKernelPluginsEnvVarName);
+    ContextScope context_scope{ctx};
+    Array x = Zeros({2, 3}, Dtype::kFloat32, ctx.GetDevice({"native:0"}));
+    EXPECT_ARRAY_EQ(FullLike(x, 42.0f), Exp(x));
+    EXPECT_EQ(1U, ctx.GetKernelOverrides().size());
+}
+
+TEST(ContextTest, KernelPluginNotFound) {
+    Context ctx;
+    EXPECT_THROW(ctx.LoadKernelPlugin(CHAINERX_TEST_DIR "/backend_testdata/kernel_plugins/missing.so"), ContextError);
+    // Not a kernel plugin.
+    EXPECT_THROW(ctx.LoadKernelPlugin(CHAINERX_TEST_DIR "/backend_testdata/backends/backend0.so"), ContextError);
+}
+
 TEST(ContextTest, GetBackendOnDefaultContext) {
     // chainerx::GetBackend
     Context ctx;
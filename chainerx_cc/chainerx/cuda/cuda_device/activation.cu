@@ -0,0 +1,286 @@
+#include "chainerx/cuda/cuda_device.h"
+
+#include <cstdint>
+#include <type_traits>
+
+#include <absl/types/optional.h>
+#include <cuda_runtime.h>
+
+#include "chainerx/array.h"
+#include "chainerx/cuda/cuda_runtime.h"
+#include "chainerx/cuda/cuda_set_device_scope.h"
+#include "chainerx/cuda/data_type.cuh"
+#include "chainerx/cuda/elementwise.cuh"
+#include "chainerx/cuda/float16.cuh"
+#include "chainerx/cuda/kernel_regist.h"
+#include "chainerx/cuda/numeric.cuh"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/kernels/activation.h"
+#include "chainerx/scalar.h"
+
+namespace chainerx {
+namespace cuda {
+namespace {
+
+// Activations of float16 arrays are computed in float.
+template <typename CudaType>
+using ActivationComputeType = std::conditional_t<std::is_same<CudaType, cuda::Float16>::value, float, CudaType>;
+
+template <typename T>
+struct SigmoidImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using U = ActivationComputeType<CudaType>;
+    __device__ void operator()(int64_t /*i*/, CudaType x, CudaType& out) {
+        // exp is evaluated on a non-positive argument so that it does not overflow.
+        U x_u = static_cast<U>(x);
+        U e = cuda::Exp(-cuda::Abs(x_u));
+        out = CudaType{x_u >= 0 ? U{1} / (U{1} + e) : e / (U{1} + e)};
+    }
+};
+
+class CudaSigmoidKernel : public SigmoidKernel {
+public:
+    void Call(const Array& x, const Array& out) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, out);
+        CudaSetDeviceScope scope{device.index()};
+        const Array& x_cast = x.dtype() == out.dtype() ? x : x.AsType(out.dtype());
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            Elementwise<const T, T>(SigmoidImpl<T>{}, x_cast, out);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(SigmoidKernel, CudaSigmoidKernel);
+
+template <typename T>
+struct SigmoidGradImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using U = ActivationComputeType<CudaType>;
+    __device__ void operator()(int64_t /*i*/, CudaType y, CudaType gy, CudaType& gx) {
+        U y_u = static_cast<U>(y);
+        gx = CudaType{static_cast<U>(gy) * y_u * (U{1} - y_u)};
+    }
+};
+
+class CudaSigmoidGradKernel : public SigmoidGradKernel {
+public:
+    void Call(const Array& out, const Array& gout, const Array& gx) override {
+        Device& device = out.device();
+        device.CheckDevicesCompatible(out, gout, gx);
+        CudaSetDeviceScope scope{device.index()};
+        VisitFloatingPointDtype(gx.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            Elementwise<const T, const T, T>(SigmoidGradImpl<T>{}, out, gout, gx);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(SigmoidGradKernel, CudaSigmoidGradKernel);
+
+template <typename T>
+struct SoftplusImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using U = ActivationComputeType<CudaType>;
+    __device__ void operator()(int64_t /*i*/, CudaType x, CudaType& out) {
+        U bx = beta * static_cast<U>(x);
+        out = CudaType{((bx > 0 ? bx : U{0}) + cuda::Log1p(cuda::Exp(-cuda::Abs(bx)))) * beta_inv};
+    }
+    U beta;
+    U beta_inv;
+};
+
+class CudaSoftplusKernel : public SoftplusKernel {
+public:
+    void Call(const Array& x, double beta, const Array& out) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, out);
+        CudaSetDeviceScope scope{device.index()};
+        const Array& x_cast = x.dtype() == out.dtype() ? x : x.AsType(out.dtype());
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = typename SoftplusImpl<T>::U;
+            Elementwise<const T, T>(SoftplusImpl<T>{static_cast<U>(beta), static_cast<U>(1.0 / beta)}, x_cast, out);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(SoftplusKernel, CudaSoftplusKernel);
+
+template <typename T>
+struct SoftplusGradImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using U = ActivationComputeType<CudaType>;
+    // The derivative sigmoid(beta * x) equals 1 - exp(-beta * y).
+    __device__ void operator()(int64_t /*i*/, CudaType y, CudaType gy, CudaType& gx) {
+        gx = CudaType{-static_cast<U>(gy) * cuda::Expm1(-beta * static_cast<U>(y))};
+    }
+    U beta;
+};
+
+class CudaSoftplusGradKernel : public SoftplusGradKernel {
+public:
+    void Call(const Array& out, const Array& gout, double beta, const Array& gx) override {
+        Device& device = out.device();
+        device.CheckDevicesCompatible(out, gout, gx);
+        CudaSetDeviceScope scope{device.index()};
+        VisitFloatingPointDtype(gx.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = typename SoftplusGradImpl<T>::U;
+            Elementwise<const T, const T, T>(SoftplusGradImpl<T>{static_cast<U>(beta)}, out, gout, gx);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(SoftplusGradKernel, CudaSoftplusGradKernel);
+
+template <typename T>
+struct EluImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using U = ActivationComputeType<CudaType>;
+    __device__ void operator()(int64_t /*i*/, CudaType x, CudaType& out) {
+        U x_u = static_cast<U>(x);
+        out = CudaType{x_u > 0 ? x_u : alpha * cuda::Expm1(x_u)};
+    }
+    U alpha;
+};
+
+class CudaEluKernel : public EluKernel {
+public:
+    void Call(const Array& x, double alpha, const Array& out) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, out);
+        CudaSetDeviceScope scope{device.index()};
+        const Array& x_cast = x.dtype() == out.dtype() ? x : x.AsType(out.dtype());
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = typename EluImpl<T>::U;
+            Elementwise<const T, T>(EluImpl<T>{static_cast<U>(alpha)}, x_cast, out);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(EluKernel, CudaEluKernel);
+
+template <typename T>
+struct EluGradImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using U = ActivationComputeType<CudaType>;
+    // For x <= 0, the derivative alpha * exp(x) equals y + alpha.
+    __device__ void operator()(int64_t /*i*/, CudaType y, CudaType gy, CudaType& gx) {
+        U y_u = static_cast<U>(y);
+        gx = CudaType{y_u > 0 ? static_cast<U>(gy) : static_cast<U>(gy) * (y_u + alpha)};
+    }
+    U alpha;
+};
+
+class CudaEluGradKernel : public EluGradKernel {
+public:
+    void Call(const Array& out, const Array& gout, double alpha, const Array& gx) override {
+        Device& device = out.device();
+        device.CheckDevicesCompatible(out, gout, gx);
+        CudaSetDeviceScope scope{device.index()};
+        VisitFloatingPointDtype(gx.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = typename EluGradImpl<T>::U;
+            Elementwise<const T, const T, T>(EluGradImpl<T>{static_cast<U>(alpha)}, out, gout, gx);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(EluGradKernel, CudaEluGradKernel);
+
+template <typename T>
+struct ClippedReluImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using U = ActivationComputeType<CudaType>;
+    __device__ void operator()(int64_t /*i*/, CudaType x, CudaType& out) {
+        U x_u = static_cast<U>(x);
+        out = CudaType{x_u < 0 ? U{0} : (x_u > z ? z : x_u)};
+    }
+    U z;
+};
+
+template <typename T>
+struct ClippedReluMaskImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using U = ActivationComputeType<CudaType>;
+    __device__ void operator()(int64_t i, CudaType x, CudaType& out, bool& mask) {
+        ClippedReluImpl<T>{z}(i, x, out);
+        U x_u = static_cast<U>(x);
+        mask = 0 < x_u && x_u < z;
+    }
+    U z;
+};
+
+class CudaClippedReluKernel : public ClippedReluKernel {
+public:
+    void Call(const Array& x, Scalar z, const Array& out, const absl::optional<Array>& mask) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, out);
+        CudaSetDeviceScope scope{device.index()};
+        const Array& x_cast = x.dtype() == out.dtype() ? x : x.AsType(out.dtype());
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = typename ClippedReluImpl<T>::U;
+            if (mask.has_value()) {
+                device.CheckDevicesCompatible(x, *mask);
+                Elementwise<const T, T, bool>(ClippedReluMaskImpl<T>{static_cast<U>(z)}, x_cast, out, *mask);
+            } else {
+                Elementwise<const T, T>(ClippedReluImpl<T>{static_cast<U>(z)}, x_cast, out);
+            }
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(ClippedReluKernel, CudaClippedReluKernel);
+
+template <typename T>
+struct LeakyReluImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using U = ActivationComputeType<CudaType>;
+    __device__ void operator()(int64_t /*i*/, CudaType x, CudaType& out) {
+        U x_u = static_cast<U>(x);
+        out = CudaType{x_u >= 0 ? x_u : slope * x_u};
+    }
+    U slope;
+};
+
+template <typename T>
+struct LeakyReluMaskImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using U = ActivationComputeType<CudaType>;
+    __device__ void operator()(int64_t i, CudaType x, CudaType& out, bool& mask) {
+        LeakyReluImpl<T>{slope}(i, x, out);
+        mask = static_cast<U>(x) >= 0;
+    }
+    U slope;
+};
+
+class CudaLeakyReluKernel : public LeakyReluKernel {
+public:
+    void Call(const Array& x, Scalar slope, const Array& out, const absl::optional<Array>& mask) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, out);
+        CudaSetDeviceScope scope{device.index()};
+        const Array& x_cast = x.dtype() == out.dtype() ? x : x.AsType(out.dtype());
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = typename LeakyReluImpl<T>::U;
+            if (mask.has_value()) {
+                device.CheckDevicesCompatible(x, *mask);
+                Elementwise<const T, T, bool>(LeakyReluMaskImpl<T>{static_cast<U>(slope)}, x_cast, out, *mask);
+            } else {
+                Elementwise<const T, T>(LeakyReluImpl<T>{static_cast<U>(slope)}, x_cast, out);
+            }
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(LeakyReluKernel, CudaLeakyReluKernel);
+
+}  // namespace
+}  // namespace cuda
+}  // namespace chainerx
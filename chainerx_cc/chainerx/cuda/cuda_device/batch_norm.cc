@@ -389,6 +389,12 @@ public:
 
 CHAINERX_CUDA_REGISTER_KERNEL(FixedBatchNormKernel, CudaFixedBatchNormKernel);
 
+// Layer and group normalization use the generic implementations composed of other routines.
+CHAINERX_CUDA_REGISTER_KERNEL(LayerNormKernel, GenericLayerNormKernel);
+CHAINERX_CUDA_REGISTER_KERNEL(LayerNormGradKernel, GenericLayerNormGradKernel);
+CHAINERX_CUDA_REGISTER_KERNEL(GroupNormKernel, GenericGroupNormKernel);
+CHAINERX_CUDA_REGISTER_KERNEL(GroupNormGradKernel, GenericGroupNormGradKernel);
+
 }  // namespace
 }  // namespace cuda
 }  // namespace chainerx
@@ -87,6 +87,13 @@ public:
 
 CHAINERX_CUDA_REGISTER_KERNEL(ConvGradWeightKernel, CudaConvGradWeightKernel);
 
+// The bias is added by cuDNN and the activation is applied in place on its output.
+CHAINERX_CUDA_REGISTER_KERNEL(ConvBiasActivationKernel, GenericConvBiasActivationKernel);
+
+// Scaled dot-product attention uses the generic implementations composed of other routines.
+CHAINERX_CUDA_REGISTER_KERNEL(ScaledDotProductAttentionKernel, GenericScaledDotProductAttentionKernel);
+CHAINERX_CUDA_REGISTER_KERNEL(ScaledDotProductAttentionGradKernel, GenericScaledDotProductAttentionGradKernel);
+
 }  // namespace
 }  // namespace cuda
 }  // namespace chainerx
@@ -0,0 +1,351 @@
+#include "chainerx/cuda/cuda_device.h"
+
+#include <cstdint>
+#include <type_traits>
+
+#include <cuda_runtime.h>
+
+#include "chainerx/array.h"
+#include "chainerx/axes.h"
+#include "chainerx/cuda/cuda_runtime.h"
+#include "chainerx/cuda/cuda_set_device_scope.h"
+#include "chainerx/cuda/data_type.cuh"
+#include "chainerx/cuda/elementwise.cuh"
+#include "chainerx/cuda/float16.cuh"
+#include "chainerx/cuda/kernel_regist.h"
+#include "chainerx/cuda/numeric.cuh"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/kernels/arithmetic.h"
+#include "chainerx/kernels/loss.h"
+#include "chainerx/kernels/reduction.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/loss.h"
+#include "chainerx/scalar.h"
+
+namespace chainerx {
+namespace cuda {
+namespace {
+
+// Losses of float16 arrays are computed in float.
+template <typename CudaType>
+using LossComputeType = std::conditional_t<std::is_same<CudaType, cuda::Float16>::value, float, CudaType>;
+
+template <typename T>
+__device__ double LabelToDouble(T t) {
+    return static_cast<double>(t);
+}
+
+__device__ double LabelToDouble(cuda::Float16 t) { return static_cast<double>(static_cast<float>(t)); }
+
+template <typename T, typename LossImpl>
+struct StoreLoss {
+    using CudaType = cuda_internal::DataType<T>;
+    template <typename... Ts>
+    __device__ void operator()(int64_t i, CudaType& out, Ts... xs) {
+        out = CudaType{impl(i, xs...)};
+    }
+    LossImpl impl;
+};
+
+// Evaluates impl, which returns the loss of a single element, over the given arrays.
+// Reduced losses are computed by summing up a temporary array of the elementwise losses.
+template <typename T, typename... Ts, typename LossImpl, typename... Arrays>
+void ElementwiseLoss(LossImpl impl, LossReduction reduction, const Array& out, const Array& x, const Arrays&... args) {
+    if (reduction == LossReduction::kNone) {
+        Elementwise<T, const Ts...>(StoreLoss<T, LossImpl>{impl}, out, x, args...);
+        return;
+    }
+    Device& device = x.device();
+    Array loss = Empty(x.shape(), out.dtype(), device);
+    Elementwise<T, const Ts...>(StoreLoss<T, LossImpl>{impl}, loss, x, args...);
+    Axes axes{};
+    for (int8_t i = 0; i < x.ndim(); ++i) {
+        axes.emplace_back(i);
+    }
+    device.backend().CallKernel<SumKernel>(loss, axes, out);
+    if (reduction == LossReduction::kMean) {
+        // The mean of no elements is NaN as in NumPy.
+        device.backend().CallKernel<MultiplyASKernel>(out, Scalar{1.0 / x.GetTotalSize()}, out);
+    }
+}
+
+template <typename T>
+struct GaussianKLDivergenceImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using U = LossComputeType<CudaType>;
+    __device__ U operator()(int64_t /*i*/, CudaType mean, CudaType ln_var) {
+        U mean_u = static_cast<U>(mean);
+        U ln_var_u = static_cast<U>(ln_var);
+        return (mean_u * mean_u + cuda::Exp(ln_var_u) - ln_var_u - U{1}) * U{0.5};
+    }
+};
+
+class CudaGaussianKLDivergenceKernel : public GaussianKLDivergenceKernel {
+public:
+    void Call(const Array& mean, const Array& ln_var, LossReduction reduction, const Array& out) override {
+        Device& device = mean.device();
+        device.CheckDevicesCompatible(mean, ln_var, out);
+        CudaSetDeviceScope scope{device.index()};
+        const Array& mean_cast = mean.dtype() == out.dtype() ? mean : mean.AsType(out.dtype());
+        const Array& ln_var_cast = ln_var.dtype() == out.dtype() ? ln_var : ln_var.AsType(out.dtype());
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            ElementwiseLoss<T, T, T>(GaussianKLDivergenceImpl<T>{}, reduction, out, mean_cast, ln_var_cast);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(GaussianKLDivergenceKernel, CudaGaussianKLDivergenceKernel);
+
+template <typename T>
+struct GaussianKLDivergenceGradImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using U = LossComputeType<CudaType>;
+    __device__ void operator()(int64_t /*i*/, CudaType mean, CudaType ln_var, CudaType gout, CudaType& gmean, CudaType& gln_var) {
+        U gout_u = static_cast<U>(gout);
+        gmean = CudaType{gout_u * static_cast<U>(mean)};
+        gln_var = CudaType{gout_u * U{0.5} * cuda::Expm1(static_cast<U>(ln_var))};
+    }
+};
+
+class CudaGaussianKLDivergenceGradKernel : public GaussianKLDivergenceGradKernel {
+public:
+    void Call(const Array& mean, const Array& ln_var, const Array& gout, const Array& gmean, const Array& gln_var) override {
+        Device& device = mean.device();
+        device.CheckDevicesCompatible(mean, ln_var, gout, gmean, gln_var);
+        CudaSetDeviceScope scope{device.index()};
+        const Array& mean_cast = mean.dtype() == gout.dtype() ? mean : mean.AsType(gout.dtype());
+        const Array& ln_var_cast = ln_var.dtype() == gout.dtype() ? ln_var : ln_var.AsType(gout.dtype());
+        VisitFloatingPointDtype(gout.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            Elementwise<const T, const T, const T, T, T>(GaussianKLDivergenceGradImpl<T>{}, mean_cast, ln_var_cast, gout, gmean, gln_var);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(GaussianKLDivergenceGradKernel, CudaGaussianKLDivergenceGradKernel);
+
+template <typename T>
+struct HuberLossImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using U = LossComputeType<CudaType>;
+    __device__ U operator()(int64_t /*i*/, CudaType x1, CudaType x2) {
+        U diff = static_cast<U>(x1) - static_cast<U>(x2);
+        U abs_diff = cuda::Abs(diff);
+        return abs_diff < delta ? U{0.5} * diff * diff : delta * (abs_diff - U{0.5} * delta);
+    }
+    U delta;
+};
+
+class CudaHuberLossKernel : public HuberLossKernel {
+public:
+    void Call(const Array& x1, const Array& x2, Scalar delta, LossReduction reduction, const Array& out) override {
+        Device& device = x1.device();
+        device.CheckDevicesCompatible(x1, x2, out);
+        CudaSetDeviceScope scope{device.index()};
+        const Array& x1_cast = x1.dtype() == out.dtype() ? x1 : x1.AsType(out.dtype());
+        const Array& x2_cast = x2.dtype() == out.dtype() ? x2 : x2.AsType(out.dtype());
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = typename HuberLossImpl<T>::U;
+            ElementwiseLoss<T, T, T>(HuberLossImpl<T>{static_cast<U>(delta)}, reduction, out, x1_cast, x2_cast);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(HuberLossKernel, CudaHuberLossKernel);
+
+template <typename T>
+struct HuberLossGradImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using U = LossComputeType<CudaType>;
+    __device__ void operator()(int64_t /*i*/, CudaType x1, CudaType x2, CudaType gout, CudaType& gx1) {
+        U diff = static_cast<U>(x1) - static_cast<U>(x2);
+        U clipped = cuda::Abs(diff) < delta ? diff : (diff > 0 ? delta : -delta);
+        gx1 = CudaType{static_cast<U>(gout) * clipped};
+    }
+    U delta;
+};
+
+class CudaHuberLossGradKernel : public HuberLossGradKernel {
+public:
+    void Call(const Array& x1, const Array& x2, const Array& gout, Scalar delta, const Array& gx1) override {
+        Device& device = x1.device();
+        device.CheckDevicesCompatible(x1, x2, gout, gx1);
+        CudaSetDeviceScope scope{device.index()};
+        const Array& x1_cast = x1.dtype() == gx1.dtype() ? x1 : x1.AsType(gx1.dtype());
+        const Array& x2_cast = x2.dtype() == gx1.dtype() ? x2 : x2.AsType(gx1.dtype());
+        VisitFloatingPointDtype(gx1.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = typename HuberLossGradImpl<T>::U;
+            Elementwise<const T, const T, const T, T>(HuberLossGradImpl<T>{static_cast<U>(delta)}, x1_cast, x2_cast, gout, gx1);
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(HuberLossGradKernel, CudaHuberLossGradKernel);
+
+template <typename T, typename TLabel>
+struct SigmoidCrossEntropyImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using CudaLabelType = cuda_internal::DataType<TLabel>;
+    using U = LossComputeType<CudaType>;
+    __device__ U operator()(int64_t /*i*/, CudaType x, CudaLabelType t) {
+        double label = LabelToDouble(t);
+        if (label == -1) {
+            return U{0};
+        }
+        U x_u = static_cast<U>(x);
+        U step = x_u >= 0 ? U{1} : U{0};
+        return cuda::Log1p(cuda::Exp(-cuda::Abs(x_u))) - x_u * (static_cast<U>(label) - step);
+    }
+};
+
+class CudaSigmoidCrossEntropyKernel : public SigmoidCrossEntropyKernel {
+public:
+    void Call(const Array& x, const Array& t, LossReduction reduction, const Array& out) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, t, out);
+        CudaSetDeviceScope scope{device.index()};
+        const Array& x_cast = x.dtype() == out.dtype() ? x : x.AsType(out.dtype());
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            VisitDtype(t.dtype(), [&](auto t_pt) {
+                using TLabel = typename decltype(t_pt)::type;
+                ElementwiseLoss<T, T, TLabel>(SigmoidCrossEntropyImpl<T, TLabel>{}, reduction, out, x_cast, t);
+            });
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(SigmoidCrossEntropyKernel, CudaSigmoidCrossEntropyKernel);
+
+template <typename T, typename TLabel>
+struct SigmoidCrossEntropyGradImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using CudaLabelType = cuda_internal::DataType<TLabel>;
+    using U = LossComputeType<CudaType>;
+    __device__ void operator()(int64_t /*i*/, CudaType x, CudaLabelType t, CudaType gout, CudaType& gx) {
+        double label = LabelToDouble(t);
+        if (label == -1) {
+            gx = CudaType{U{0}};
+            return;
+        }
+        // Sigmoid evaluated so that exp does not overflow.
+        U x_u = static_cast<U>(x);
+        U e = cuda::Exp(-cuda::Abs(x_u));
+        U sigmoid = x_u >= 0 ? U{1} / (U{1} + e) : e / (U{1} + e);
+        gx = CudaType{static_cast<U>(gout) * (sigmoid - static_cast<U>(label))};
+    }
+};
+
+class CudaSigmoidCrossEntropyGradKernel : public SigmoidCrossEntropyGradKernel {
+public:
+    void Call(const Array& x, const Array& t, const Array& gout, const Array& gx) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, t, gout, gx);
+        CudaSetDeviceScope scope{device.index()};
+        const Array& x_cast = x.dtype() == gx.dtype() ? x : x.AsType(gx.dtype());
+        VisitFloatingPointDtype(gx.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            VisitDtype(t.dtype(), [&](auto t_pt) {
+                using TLabel = typename decltype(t_pt)::type;
+                Elementwise<const T, const TLabel, const T, T>(SigmoidCrossEntropyGradImpl<T, TLabel>{}, x_cast, t, gout, gx);
+            });
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(SigmoidCrossEntropyGradKernel, CudaSigmoidCrossEntropyGradKernel);
+
+// Broadcasts the labels of the rows of x to the shape of x.
+Array BroadcastHingeLabels(const Array& x, const Array& t) { return t.Reshape({t.shape()[0], 1}).BroadcastTo(x.shape()); }
+
+template <typename T, typename TLabel>
+struct HingeImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using CudaLabelType = cuda_internal::DataType<TLabel>;
+    using U = LossComputeType<CudaType>;
+    // The elements are visited in row-major order, hence i % n_classes is the class of the element.
+    __device__ U operator()(int64_t i, CudaType x, CudaLabelType t) {
+        U x_u = static_cast<U>(x);
+        bool is_label = LabelToDouble(t) == static_cast<double>(i % n_classes);
+        U bottom_diff = is_label ? U{1} - x_u : U{1} + x_u;
+        if (bottom_diff < 0) {
+            bottom_diff = U{0};
+        }
+        return norm == 1 ? bottom_diff : static_cast<U>(pow(bottom_diff, norm));
+    }
+    int64_t n_classes;
+    U norm;
+};
+
+class CudaHingeKernel : public HingeKernel {
+public:
+    void Call(const Array& x, const Array& t, double norm, LossReduction reduction, const Array& out) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, t, out);
+        CudaSetDeviceScope scope{device.index()};
+        const Array& x_cast = x.dtype() == out.dtype() ? x : x.AsType(out.dtype());
+        Array t_b = BroadcastHingeLabels(x, t);
+        int64_t n_classes = x.shape()[1];
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            VisitDtype(t.dtype(), [&](auto t_pt) {
+                using TLabel = typename decltype(t_pt)::type;
+                using U = typename HingeImpl<T, TLabel>::U;
+                ElementwiseLoss<T, T, TLabel>(HingeImpl<T, TLabel>{n_classes, static_cast<U>(norm)}, reduction, out, x_cast, t_b);
+            });
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(HingeKernel, CudaHingeKernel);
+
+template <typename T, typename TLabel>
+struct HingeGradImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using CudaLabelType = cuda_internal::DataType<TLabel>;
+    using U = LossComputeType<CudaType>;
+    __device__ void operator()(int64_t i, CudaType x, CudaLabelType t, CudaType gout, CudaType& gx) {
+        U x_u = static_cast<U>(x);
+        bool is_label = LabelToDouble(t) == static_cast<double>(i % n_classes);
+        U bottom_diff = is_label ? U{1} - x_u : U{1} + x_u;
+        if (bottom_diff <= 0) {
+            gx = CudaType{U{0}};
+            return;
+        }
+        U coeff = norm == 1 ? U{1} : norm * static_cast<U>(pow(bottom_diff, norm - 1));
+        gx = CudaType{static_cast<U>(gout) * (is_label ? -coeff : coeff)};
+    }
+    int64_t n_classes;
+    U norm;
+};
+
+class CudaHingeGradKernel : public HingeGradKernel {
+public:
+    void Call(const Array& x, const Array& t, const Array& gout, double norm, const Array& gx) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, t, gout, gx);
+        CudaSetDeviceScope scope{device.index()};
+        const Array& x_cast = x.dtype() == gx.dtype() ? x : x.AsType(gx.dtype());
+        Array t_b = BroadcastHingeLabels(x, t);
+        int64_t n_classes = x.shape()[1];
+        VisitFloatingPointDtype(gx.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            VisitDtype(t.dtype(), [&](auto t_pt) {
+                using TLabel = typename decltype(t_pt)::type;
+                using U = typename HingeGradImpl<T, TLabel>::U;
+                Elementwise<const T, const TLabel, const T, T>(
+                        HingeGradImpl<T, TLabel>{n_classes, static_cast<U>(norm)}, x_cast, t_b, gout, gx);
+            });
+        });
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(HingeGradKernel, CudaHingeGradKernel);
+
+}  // namespace
+}  // namespace cuda
+}  // namespace chainerx
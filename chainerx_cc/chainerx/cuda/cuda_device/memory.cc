@@ -17,12 +17,15 @@ namespace chainerx {
 namespace cuda {
 
 std::shared_ptr<void> CudaDevice::Allocate(size_t bytesize) {
-    auto deleter = [weak_pool = std::weak_ptr<MemoryPool>{device_memory_pool_}](void* ptr) {
+    auto deleter = [weak_pool = std::weak_ptr<MemoryPool>{device_memory_pool_}, counter = allocated_bytes_counter(), bytesize](void* ptr) {
         if (std::shared_ptr<MemoryPool> pool = weak_pool.lock()) {
             pool->FreeNoExcept(ptr);
         }
+        counter->Subtract(bytesize);
     };
-    return std::shared_ptr<void>{device_memory_pool_->Malloc(bytesize), std::move(deleter)};
+    void* ptr = device_memory_pool_->Malloc(bytesize);
+    allocated_bytes_counter()->Add(bytesize);
+    return std::shared_ptr<void>{ptr, std::move(deleter)};
 }
 
 std::shared_ptr<void> CudaDevice::AllocatePinnedMemory(size_t bytesize) {
@@ -86,7 +89,8 @@ void CudaDevice::MemoryCopyFrom(void* dst, const void* src, size_t bytesize, Dev
         CHAINERX_ASSERT(
                 nullptr != dynamic_cast<native::NativeDevice*>(&src_device) &&
                 "CudaDevice only supports copy between cuda or native devices.");
-        // Copy from native device
+        // Copy from native device, which may still be writing src if it executes kernels asynchronously
+        src_device.Synchronize();
         MemoryCopyFromHostAsync(dst, src, bytesize);
     }
 }
@@ -104,7 +108,8 @@ void CudaDevice::MemoryCopyTo(void* dst, const void* src, size_t bytesize, Devic
         CHAINERX_ASSERT(
                 nullptr != dynamic_cast<native::NativeDevice*>(&dst_device) &&
                 "CudaDevice only supports copy between cuda or native devices.");
-        // Copy to native device
+        // Copy to native device, which may still be using dst if it executes kernels asynchronously
+        dst_device.Synchronize();
         CheckCudaError(cudaMemcpy(dst, src, bytesize, cudaMemcpyDeviceToHost));
     }
 }
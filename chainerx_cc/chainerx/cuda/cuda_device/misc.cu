@@ -2,18 +2,24 @@
 
 #include <cmath>
 #include <cstdint>
+#include <type_traits>
+#include <vector>
 
 #include <cuda_runtime.h>
 
 #include "chainerx/array.h"
+#include "chainerx/backend_util.h"
 #include "chainerx/cuda/cuda_runtime.h"
 #include "chainerx/cuda/cuda_set_device_scope.h"
+#include "chainerx/cuda/data_type.cuh"
 #include "chainerx/cuda/elementwise.cuh"
+#include "chainerx/cuda/float16.cuh"
 #include "chainerx/cuda/kernel_regist.h"
 #include "chainerx/cuda/numeric.cuh"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/kernels/misc.h"
+#include "chainerx/macro.h"
 #include "chainerx/routines/type_util.h"
 
 namespace chainerx {
@@ -127,6 +133,98 @@ public:
 
 CHAINERX_CUDA_REGISTER_KERNEL(IfGreaterElseAAAAKernel, CudaIfGreaterElseAAAAKernel);
 
+struct PackBitsImpl {
+    __device__ void operator()(int64_t i, uint8_t& out) {
+        int64_t begin = i * 8;
+        int64_t end = begin + 8 < size ? begin + 8 : size;
+        uint8_t packed{0};
+        for (int64_t j = begin; j < end; ++j) {
+            packed |= static_cast<uint8_t>(static_cast<uint8_t>(x[j]) << (j - begin));
+        }
+        out = packed;
+    }
+    const bool* x;
+    int64_t size;
+};
+
+class CudaPackBitsKernel : public PackBitsKernel {
+public:
+    void Call(const Array& x, const Array& out) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, out);
+        CHAINERX_ASSERT(x.dtype() == Dtype::kBool);
+        CHAINERX_ASSERT(x.IsContiguous());
+        CHAINERX_ASSERT(out.dtype() == Dtype::kUInt8);
+        CHAINERX_ASSERT(out.ndim() == 1);
+        CudaSetDeviceScope scope{device.index()};
+        Elementwise<uint8_t>(PackBitsImpl{static_cast<const bool*>(internal::GetRawOffsetData(x)), x.GetTotalSize()}, out);
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(PackBitsKernel, CudaPackBitsKernel);
+
+struct UnpackBitsImpl {
+    __device__ void operator()(int64_t i, bool& out) { out = ((x[i / 8] >> (i % 8)) & 1U) != 0; }
+    const uint8_t* x;
+};
+
+class CudaUnpackBitsKernel : public UnpackBitsKernel {
+public:
+    void Call(const Array& x, const Array& out) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, out);
+        CHAINERX_ASSERT(x.dtype() == Dtype::kUInt8);
+        CHAINERX_ASSERT(x.IsContiguous());
+        CHAINERX_ASSERT(out.dtype() == Dtype::kBool);
+        CHAINERX_ASSERT(out.ndim() == 1);
+        CudaSetDeviceScope scope{device.index()};
+        Elementwise<bool>(UnpackBitsImpl{static_cast<const uint8_t*>(internal::GetRawOffsetData(x))}, out);
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(UnpackBitsKernel, CudaUnpackBitsKernel);
+
+// The inverse of a large loss scale is not representable in float16, hence float16 gradients are unscaled in float.
+template <typename T>
+struct UnscaleGradsImpl {
+    using CudaType = cuda_internal::DataType<T>;
+    using U = std::conditional_t<std::is_same<CudaType, cuda::Float16>::value, float, CudaType>;
+    __device__ void operator()(int64_t /*i*/, CudaType x, CudaType& out) {
+        out = CudaType{static_cast<U>(x) * inv_scale};
+        if (cuda::IsNan(out) || cuda::IsInf(out)) {
+            // All the threads write the same value.
+            *found = true;
+        }
+    }
+    U inv_scale;
+    bool* found;
+};
+
+class CudaUnscaleGradsKernel : public UnscaleGradsKernel {
+public:
+    void Call(const std::vector<Array>& xs, Scalar inv_scale, const std::vector<Array>& outs, const Array& found_non_finite) override {
+        CHAINERX_ASSERT(xs.size() == outs.size());
+        CHAINERX_ASSERT(found_non_finite.dtype() == Dtype::kBool);
+        CHAINERX_ASSERT(found_non_finite.ndim() == 0);
+        Device& device = found_non_finite.device();
+        CudaSetDeviceScope scope{device.index()};
+        auto* found = static_cast<bool*>(internal::GetRawOffsetData(found_non_finite));
+        for (size_t i = 0; i < xs.size(); ++i) {
+            const Array& x = xs[i];
+            const Array& out = outs[i];
+            device.CheckDevicesCompatible(x, out, found_non_finite);
+            CHAINERX_ASSERT(x.dtype() == out.dtype());
+            VisitFloatingPointDtype(x.dtype(), [&](auto pt) {
+                using T = typename decltype(pt)::type;
+                using U = typename UnscaleGradsImpl<T>::U;
+                Elementwise<const T, T>(UnscaleGradsImpl<T>{static_cast<U>(inv_scale), found}, x, out);
+            });
+        }
+    }
+};
+
+CHAINERX_CUDA_REGISTER_KERNEL(UnscaleGradsKernel, CudaUnscaleGradsKernel);
+
 }  // namespace
 }  // namespace cuda
 }  // namespace chainerx
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -19,6 +21,41 @@ namespace chainerx {
 
 class Array;
 
+namespace internal {
+
+// Counts the bytes of the memory allocated on a device and their high watermark.
+//
+// This class is thread safe.
+class AllocatedBytesCounter {
+public:
+    void Add(size_t bytesize) {
+        size_t allocated_bytes = allocated_bytes_.fetch_add(bytesize, std::memory_order_relaxed) + bytesize;
+        RaisePeak(allocated_bytes);
+    }
+
+    void Subtract(size_t bytesize) { allocated_bytes_.fetch_sub(bytesize, std::memory_order_relaxed); }
+
+    size_t allocated_bytes() const { return allocated_bytes_.load(std::memory_order_relaxed); }
+
+    size_t peak_allocated_bytes() const { return peak_allocated_bytes_.load(std::memory_order_relaxed); }
+
+    // Sets the peak to the current number of allocated bytes and returns the previous peak.
+    size_t ResetPeak() { return peak_allocated_bytes_.exchange(allocated_bytes(), std::memory_order_relaxed); }
+
+    // Sets the peak to the given number of bytes if it is larger than the current peak.
+    void RaisePeak(size_t bytesize) {
+        size_t peak = peak_allocated_bytes_.load(std::memory_order_relaxed);
+        while (peak < bytesize && !peak_allocated_bytes_.compare_exchange_weak(peak, bytesize, std::memory_order_relaxed)) {
+        }
+    }
+
+private:
+    std::atomic<size_t> allocated_bytes_{0};
+    std::atomic<size_t> peak_allocated_bytes_{0};
+};
+
+}  // namespace internal
+
 // Device base class.
 // Note that these member functions may be called from the framework or user code.
 class Device {
@@ -31,6 +68,8 @@ public:
     Device& operator=(Device&&) = delete;
 
     // Allocates a memory chunk on this device.
+    //
+    // Implementations are expected to count the allocated bytes with allocated_bytes_counter().
     virtual std::shared_ptr<void> Allocate(size_t bytesize) = 0;
 
     // Makes an array data pointer from a foreign pointer without copying.
@@ -70,6 +109,9 @@ public:
 
     virtual void Synchronize() = 0;
 
+    // Returns the queue to which the kernel calls on this device are deferred if it executes kernels asynchronously, or nullptr otherwise.
+    virtual internal::KernelQueue* kernel_queue() { return nullptr; }
+
     // TODO(sonots): optimize string concat
     std::string name() const { return backend_.GetName() + ":" + std::to_string(index_); }
 
@@ -77,6 +119,18 @@ public:
     Context& context() const { return backend_.context(); }
     int index() const { return index_; }
 
+    // Returns the number of bytes allocated by Allocate() that have not been freed yet.
+    size_t allocated_bytes() const { return allocated_bytes_counter_->allocated_bytes(); }
+
+    // Returns the largest value of allocated_bytes() since the device was created or the peak was last reset.
+    size_t peak_allocated_bytes() const { return allocated_bytes_counter_->peak_allocated_bytes(); }
+
+    // Resets the peak to the current number of allocated bytes and returns the previous peak.
+    size_t ResetPeakAllocatedBytes() { return allocated_bytes_counter_->ResetPeak(); }
+
+    // Raises the peak to the given number of bytes if it is lower, e.g. to restore the peak after a temporary reset.
+    void RaisePeakAllocatedBytes(size_t bytesize) { allocated_bytes_counter_->RaisePeak(bytesize); }
+
     // Throws an exception if array devices are incompatible, else does nothing.
     template <typename... Arrays>
     void CheckDevicesCompatible(const Array& first, const Arrays&... rest) {
@@ -89,9 +143,14 @@ public:
 protected:
     Device(Backend& backend, int index) : backend_{backend}, index_{index} {}
 
+    // Returns the counter of the allocated bytes.
+    // Deleters of the allocated memory should hold a copy of the pointer since the memory may outlive the device.
+    const std::shared_ptr<internal::AllocatedBytesCounter>& allocated_bytes_counter() const { return allocated_bytes_counter_; }
+
 private:
     Backend& backend_;
     int index_;
+    std::shared_ptr<internal::AllocatedBytesCounter> allocated_bytes_counter_{std::make_shared<internal::AllocatedBytesCounter>()};
 };
 
 namespace internal {
@@ -0,0 +1,183 @@
+#include "chainerx/graph_node_pool.h"
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+#include "chainerx/macro.h"
+
+namespace chainerx {
+namespace internal {
+namespace {
+
+constexpr size_t kMaxBlockSize = 1024;
+constexpr size_t kSizeClassCount = kMaxBlockSize / kGraphNodeMemoryAlignment;
+constexpr size_t kChunkSize = 64 * 1024;
+
+// Maximum number of free blocks of a size class kept by a thread. Excess blocks are handed over to the shared free lists so that blocks
+// freed on threads that rarely allocate, e.g. the workers of the backward engine, can be reused by other threads.
+constexpr size_t kMaxThreadFreeBlockCount = 1024;
+
+struct FreeBlock {
+    FreeBlock* next;
+};
+
+size_t GetSizeClass(size_t size) {
+    CHAINERX_ASSERT(0 < size && size <= kMaxBlockSize);
+    return (size + kGraphNodeMemoryAlignment - 1) / kGraphNodeMemoryAlignment - 1;
+}
+
+size_t GetBlockSize(size_t size_class) { return (size_class + 1) * kGraphNodeMemoryAlignment; }
+
+// Free lists shared by all the threads.
+class SharedFreeLists {
+public:
+    // Prepends a linked list of free blocks.
+    void Push(size_t size_class, FreeBlock* head, FreeBlock* tail) {
+        std::lock_guard<std::mutex> lock{mutex_};
+        tail->next = heads_[size_class];
+        heads_[size_class] = head;
+    }
+
+    // Takes all the free blocks of the size class. Returns nullptr if there are none.
+    FreeBlock* PopAll(size_t size_class) {
+        std::lock_guard<std::mutex> lock{mutex_};
+        FreeBlock* head = heads_[size_class];
+        heads_[size_class] = nullptr;
+        return head;
+    }
+
+private:
+    std::mutex mutex_;
+    std::array<FreeBlock*, kSizeClassCount> heads_{};
+};
+
+SharedFreeLists& GetSharedFreeLists() {
+    // Never destroyed, since graph nodes may be freed during the destruction of static objects.
+    static auto* shared_free_lists = new SharedFreeLists{};
+    return *shared_free_lists;
+}
+
+thread_local bool t_thread_free_lists_destroyed{false};
+
+// Free lists and the chunk being carved of the current thread.
+class ThreadFreeLists {
+public:
+    ThreadFreeLists() = default;
+
+    ~ThreadFreeLists() {
+        for (size_t size_class = 0; size_class < kSizeClassCount; ++size_class) {
+            ReleaseToSharedFreeLists(size_class);
+        }
+        t_thread_free_lists_destroyed = true;
+    }
+
+    ThreadFreeLists(const ThreadFreeLists&) = delete;
+    ThreadFreeLists(ThreadFreeLists&&) = delete;
+    ThreadFreeLists& operator=(const ThreadFreeLists&) = delete;
+    ThreadFreeLists& operator=(ThreadFreeLists&&) = delete;
+
+    void* Allocate(size_t size_class) {
+        FreeList& free_list = free_lists_[size_class];
+        if (free_list.head == nullptr) {
+            free_list.head = GetSharedFreeLists().PopAll(size_class);
+            free_list.count = 0;  // Unknown; only used to bound the length of the list.
+        }
+        if (free_list.head != nullptr) {
+            FreeBlock* block = free_list.head;
+            free_list.head = block->next;
+            if (free_list.count > 0) {
+                --free_list.count;
+            }
+            return block;
+        }
+        return Carve(GetBlockSize(size_class));
+    }
+
+    void Free(void* ptr, size_t size_class) {
+        FreeList& free_list = free_lists_[size_class];
+        auto* block = static_cast<FreeBlock*>(ptr);
+        block->next = free_list.head;
+        free_list.head = block;
+        if (++free_list.count > kMaxThreadFreeBlockCount) {
+            ReleaseToSharedFreeLists(size_class);
+        }
+    }
+
+private:
+    struct FreeList {
+        FreeBlock* head{nullptr};
+        size_t count{0};
+    };
+
+    void* Carve(size_t block_size) {
+        if (chunk_remaining_ < block_size) {
+            // Chunks are never freed; the blocks carved from them may be owned by other threads.
+            chunk_ = static_cast<char*>(::operator new(kChunkSize));
+            chunk_remaining_ = kChunkSize;
+        }
+        void* ptr = chunk_;
+        chunk_ += block_size;
+        chunk_remaining_ -= block_size;
+        return ptr;
+    }
+
+    void ReleaseToSharedFreeLists(size_t size_class) {
+        FreeList& free_list = free_lists_[size_class];
+        if (free_list.head == nullptr) {
+            return;
+        }
+        FreeBlock* tail = free_list.head;
+        while (tail->next != nullptr) {
+            tail = tail->next;
+        }
+        GetSharedFreeLists().Push(size_class, free_list.head, tail);
+        free_list.head = nullptr;
+        free_list.count = 0;
+    }
+
+    std::array<FreeList, kSizeClassCount> free_lists_{};
+    char* chunk_{nullptr};
+    size_t chunk_remaining_{0};
+};
+
+// Returns the free lists of the current thread, or nullptr if they have already been destroyed at thread exit.
+ThreadFreeLists* GetThreadFreeLists() {
+    if (t_thread_free_lists_destroyed) {
+        return nullptr;
+    }
+    thread_local ThreadFreeLists t_thread_free_lists{};
+    return &t_thread_free_lists;
+}
+
+}  // namespace
+
+void* AllocateGraphNodeMemory(size_t size) {
+    if (size > kMaxBlockSize) {
+        return ::operator new(size);
+    }
+    size_t size_class = GetSizeClass(size);
+    if (ThreadFreeLists* thread_free_lists = GetThreadFreeLists()) {
+        return thread_free_lists->Allocate(size_class);
+    }
+    // Any block of the right size can be added to the pool when freed.
+    return ::operator new(GetBlockSize(size_class));
+}
+
+void FreeGraphNodeMemory(void* ptr, size_t size) {
+    if (size > kMaxBlockSize) {
+        ::operator delete(ptr);
+        return;
+    }
+    size_t size_class = GetSizeClass(size);
+    if (ThreadFreeLists* thread_free_lists = GetThreadFreeLists()) {
+        thread_free_lists->Free(ptr, size_class);
+        return;
+    }
+    auto* block = static_cast<FreeBlock*>(ptr);
+    GetSharedFreeLists().Push(size_class, block, block);
+}
+
+}  // namespace internal
+}  // namespace chainerx
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace chainerx {
+namespace internal {
+
+// Alignment of the memory returned by AllocateGraphNodeMemory().
+constexpr size_t kGraphNodeMemoryAlignment = alignof(std::max_align_t);
+
+// Allocates memory for a graph node from a pool of fixed-size blocks.
+//
+// Freed blocks are kept in a free list of the calling thread and reused by subsequent allocations of the same size class, so that
+// recording and releasing graphs of small ops does not go through the general-purpose allocator. The memory of the pool is never
+// returned to the system. Requests larger than the largest block size are forwarded to the global operator new.
+void* AllocateGraphNodeMemory(size_t size);
+
+// Frees memory allocated by AllocateGraphNodeMemory(). The size must be equal to the one given on allocation.
+// The memory may be freed on a thread different from the one that allocated it.
+void FreeGraphNodeMemory(void* ptr, size_t size);
+
+// Allocator that draws memory from the graph node pool, to be used with std::allocate_shared.
+template <typename T>
+class GraphNodeAllocator {
+public:
+    using value_type = T;
+
+    GraphNodeAllocator() = default;
+
+    template <typename U>
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    GraphNodeAllocator(const GraphNodeAllocator<U>& /*other*/) {}
+
+    T* allocate(size_t n) {
+        static_assert(alignof(T) <= kGraphNodeMemoryAlignment, "Over-aligned types cannot be allocated from the graph node pool.");
+        return static_cast<T*>(AllocateGraphNodeMemory(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, size_t n) { FreeGraphNodeMemory(ptr, n * sizeof(T)); }
+
+    template <typename U>
+    bool operator==(const GraphNodeAllocator<U>& /*other*/) const {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const GraphNodeAllocator<U>& /*other*/) const {
+        return false;
+    }
+};
+
+// Creates a shared object whose memory, including the control block, is drawn from the graph node pool.
+template <typename T, typename... Args>
+std::shared_ptr<T> MakeSharedGraphNode(Args&&... args) {
+    return std::allocate_shared<T>(GraphNodeAllocator<T>{}, std::forward<Args>(args)...);
+}
+
+}  // namespace internal
+}  // namespace chainerx
@@ -0,0 +1,109 @@
+#include "chainerx/graph_node_pool.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace chainerx {
+namespace internal {
+namespace {
+
+TEST(GraphNodePoolTest, AllocateAligned) {
+    for (size_t size : {1, 8, 16, 100, 512, 1024, 1025, 4096}) {
+        void* ptr = AllocateGraphNodeMemory(size);
+        ASSERT_NE(nullptr, ptr);
+        EXPECT_EQ(0U, reinterpret_cast<uintptr_t>(ptr) % kGraphNodeMemoryAlignment);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        // The whole requested range must be writable.
+        std::memset(ptr, 0xff, size);
+        FreeGraphNodeMemory(ptr, size);
+    }
+}
+
+TEST(GraphNodePoolTest, ReuseFreedBlock) {
+    void* ptr1 = AllocateGraphNodeMemory(100);
+    FreeGraphNodeMemory(ptr1, 100);
+
+    // A block of the same size class is taken from the free list of the thread.
+    void* ptr2 = AllocateGraphNodeMemory(97);
+    EXPECT_EQ(ptr1, ptr2);
+    FreeGraphNodeMemory(ptr2, 97);
+}
+
+TEST(GraphNodePoolTest, DistinctBlocks) {
+    constexpr size_t kCount = 10000;
+    constexpr size_t kSize = 48;
+    std::vector<void*> ptrs;
+    for (size_t i = 0; i < kCount; ++i) {
+        void* ptr = AllocateGraphNodeMemory(kSize);
+        std::memset(ptr, static_cast<int>(i % 256), kSize);
+        ptrs.emplace_back(ptr);
+    }
+    for (size_t i = 0; i < kCount; ++i) {
+        const auto* bytes = static_cast<const unsigned char*>(ptrs[i]);
+        EXPECT_EQ(i % 256, bytes[0]);
+        EXPECT_EQ(i % 256, bytes[kSize - 1]);
+    }
+    for (void* ptr : ptrs) {
+        FreeGraphNodeMemory(ptr, kSize);
+    }
+}
+
+TEST(GraphNodePoolTest, FreeOnAnotherThread) {
+    constexpr size_t kCount = 5000;
+    constexpr size_t kSize = 64;
+    std::vector<void*> ptrs;
+    for (size_t i = 0; i < kCount; ++i) {
+        ptrs.emplace_back(AllocateGraphNodeMemory(kSize));
+    }
+
+    std::thread thread{[&ptrs]() {
+        for (void* ptr : ptrs) {
+            FreeGraphNodeMemory(ptr, kSize);
+        }
+    }};
+    thread.join();
+
+    // Blocks handed over to the shared free lists can be allocated again.
+    for (size_t i = 0; i < kCount; ++i) {
+        ptrs[i] = AllocateGraphNodeMemory(kSize);
+        std::memset(ptrs[i], 0, kSize);
+    }
+    for (void* ptr : ptrs) {
+        FreeGraphNodeMemory(ptr, kSize);
+    }
+}
+
+TEST(GraphNodePoolTest, MakeSharedGraphNode) {
+    struct Node {
+        Node(int value, std::shared_ptr<int> counter) : value{value}, counter{std::move(counter)} { ++*this->counter; }
+        ~Node() { --*counter; }
+        Node(const Node&) = delete;
+        Node(Node&&) = delete;
+        Node& operator=(const Node&) = delete;
+        Node& operator=(Node&&) = delete;
+
+        int value;
+        std::shared_ptr<int> counter;
+    };
+
+    auto counter = std::make_shared<int>(0);
+    {
+        std::shared_ptr<Node> node = MakeSharedGraphNode<Node>(3, counter);
+        EXPECT_EQ(3, node->value);
+        EXPECT_EQ(1, *counter);
+
+        std::weak_ptr<Node> weak_node = node;
+        node.reset();
+        EXPECT_TRUE(weak_node.expired());
+        EXPECT_EQ(0, *counter);
+    }
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace chainerx
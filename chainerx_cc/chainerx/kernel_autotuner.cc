@@ -0,0 +1,135 @@
+#include "chainerx/kernel_autotuner.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+
+#include <absl/types/optional.h>
+
+#include "chainerx/array.h"
+#include "chainerx/backend.h"
+#include "chainerx/device.h"
+#include "chainerx/error.h"
+#include "chainerx/kernels/creation.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/strides.h"
+#include "chainerx/util.h"
+
+namespace chainerx {
+namespace internal {
+
+constexpr const char* KernelAutotuner::kEnableEnvVarName;
+constexpr const char* KernelAutotuner::kCacheFileEnvVarName;
+constexpr int KernelAutotuner::kTrialCount;
+
+KernelAutotuner::KernelAutotuner(bool enabled, std::string cache_file_path)
+    : enabled_{enabled}, cache_file_path_{std::move(cache_file_path)} {
+    if (cache_file_path_.empty()) {
+        return;
+    }
+    // Each line is a signature and the name of the chosen candidate separated by a tab. Later lines take precedence.
+    std::ifstream ifs{cache_file_path_};
+    std::string line;
+    while (std::getline(ifs, line)) {
+        size_t pos = line.rfind('\t');
+        if (pos == std::string::npos || pos == 0 || pos + 1 == line.size()) {
+            continue;
+        }
+        choices_[line.substr(0, pos)] = line.substr(pos + 1);
+    }
+}
+
+absl::optional<std::string> KernelAutotuner::Find(const std::string& signature) const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    auto it = choices_.find(signature);
+    if (it == choices_.end()) {
+        return absl::nullopt;
+    }
+    return it->second;
+}
+
+void KernelAutotuner::Add(const std::string& signature, const std::string& name) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    auto pair = choices_.emplace(signature, name);
+    if (!pair.second) {
+        if (pair.first->second == name) {
+            // Tuned concurrently by another thread.
+            return;
+        }
+        pair.first->second = name;
+    }
+    if (!cache_file_path_.empty()) {
+        std::ofstream ofs{cache_file_path_, std::ios::app};
+        ofs << signature << '\t' << name << '\n';
+    }
+}
+
+size_t KernelAutotuner::size() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return choices_.size();
+}
+
+namespace {
+
+std::atomic<KernelAutotuner*> g_kernel_autotuner{nullptr};
+
+KernelAutotuner& GetDefaultKernelAutotuner() {
+    static KernelAutotuner autotuner{GetEnv(KernelAutotuner::kEnableEnvVarName).value_or("") == "1",
+                                     GetEnv(KernelAutotuner::kCacheFileEnvVarName).value_or("")};
+    return autotuner;
+}
+
+}  // namespace
+
+KernelAutotuner& GetKernelAutotuner() {
+    if (KernelAutotuner* autotuner = g_kernel_autotuner.load(std::memory_order_acquire)) {
+        return *autotuner;
+    }
+    return GetDefaultKernelAutotuner();
+}
+
+void SetKernelAutotuner(KernelAutotuner* autotuner) { g_kernel_autotuner.store(autotuner, std::memory_order_release); }
+
+void AppendKernelArgumentSignature(std::ostream& os, const Array& array) {
+    os << array.dtype() << array.shape() << array.strides();
+}
+
+Array CloneKernelArgument(const Array& array) {
+    const Strides& strides = array.strides();
+    Array clone = std::any_of(strides.begin(), strides.end(), [](int64_t stride) { return stride < 0; })
+                          ? chainerx::Empty(array.shape(), array.dtype(), array.device())
+                          : internal::Empty(array.shape(), array.dtype(), strides, array.device());
+    array.device().backend().CallKernel<CopyKernel>(array, clone);
+    return clone;
+}
+
+absl::optional<double> MeasureKernelCall(Device* device, const std::function<void()>& call) {
+    double shortest_seconds{std::numeric_limits<double>::max()};
+    try {
+        for (int i = 0; i <= KernelAutotuner::kTrialCount; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            call();
+            if (device != nullptr) {
+                device->Synchronize();
+            }
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            if (i > 0) {
+                shortest_seconds = std::min(shortest_seconds, elapsed.count());
+            }
+        }
+    } catch (const ChainerxError&) {
+        return absl::nullopt;
+    }
+    return shortest_seconds;
+}
+
+}  // namespace internal
+}  // namespace chainerx
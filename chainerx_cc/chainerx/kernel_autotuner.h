@@ -0,0 +1,270 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <absl/types/optional.h>
+#include <absl/utility/utility.h>
+
+#include "chainerx/array_fwd.h"
+#include "chainerx/constant.h"
+#include "chainerx/kernel_call_recorder.h"
+#include "chainerx/kernel_queue.h"
+#include "chainerx/kernel_registry.h"
+#include "chainerx/stack_vector.h"
+
+namespace chainerx {
+
+class Device;
+
+namespace internal {
+
+// Chooses the fastest of the candidates of a key kernel, including the registered kernel, for each signature of kernel calls. A signature
+// consists of the backend, the key kernel, and the dtypes, shapes and strides of the array arguments and the values of the other integral,
+// enumeration or dimension arguments.
+//
+// The candidates are timed on copies of the arguments on the first call with a signature, and the fastest one is used for the subsequent
+// calls with the same signature, like the algorithm caches of cuDNN convolutions. The choices can be persisted to a file, which is loaded
+// on construction and to which new choices are appended, so that subsequent processes start tuned.
+//
+// This class is thread safe.
+class KernelAutotuner {
+public:
+    // Name of the environment variable which enables the default autotuner of the kernel calls if set to "1".
+    static constexpr const char* kEnableEnvVarName = "CHAINERX_KERNEL_AUTOTUNE";
+
+    // Name of the environment variable specifying the cache file of the default autotuner of the kernel calls.
+    static constexpr const char* kCacheFileEnvVarName = "CHAINERX_KERNEL_AUTOTUNE_CACHE";
+
+    // Number of timed calls of each candidate, following a call to warm up. The shortest time is taken.
+    static constexpr int kTrialCount = 3;
+
+    // Loads the choices from the cache file if given and exists.
+    explicit KernelAutotuner(bool enabled = false, std::string cache_file_path = {});
+
+    ~KernelAutotuner() = default;
+
+    KernelAutotuner(const KernelAutotuner&) = delete;
+    KernelAutotuner(KernelAutotuner&&) = delete;
+    KernelAutotuner& operator=(const KernelAutotuner&) = delete;
+    KernelAutotuner& operator=(KernelAutotuner&&) = delete;
+
+    bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    void set_enabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+
+    // Returns the name of the candidate chosen for a signature, if any.
+    absl::optional<std::string> Find(const std::string& signature) const;
+
+    // Records the candidate chosen for a signature, and appends it to the cache file if any. Errors on writing the file are ignored.
+    void Add(const std::string& signature, const std::string& name);
+
+    // Returns the number of the signatures with choices.
+    size_t size() const;
+
+private:
+    std::atomic<bool> enabled_;
+
+    std::string cache_file_path_;
+
+    mutable std::mutex mutex_;
+
+    std::unordered_map<std::string, std::string> choices_;
+};
+
+// Returns the autotuner used by the kernel calls. It is the one installed by SetKernelAutotuner() if any, or otherwise the default one,
+// which is configured by the environment variables on the first call.
+KernelAutotuner& GetKernelAutotuner();
+
+// Installs an autotuner used by the kernel calls instead of the default one. Pass nullptr to uninstall.
+// The autotuner must outlive the kernel calls made until it is uninstalled.
+void SetKernelAutotuner(KernelAutotuner* autotuner);
+
+// Appends the part of a kernel call signature for an argument. Values of types other than the ones below are not part of the signature.
+template <typename T, typename Enable = void>
+struct KernelArgumentSignature {
+    static void Append(std::ostream& /*os*/, const T& /*value*/) {}
+};
+
+template <typename T>
+struct KernelArgumentSignature<T, std::enable_if_t<std::is_integral<T>::value>> {
+    static void Append(std::ostream& os, T value) { os << +value; }
+};
+
+template <typename T>
+struct KernelArgumentSignature<T, std::enable_if_t<std::is_enum<T>::value>> {
+    static void Append(std::ostream& os, T value) { os << static_cast<int64_t>(value); }
+};
+
+// Shapes, strides, dims and axes.
+template <typename T>
+struct KernelArgumentSignature<
+        T,
+        std::enable_if_t<
+                std::is_base_of<StackVector<int64_t, kMaxNdim>, T>::value || std::is_base_of<StackVector<int8_t, kMaxNdim>, T>::value>> {
+    static void Append(std::ostream& os, const T& value) {
+        os << '[';
+        for (auto v : value) {
+            os << +v << ',';
+        }
+        os << ']';
+    }
+};
+
+void AppendKernelArgumentSignature(std::ostream& os, const Array& array);
+
+template <typename T>
+void AppendKernelArgumentSignature(std::ostream& os, const T& value) {
+    KernelArgumentSignature<T>::Append(os, value);
+}
+
+template <typename T>
+void AppendKernelArgumentSignature(std::ostream& os, const absl::optional<T>& value);
+
+template <typename T>
+void AppendKernelArgumentSignature(std::ostream& os, const std::vector<T>& values);
+
+template <typename T>
+void AppendKernelArgumentSignature(std::ostream& os, const absl::optional<T>& value) {
+    if (value.has_value()) {
+        AppendKernelArgumentSignature(os, *value);
+    } else {
+        os << "none";
+    }
+}
+
+template <typename T>
+void AppendKernelArgumentSignature(std::ostream& os, const std::vector<T>& values) {
+    os << '{';
+    for (const T& value : values) {
+        AppendKernelArgumentSignature(os, value);
+        os << ',';
+    }
+    os << '}';
+}
+
+template <typename... Args>
+std::string GetKernelCallSignature(const std::string& backend_name, const char* kernel_name, const Args&... args) {
+    std::ostringstream os;
+    os << backend_name << ' ' << kernel_name << '(';
+    (void)std::initializer_list<int>{(AppendKernelArgumentSignature(os, args), os << ';', 0)...};
+    os << ')';
+    return os.str();
+}
+
+// Returns a copy of a kernel argument to time candidates with, so that the arguments of the actual call are not overwritten. Arrays are
+// copied to new buffers with the same strides unless they are negative.
+Array CloneKernelArgument(const Array& array);
+
+template <typename T>
+T CloneKernelArgument(const T& value) {
+    return value;
+}
+
+template <typename T>
+absl::optional<T> CloneKernelArgument(const absl::optional<T>& value);
+
+template <typename T>
+std::vector<T> CloneKernelArgument(const std::vector<T>& values);
+
+template <typename T>
+absl::optional<T> CloneKernelArgument(const absl::optional<T>& value) {
+    return value.has_value() ? absl::optional<T>{CloneKernelArgument(*value)} : absl::nullopt;
+}
+
+template <typename T>
+std::vector<T> CloneKernelArgument(const std::vector<T>& values) {
+    std::vector<T> clones;
+    clones.reserve(values.size());
+    for (const T& value : values) {
+        clones.emplace_back(CloneKernelArgument(value));
+    }
+    return clones;
+}
+
+// Returns the shortest time in seconds of the trials of a kernel call, including the completion of the work on the device if given, or
+// nullopt if the call throws ChainerxError, e.g. if the candidate does not support the arguments.
+absl::optional<double> MeasureKernelCall(Device* device, const std::function<void()>& call);
+
+// Chooses the kernel to call among the registered kernel and its candidates.
+// Calls with results are not tuned, since their arguments, e.g. states for the backward kernels, may not be copyable.
+template <typename Result>
+struct KernelAutotuning {
+    template <typename KeyKernelType, typename... Args>
+    static KeyKernelType& Select(
+            KernelRegistry& /*kernel_registry*/, const std::string& /*backend_name*/, KeyKernelType& kernel, const Args&... /*args*/) {
+        return kernel;
+    }
+};
+
+template <>
+struct KernelAutotuning<void> {
+    template <typename KeyKernelType, typename... Args>
+    static KeyKernelType& Select(
+            KernelRegistry& kernel_registry, const std::string& backend_name, KeyKernelType& kernel, const Args&... args) {
+        KernelAutotuner& autotuner = GetKernelAutotuner();
+        if (!autotuner.enabled()) {
+            return kernel;
+        }
+        std::vector<KernelCandidate> candidates = kernel_registry.GetKernelCandidates<KeyKernelType>();
+        if (candidates.empty()) {
+            return kernel;
+        }
+        candidates.insert(candidates.begin(), KernelCandidate{kDefaultKernelCandidateName, &kernel});
+
+        std::string signature = GetKernelCallSignature(backend_name, GetKeyKernelName<KeyKernelType>(), args...);
+        if (absl::optional<std::string> name = autotuner.Find(signature)) {
+            for (const KernelCandidate& candidate : candidates) {
+                if (candidate.name == *name) {
+                    return static_cast<KeyKernelType&>(*candidate.kernel);
+                }
+            }
+            // The chosen candidate is not registered in this process, e.g. if the cache file was written by another build. Tune again.
+        }
+
+        // The candidates are timed synchronously and are not recorded.
+        if (KernelQueue* queue = GetKernelQueue(args...)) {
+            queue->Wait();
+        }
+        absl::optional<KernelCallRecorderPauseScope> recorder_pause_scope{};
+        if (KernelCallRecorder* recorder = GetKernelCallRecorder()) {
+            recorder_pause_scope.emplace(*recorder);
+        }
+        SynchronousKernelCallScope synchronous_scope{};
+
+        Device* device = GetKernelDevice(args...);
+        std::tuple<std::decay_t<Args>...> trial_args{CloneKernelArgument(args)...};
+        absl::optional<size_t> best_index{};
+        double best_seconds{};
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            auto& candidate_kernel = static_cast<KeyKernelType&>(*candidates[i].kernel);
+            absl::optional<double> seconds = MeasureKernelCall(device, [&candidate_kernel, &trial_args]() {
+                absl::apply([&candidate_kernel](const auto&... a) { candidate_kernel.Call(a...); }, trial_args);
+            });
+            if (seconds.has_value() && (!best_index.has_value() || *seconds < best_seconds)) {
+                best_index = i;
+                best_seconds = *seconds;
+            }
+        }
+        if (!best_index.has_value()) {
+            // No candidate supports the arguments. The error is reported by the actual call.
+            return kernel;
+        }
+        autotuner.Add(signature, candidates[*best_index].name);
+        return static_cast<KeyKernelType&>(*candidates[*best_index].kernel);
+    }
+};
+
+}  // namespace internal
+}  // namespace chainerx
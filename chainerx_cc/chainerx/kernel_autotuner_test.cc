@@ -0,0 +1,190 @@
+#include "chainerx/kernel_autotuner.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <absl/types/optional.h>
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/backend.h"
+#include "chainerx/context.h"
+#include "chainerx/device.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dims.h"
+#include "chainerx/error.h"
+#include "chainerx/kernel.h"
+#include "chainerx/kernel_registry.h"
+#include "chainerx/native/native_backend.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/linalg.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace {
+
+class TunedKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, const Array& out) = 0;
+};
+
+std::atomic<int> g_slow_call_count{0};
+
+class SlowTunedKernel : public TunedKernel {
+public:
+    void Call(const Array& /*x*/, const Array& out) override {
+        ++g_slow_call_count;
+        std::this_thread::sleep_for(std::chrono::milliseconds{2});
+        out.Fill(1);
+    }
+};
+
+class FastTunedKernel : public TunedKernel {
+public:
+    void Call(const Array& /*x*/, const Array& out) override { out.Fill(2); }
+};
+
+class UnsupportedTunedKernel : public TunedKernel {
+public:
+    void Call(const Array& /*x*/, const Array& /*out*/) override { throw DtypeError{"Unsupported."}; }
+};
+
+}  // namespace
+
+namespace internal {
+CHAINERX_REGISTER_KEY_KERNEL(TunedKernel, "tuned");
+}  // namespace internal
+
+namespace internal {
+namespace {
+
+// Installs an autotuner used by the kernel calls during its lifetime, so that the tests neither depend on nor modify the choices and the
+// cache file of the default autotuner.
+class KernelAutotunerScope {
+public:
+    explicit KernelAutotunerScope(KernelAutotuner& autotuner) : previous_autotuner_{GetKernelAutotuner()} {
+        SetKernelAutotuner(&autotuner);
+    }
+
+    ~KernelAutotunerScope() { SetKernelAutotuner(&previous_autotuner_); }
+
+    KernelAutotunerScope(const KernelAutotunerScope&) = delete;
+    KernelAutotunerScope(KernelAutotunerScope&&) = delete;
+    KernelAutotunerScope& operator=(const KernelAutotunerScope&) = delete;
+    KernelAutotunerScope& operator=(KernelAutotunerScope&&) = delete;
+
+private:
+    KernelAutotuner& previous_autotuner_;
+};
+
+class KernelAutotunerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        device_session_.emplace(DeviceId{native::NativeBackend::kDefaultName, 0});
+        KernelRegistry& kernel_registry = device_session_->device().backend().kernel_registry();
+        kernel_registry.RegisterKernel<TunedKernel, SlowTunedKernel>();
+        kernel_registry.RegisterKernelCandidate<TunedKernel, FastTunedKernel>("fast");
+        kernel_registry.RegisterKernelCandidate<TunedKernel, UnsupportedTunedKernel>("unsupported");
+    }
+
+    void TearDown() override { device_session_.reset(); }
+
+    Backend& backend() { return device_session_->device().backend(); }
+
+private:
+    absl::optional<testing::DeviceSession> device_session_;
+};
+
+TEST_F(KernelAutotunerTest, Select) {
+    KernelAutotuner autotuner{true};
+    KernelAutotunerScope scope{autotuner};
+    Array x = testing::BuildArray({2, 3}).WithLinearData<float>();
+    Array out = testing::BuildArray({2, 3}).WithData<float>({0, 0, 0, 0, 0, 0});
+    std::string signature = GetKernelCallSignature(backend().GetName(), "tuned", x, out);
+
+    g_slow_call_count = 0;
+    backend().CallKernel<TunedKernel>(x, out);
+    EXPECT_ARRAY_EQ(FullLike(out, 2.0f), out);
+    EXPECT_EQ(absl::optional<std::string>{"fast"}, autotuner.Find(signature));
+    // The registered kernel was timed on copies of the arguments.
+    EXPECT_EQ(1 + KernelAutotuner::kTrialCount, g_slow_call_count);
+
+    // The choice is reused.
+    out.Fill(0);
+    backend().CallKernel<TunedKernel>(x, out);
+    EXPECT_ARRAY_EQ(FullLike(out, 2.0f), out);
+    EXPECT_EQ(1 + KernelAutotuner::kTrialCount, g_slow_call_count);
+}
+
+TEST_F(KernelAutotunerTest, Disabled) {
+    KernelAutotuner autotuner{false};
+    KernelAutotunerScope scope{autotuner};
+    Array x = testing::BuildArray({3, 4}).WithLinearData<float>();
+    Array out = testing::BuildArray({3, 4}).WithLinearData<float>();
+
+    backend().CallKernel<TunedKernel>(x, out);
+    EXPECT_ARRAY_EQ(FullLike(out, 1.0f), out);
+    EXPECT_EQ(0U, autotuner.size());
+}
+
+TEST_F(KernelAutotunerTest, SelectDot) {
+    KernelAutotuner autotuner{true};
+    KernelAutotunerScope scope{autotuner};
+    Array a = testing::BuildArray({2, 3}).WithLinearData<float>(1.0f);
+    Array b = testing::BuildArray({3, 2}).WithLinearData<float>(1.0f);
+    Array e = testing::BuildArray({2, 2}).WithData<float>({22.0f, 28.0f, 49.0f, 64.0f});
+
+    // Either candidate computes the same product.
+    EXPECT_ARRAY_EQ(e, Dot(a, b));
+    EXPECT_ARRAY_EQ(e, Dot(a, b));
+}
+
+TEST(KernelAutotunerSignatureTest, GetKernelCallSignature) {
+    testing::DeviceSession device_session{DeviceId{native::NativeBackend::kDefaultName, 0}};
+    Array a = testing::BuildArray({2, 3}).WithLinearData<float>();
+    Array b = testing::BuildArray({2, 3}).WithLinearData<float>(1.0f);
+    Array padded = testing::BuildArray({2, 3}).WithLinearData<float>().WithPadding(1);
+    Array c = testing::BuildArray({3, 2}).WithLinearData<float>();
+
+    auto signature = [](const Array& x, const Dims& dims, int n) { return GetKernelCallSignature("native", "tuned", x, dims, n, 1.5); };
+    EXPECT_EQ(signature(a, {1, 2}, 3), signature(b, {1, 2}, 3));
+    EXPECT_NE(signature(a, {1, 2}, 3), signature(padded, {1, 2}, 3));
+    EXPECT_NE(signature(a, {1, 2}, 3), signature(c, {1, 2}, 3));
+    EXPECT_NE(signature(a, {1, 2}, 3), signature(a, {2, 1}, 3));
+    EXPECT_NE(signature(a, {1, 2}, 3), signature(a, {1, 2}, 4));
+    EXPECT_NE(
+            GetKernelCallSignature("native", "tuned", absl::optional<Array>{}),
+            GetKernelCallSignature("native", "tuned", absl::optional<Array>{a}));
+}
+
+TEST(KernelAutotunerCacheTest, CacheFile) {
+    std::string path = ::testing::TempDir() + "chainerx_kernel_autotuner_test_cache";
+    std::remove(path.c_str());
+    {
+        KernelAutotuner autotuner{true, path};
+        EXPECT_EQ(0U, autotuner.size());
+        autotuner.Add("signature1", "fast");
+        autotuner.Add("signature2", "default");
+        autotuner.Add("signature1", "faster");
+        EXPECT_EQ(absl::optional<std::string>{"faster"}, autotuner.Find("signature1"));
+    }
+    {
+        // The choices are loaded on construction.
+        KernelAutotuner autotuner{false, path};
+        EXPECT_EQ(2U, autotuner.size());
+        EXPECT_EQ(absl::optional<std::string>{"faster"}, autotuner.Find("signature1"));
+        EXPECT_EQ(absl::optional<std::string>{"default"}, autotuner.Find("signature2"));
+        EXPECT_EQ(absl::nullopt, autotuner.Find("signature3"));
+    }
+    std::remove(path.c_str());
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace chainerx
@@ -0,0 +1,28 @@
+#include "chainerx/kernel_call_recorder.h"
+
+#include "chainerx/array.h"
+#include "chainerx/kernels/creation.h"
+#include "chainerx/macro.h"
+#include "chainerx/thread_local_state.h"
+
+namespace chainerx {
+namespace internal {
+
+KernelCallRecorder* GetKernelCallRecorder() { return GetInternalThreadLocalState().kernel_call_recorder; }
+
+void SetKernelCallRecorder(KernelCallRecorder* recorder) { GetInternalThreadLocalState().kernel_call_recorder = recorder; }
+
+void AssignKernelResult(const Array& dst, const Array& src) {
+    CHAINERX_ASSERT(dst.shape() == src.shape());
+    CHAINERX_ASSERT(dst.dtype() == src.dtype());
+    if (internal::GetArrayBody(dst)->data() == internal::GetArrayBody(src)->data() && dst.offset() == src.offset() &&
+        dst.strides() == src.strides()) {
+        return;
+    }
+    dst.device().backend().CallKernel<CopyKernel>(src, dst);
+}
+
+void CollectArrayBodies(const Array& array, RecordedArrayBodies& array_bodies) { array_bodies.emplace_back(GetArrayBody(array)); }
+
+}  // namespace internal
+}  // namespace chainerx
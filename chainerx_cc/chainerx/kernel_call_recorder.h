@@ -0,0 +1,205 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <absl/types/optional.h>
+#include <absl/utility/utility.h>
+
+#include "chainerx/array_fwd.h"
+#include "chainerx/kernel_registry.h"
+#include "chainerx/macro.h"
+
+namespace chainerx {
+namespace internal {
+
+class ArrayBody;
+
+using RecordedArrayBodies = std::vector<std::weak_ptr<ArrayBody>>;
+
+// Receives the kernel calls made through Backend::CallKernel() while it is installed, e.g. to capture a StaticGraph.
+class KernelCallRecorder {
+public:
+    KernelCallRecorder() = default;
+    virtual ~KernelCallRecorder() = default;
+
+    KernelCallRecorder(const KernelCallRecorder&) = delete;
+    KernelCallRecorder(KernelCallRecorder&&) = delete;
+    KernelCallRecorder& operator=(const KernelCallRecorder&) = delete;
+    KernelCallRecorder& operator=(KernelCallRecorder&&) = delete;
+
+    // Records a kernel call. `replay` calls the same kernel with the same arguments again and writes its results to the arrays returned by
+    // the recorded call. `array_bodies` are the bodies of the arrays held by `replay`, one for each array held, either in the arguments or
+    // in the results.
+    //
+    // The functions of this class must be thread safe, since kernels may be called on the worker threads which inherit the thread local
+    // state of the recording thread, e.g. those of the backward computation.
+    virtual void Record(std::function<void()> replay, RecordedArrayBodies array_bodies) = 0;
+
+    // Records a kernel call which cannot be replayed since it returns objects other than arrays, e.g. states for the backward kernels.
+    virtual void RecordUnsupported(const char* kernel_name) = 0;
+
+    // Records a buffer allocated for an array by Empty() outside of kernels, whose elements are thus defined only by kernel calls.
+    virtual void RecordAllocation(const std::shared_ptr<void>& data, size_t bytesize) = 0;
+};
+
+// Returns the recorder installed on the current thread, or nullptr if none.
+KernelCallRecorder* GetKernelCallRecorder();
+
+// Installs a recorder on the current thread. Pass nullptr to uninstall.
+void SetKernelCallRecorder(KernelCallRecorder* recorder);
+
+// Copies the elements of the result of a replayed kernel call to the corresponding array returned by the recorded call.
+void AssignKernelResult(const Array& dst, const Array& src);
+
+// Collects the bodies of the arrays in a kernel argument or result. Values of other types are ignored.
+void CollectArrayBodies(const Array& array, RecordedArrayBodies& array_bodies);
+
+template <typename T>
+void CollectArrayBodies(const T& /*value*/, RecordedArrayBodies& /*array_bodies*/) {}
+
+template <typename T>
+void CollectArrayBodies(const absl::optional<T>& value, RecordedArrayBodies& array_bodies);
+
+template <typename T>
+void CollectArrayBodies(const std::vector<T>& values, RecordedArrayBodies& array_bodies);
+
+template <typename... Ts>
+void CollectArrayBodies(const std::tuple<Ts...>& values, RecordedArrayBodies& array_bodies);
+
+template <typename T>
+void CollectArrayBodies(const absl::optional<T>& value, RecordedArrayBodies& array_bodies) {
+    if (value.has_value()) {
+        CollectArrayBodies(*value, array_bodies);
+    }
+}
+
+template <typename T>
+void CollectArrayBodies(const std::vector<T>& values, RecordedArrayBodies& array_bodies) {
+    for (const T& value : values) {
+        CollectArrayBodies(value, array_bodies);
+    }
+}
+
+template <typename... Ts>
+void CollectArrayBodies(const std::tuple<Ts...>& values, RecordedArrayBodies& array_bodies) {
+    absl::apply(
+            [&array_bodies](const auto&... value) {
+                (void)std::initializer_list<int>{(CollectArrayBodies(value, array_bodies), 0)...};
+            },
+            values);
+}
+
+template <typename T>
+void AssignKernelResult(const std::vector<T>& dst, const std::vector<T>& src);
+
+template <typename... Ts>
+void AssignKernelResult(const std::tuple<Ts...>& dst, const std::tuple<Ts...>& src);
+
+template <typename T>
+void AssignKernelResult(const std::vector<T>& dst, const std::vector<T>& src) {
+    CHAINERX_ASSERT(dst.size() == src.size());
+    for (size_t i = 0; i < dst.size(); ++i) {
+        AssignKernelResult(dst[i], src[i]);
+    }
+}
+
+template <typename... Ts, size_t... Is>
+void AssignKernelResultTuple(const std::tuple<Ts...>& dst, const std::tuple<Ts...>& src, std::index_sequence<Is...> /*indices*/) {
+    (void)std::initializer_list<int>{(AssignKernelResult(std::get<Is>(dst), std::get<Is>(src)), 0)...};
+}
+
+template <typename... Ts>
+void AssignKernelResult(const std::tuple<Ts...>& dst, const std::tuple<Ts...>& src) {
+    AssignKernelResultTuple(dst, src, std::index_sequence_for<Ts...>{});
+}
+
+// Whether the result of a kernel call can be assigned by AssignKernelResult().
+template <typename T>
+struct IsReplayableKernelResult : std::false_type {};
+
+template <>
+struct IsReplayableKernelResult<Array> : std::true_type {};
+
+template <typename T>
+struct IsReplayableKernelResult<std::vector<T>> : IsReplayableKernelResult<T> {};
+
+template <>
+struct IsReplayableKernelResult<std::tuple<>> : std::true_type {};
+
+template <typename T, typename... Ts>
+struct IsReplayableKernelResult<std::tuple<T, Ts...>>
+    : std::integral_constant<bool, IsReplayableKernelResult<T>::value && IsReplayableKernelResult<std::tuple<Ts...>>::value> {};
+
+// Uninstalls the recorder of the current thread during its lifetime, so that kernels called by other kernels are not recorded.
+class KernelCallRecorderPauseScope {
+public:
+    explicit KernelCallRecorderPauseScope(KernelCallRecorder& recorder) : recorder_{recorder} { SetKernelCallRecorder(nullptr); }
+
+    ~KernelCallRecorderPauseScope() { SetKernelCallRecorder(&recorder_); }
+
+    KernelCallRecorderPauseScope(const KernelCallRecorderPauseScope&) = delete;
+    KernelCallRecorderPauseScope(KernelCallRecorderPauseScope&&) = delete;
+    KernelCallRecorderPauseScope& operator=(const KernelCallRecorderPauseScope&) = delete;
+    KernelCallRecorderPauseScope& operator=(KernelCallRecorderPauseScope&&) = delete;
+
+private:
+    KernelCallRecorder& recorder_;
+};
+
+template <typename Result, typename Enable = void>
+struct KernelCallRecording {
+    template <typename KeyKernelType, typename KernelType, typename... Args>
+    static Result CallAndRecord(KernelCallRecorder& recorder, KernelType& kernel, Args&&... args) {
+        recorder.RecordUnsupported(GetKeyKernelName<KeyKernelType>());
+        KernelCallRecorderPauseScope scope{recorder};
+        return kernel.Call(std::forward<Args>(args)...);
+    }
+};
+
+template <>
+struct KernelCallRecording<void> {
+    template <typename KeyKernelType, typename KernelType, typename... Args>
+    static void CallAndRecord(KernelCallRecorder& recorder, KernelType& kernel, Args&&... args) {
+        std::tuple<std::decay_t<Args>...> recorded_args{args...};
+        {
+            KernelCallRecorderPauseScope scope{recorder};
+            kernel.Call(std::forward<Args>(args)...);
+        }
+        RecordedArrayBodies array_bodies;
+        CollectArrayBodies(recorded_args, array_bodies);
+        recorder.Record(
+                [&kernel, recorded_args]() { absl::apply([&kernel](const auto&... a) { kernel.Call(a...); }, recorded_args); },
+                std::move(array_bodies));
+    }
+};
+
+template <typename Result>
+struct KernelCallRecording<Result, std::enable_if_t<IsReplayableKernelResult<Result>::value>> {
+    template <typename KeyKernelType, typename KernelType, typename... Args>
+    static Result CallAndRecord(KernelCallRecorder& recorder, KernelType& kernel, Args&&... args) {
+        std::tuple<std::decay_t<Args>...> recorded_args{args...};
+        Result result = [&]() {
+            KernelCallRecorderPauseScope scope{recorder};
+            return kernel.Call(std::forward<Args>(args)...);
+        }();
+        RecordedArrayBodies array_bodies;
+        CollectArrayBodies(recorded_args, array_bodies);
+        CollectArrayBodies(result, array_bodies);
+        recorder.Record(
+                [&kernel, recorded_args, result]() {
+                    AssignKernelResult(result, absl::apply([&kernel](const auto&... a) { return kernel.Call(a...); }, recorded_args));
+                },
+                std::move(array_bodies));
+        return result;
+    }
+};
+
+}  // namespace internal
+}  // namespace chainerx
@@ -0,0 +1,85 @@
+#include "chainerx/kernel_queue.h"
+
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <utility>
+
+#include "chainerx/array.h"
+#include "chainerx/device.h"
+#include "chainerx/macro.h"
+#include "chainerx/thread_local_state.h"
+
+namespace chainerx {
+namespace internal {
+namespace {
+
+// Number of SynchronousKernelCallScope instances alive on the current thread.
+thread_local int t_synchronous_kernel_call_depth{0};
+
+}  // namespace
+
+void KernelQueue::Enqueue(std::function<void()> call) {
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        ++pending_count_;
+    }
+    worker_.Submit([this, call = std::move(call), thread_local_state = ThreadLocalState::Get()]() mutable {
+        bool failed{};
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            failed = error_ != nullptr;
+        }
+        if (!failed) {
+            // The call sees the thread local state of the enqueuing thread, e.g. the default device, and the kernels called by it are run
+            // inline on the worker.
+            ThreadLocalState::Set(thread_local_state);
+            SynchronousKernelCallScope scope{};
+            try {
+                call();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock{mutex_};
+                error_ = std::current_exception();
+            }
+        }
+        // Releases the arguments before the completion is notified.
+        call = nullptr;
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            CHAINERX_ASSERT(pending_count_ > 0);
+            --pending_count_;
+        }
+        cv_.notify_all();
+    });
+}
+
+void KernelQueue::Wait() {
+    if (IsWorkerThread()) {
+        return;
+    }
+    std::exception_ptr error{};
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        cv_.wait(lock, [this]() { return pending_count_ == 0; });
+        std::swap(error, error_);
+    }
+    if (error != nullptr) {
+        std::rethrow_exception(error);
+    }
+}
+
+SynchronousKernelCallScope::SynchronousKernelCallScope() { ++t_synchronous_kernel_call_depth; }
+
+SynchronousKernelCallScope::~SynchronousKernelCallScope() {
+    CHAINERX_ASSERT(t_synchronous_kernel_call_depth > 0);
+    --t_synchronous_kernel_call_depth;
+}
+
+bool IsKernelCallSynchronous() { return t_synchronous_kernel_call_depth > 0; }
+
+KernelQueue* GetDeviceKernelQueue(Device& device) { return device.kernel_queue(); }
+
+Device* GetKernelArgumentDevice(const Array& array) { return &array.device(); }
+
+}  // namespace internal
+}  // namespace chainerx
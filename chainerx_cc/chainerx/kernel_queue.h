@@ -0,0 +1,150 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <absl/types/optional.h>
+#include <absl/utility/utility.h>
+
+#include "chainerx/array_fwd.h"
+#include "chainerx/thread_pool.h"
+
+namespace chainerx {
+
+class Device;
+
+namespace internal {
+
+// A FIFO queue of kernel calls run by a dedicated worker thread, used by devices executing kernels asynchronously.
+//
+// An exception thrown by a call is rethrown by the next Wait(). The calls enqueued after the failed one are skipped until then, since
+// their inputs may be undefined.
+//
+// This class is thread safe.
+class KernelQueue {
+public:
+    KernelQueue() = default;
+    ~KernelQueue() = default;
+
+    KernelQueue(const KernelQueue&) = delete;
+    KernelQueue(KernelQueue&&) = delete;
+    KernelQueue& operator=(const KernelQueue&) = delete;
+    KernelQueue& operator=(KernelQueue&&) = delete;
+
+    void Enqueue(std::function<void()> call);
+
+    // Blocks until all the calls enqueued so far complete, and rethrows the first exception thrown by them, if any.
+    // Returns immediately if called from the worker thread, where the preceding calls have already completed.
+    void Wait();
+
+    bool IsWorkerThread() const { return worker_.IsWorkerThread(); }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    size_t pending_count_{0};
+    std::exception_ptr error_;
+
+    // Declared last so that the worker is joined before the other members are destroyed.
+    ThreadPool worker_{1};
+};
+
+// Makes the kernel calls on the current thread synchronous during its lifetime, e.g. those made by a kernel which is being called.
+class SynchronousKernelCallScope {
+public:
+    SynchronousKernelCallScope();
+    ~SynchronousKernelCallScope();
+
+    SynchronousKernelCallScope(const SynchronousKernelCallScope&) = delete;
+    SynchronousKernelCallScope(SynchronousKernelCallScope&&) = delete;
+    SynchronousKernelCallScope& operator=(const SynchronousKernelCallScope&) = delete;
+    SynchronousKernelCallScope& operator=(SynchronousKernelCallScope&&) = delete;
+};
+
+bool IsKernelCallSynchronous();
+
+// Returns the queue of a device if it executes kernels asynchronously, or nullptr otherwise.
+KernelQueue* GetDeviceKernelQueue(Device& device);
+
+// Returns the device of an array in a kernel argument, or nullptr if the argument holds no array.
+Device* GetKernelArgumentDevice(const Array& array);
+
+template <typename T>
+Device* GetKernelArgumentDevice(const T& /*value*/) {
+    return nullptr;
+}
+
+template <typename T>
+Device* GetKernelArgumentDevice(const absl::optional<T>& value);
+
+template <typename T>
+Device* GetKernelArgumentDevice(const std::vector<T>& values);
+
+template <typename T>
+Device* GetKernelArgumentDevice(const absl::optional<T>& value) {
+    return value.has_value() ? GetKernelArgumentDevice(*value) : nullptr;
+}
+
+template <typename T>
+Device* GetKernelArgumentDevice(const std::vector<T>& values) {
+    for (const T& value : values) {
+        if (Device* device = GetKernelArgumentDevice(value)) {
+            return device;
+        }
+    }
+    return nullptr;
+}
+
+// Returns the device of the first array argument of a kernel call, or nullptr if the call has no array arguments.
+template <typename... Args>
+Device* GetKernelDevice(const Args&... args) {
+    Device* device{nullptr};
+    (void)std::initializer_list<int>{(device == nullptr ? (device = GetKernelArgumentDevice(args), 0) : 0)...};
+    return device;
+}
+
+// Returns the queue to which a kernel call with the given arguments is deferred, i.e. that of the device of its first array argument,
+// or nullptr if the call is to be made synchronously.
+template <typename... Args>
+KernelQueue* GetKernelQueue(const Args&... args) {
+    if (IsKernelCallSynchronous()) {
+        return nullptr;
+    }
+    Device* device = GetKernelDevice(args...);
+    return device == nullptr ? nullptr : GetDeviceKernelQueue(*device);
+}
+
+// Makes a kernel call on a device executing kernels asynchronously.
+// Calls returning results, e.g. states for the backward kernels, are made synchronously after the queued calls complete.
+template <typename Result>
+struct QueuedKernelCall {
+    template <typename KernelType, typename... Args>
+    static Result Call(KernelQueue& queue, KernelType& kernel, Args&&... args) {
+        queue.Wait();
+        SynchronousKernelCallScope scope{};
+        return kernel.Call(std::forward<Args>(args)...);
+    }
+};
+
+template <>
+struct QueuedKernelCall<void> {
+    template <typename KernelType, typename... Args>
+    static void Call(KernelQueue& queue, KernelType& kernel, Args&&... args) {
+        // The arguments are copied, so that the arrays are held until the call completes.
+        std::tuple<std::decay_t<Args>...> queued_args{std::forward<Args>(args)...};
+        queue.Enqueue([&kernel, queued_args = std::move(queued_args)]() {
+            absl::apply([&kernel](const auto&... a) { kernel.Call(a...); }, queued_args);
+        });
+    }
+};
+
+}  // namespace internal
+}  // namespace chainerx
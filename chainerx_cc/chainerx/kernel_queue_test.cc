@@ -0,0 +1,76 @@
+#include "chainerx/kernel_queue.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace chainerx {
+namespace internal {
+namespace {
+
+TEST(KernelQueueTest, RunInOrder) {
+    std::vector<int> calls;
+    KernelQueue queue{};
+    for (int i = 0; i < 100; ++i) {
+        queue.Enqueue([&calls, i]() { calls.emplace_back(i); });
+    }
+    queue.Wait();
+    ASSERT_EQ(size_t{100}, calls.size());
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(i, calls[i]);
+    }
+}
+
+TEST(KernelQueueTest, CallsAreSynchronousOnWorker) {
+    KernelQueue queue{};
+    EXPECT_FALSE(IsKernelCallSynchronous());
+    EXPECT_FALSE(queue.IsWorkerThread());
+
+    std::atomic<bool> synchronous{false};
+    std::atomic<bool> worker{false};
+    queue.Enqueue([&]() {
+        synchronous = IsKernelCallSynchronous();
+        worker = queue.IsWorkerThread();
+        // Does not deadlock.
+        queue.Wait();
+    });
+    queue.Wait();
+    EXPECT_TRUE(synchronous);
+    EXPECT_TRUE(worker);
+}
+
+TEST(KernelQueueTest, WaitRethrows) {
+    std::atomic<int> count{0};
+    KernelQueue queue{};
+    queue.Enqueue([&count]() { ++count; });
+    queue.Enqueue([]() { throw std::runtime_error{"error"}; });
+    // Skipped since the preceding call failed.
+    queue.Enqueue([&count]() { ++count; });
+    EXPECT_THROW(queue.Wait(), std::runtime_error);
+    EXPECT_EQ(1, count);
+
+    // The error is reported once.
+    queue.Enqueue([&count]() { ++count; });
+    queue.Wait();
+    EXPECT_EQ(2, count);
+}
+
+TEST(KernelQueueTest, SynchronousKernelCallScope) {
+    EXPECT_FALSE(IsKernelCallSynchronous());
+    {
+        SynchronousKernelCallScope scope1{};
+        EXPECT_TRUE(IsKernelCallSynchronous());
+        {
+            SynchronousKernelCallScope scope2{};
+            EXPECT_TRUE(IsKernelCallSynchronous());
+        }
+        EXPECT_TRUE(IsKernelCallSynchronous());
+    }
+    EXPECT_FALSE(IsKernelCallSynchronous());
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace chainerx
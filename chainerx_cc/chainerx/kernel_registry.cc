@@ -0,0 +1,100 @@
+#include "chainerx/kernel_registry.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include "chainerx/kernel.h"
+
+namespace chainerx {
+namespace internal {
+
+size_t GetKeyKernelSlot(std::type_index key) {
+    struct Slots {
+        std::mutex mutex;
+        std::unordered_map<std::type_index, size_t> map;
+    };
+    // Never destroyed, since kernels may be registered or looked up by static objects in any order.
+    static auto* slots = new Slots{};
+
+    std::lock_guard<std::mutex> lock{slots->mutex};
+    return slots->map.emplace(key, slots->map.size()).first->second;
+}
+
+std::atomic<uint64_t>& GetKernelRegistryGeneration() {
+    // Never destroyed for the same reason as above.
+    static auto* generation = new std::atomic<uint64_t>{0};
+    return *generation;
+}
+
+std::array<std::atomic<bool>, kMaxCachedKeyKernelCount>& GetKernelCandidateFlags() {
+    // Never destroyed for the same reason as above.
+    static auto* flags = new std::array<std::atomic<bool>, kMaxCachedKeyKernelCount>{};
+    return *flags;
+}
+
+}  // namespace internal
+
+Kernel* KernelRegistry::FindKernel(std::type_index key, size_t slot) {
+    // Read before the lookup, so that the cache filled with its result is discarded if a kernel is (un)registered meanwhile.
+    uint64_t generation = internal::GetKernelRegistryGeneration().load(std::memory_order_acquire);
+
+    Kernel* kernel{};
+    {
+        std::lock_guard<std::mutex> lock{*mutex_};
+        auto it = kernels_.find(key);
+        if (it != kernels_.end()) {
+            kernel = it->second.get();
+        }
+    }
+    if (kernel == nullptr && parent_ != nullptr) {
+        kernel = parent_->FindKernel(key, slot);
+    }
+
+    if (kernel != nullptr && slot < internal::kMaxCachedKeyKernelCount) {
+        std::lock_guard<std::mutex> lock{*mutex_};
+        uint64_t cache_generation = cache_->generation.load(std::memory_order_relaxed);
+        if (cache_generation < generation) {
+            for (std::atomic<Kernel*>& cached_kernel : cache_->kernels) {
+                cached_kernel.store(nullptr, std::memory_order_relaxed);
+            }
+            cache_->generation.store(generation, std::memory_order_release);
+            cache_generation = generation;
+        }
+        if (cache_generation == generation) {
+            cache_->kernels[slot].store(kernel, std::memory_order_release);
+        }
+    }
+    return kernel;
+}
+
+std::vector<std::string> KernelRegistry::GetKernelNames() const {
+    std::lock_guard<std::mutex> lock{*mutex_};
+    std::vector<std::string> names;
+    names.reserve(kernel_names_.size());
+    for (const auto& pair : kernel_names_) {
+        names.emplace_back(pair.second);
+    }
+    return names;
+}
+
+void KernelRegistry::CollectKernelCandidates(std::type_index key, std::vector<KernelCandidate>& candidates) {
+    {
+        std::lock_guard<std::mutex> lock{*mutex_};
+        auto it = candidates_.find(key);
+        if (it != candidates_.end()) {
+            candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+        }
+    }
+    if (parent_ != nullptr) {
+        parent_->CollectKernelCandidates(key, candidates);
+    }
+}
+
+}  // namespace chainerx
@@ -1,9 +1,16 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <typeindex>
 #include <unordered_map>
+#include <vector>
 
 #include "chainerx/error.h"
 #include "chainerx/kernel.h"
@@ -34,11 +41,52 @@ std::type_index GetKeyKernelTypeIndex();
 
 #define CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(cls) CHAINERX_REGISTER_KEY_KERNEL(chainerx::cls##Kernel, #cls)
 
+// Number of key kernel types whose lookups can be cached by kernel registries. Lookups of the others always take locks.
+constexpr size_t kMaxCachedKeyKernelCount = 512;
+
+// Returns the index of the key kernel type in the dispatch caches of kernel registries.
+// Indices are assigned on first call and are unique in the process, including kernels defined in dynamically loaded backends.
+size_t GetKeyKernelSlot(std::type_index key);
+
+template <typename KeyKernelType>
+size_t GetKeyKernelSlot() {
+    static const size_t slot = GetKeyKernelSlot(GetKeyKernelTypeIndex<KeyKernelType>());
+    return slot;
+}
+
+// Returns the counter which is incremented whenever a kernel is registered to or unregistered from any kernel registry.
+// The dispatch cache of a registry is valid only while the counter is equal to the value at which the cache was filled.
+std::atomic<uint64_t>& GetKernelRegistryGeneration();
+
+// Returns the flags, indexed by the slots of key kernel types, which are set once a candidate of the key kernel type is registered to any
+// kernel registry.
+std::array<std::atomic<bool>, kMaxCachedKeyKernelCount>& GetKernelCandidateFlags();
+
+// Returns whether kernel calls of the key kernel type may have to choose among candidates, i.e. unless no candidate of the type has ever
+// been registered. This is checked on every kernel call and takes no locks.
+template <typename KeyKernelType>
+bool MayHaveKernelCandidates() {
+    size_t slot = GetKeyKernelSlot<KeyKernelType>();
+    return slot >= kMaxCachedKeyKernelCount || GetKernelCandidateFlags()[slot].load(std::memory_order_relaxed);
+}
+
+// Name of the kernel found by KernelRegistry::GetKernel() among the candidates of a key kernel.
+constexpr const char* kDefaultKernelCandidateName = "default";
+
 }  // namespace internal
 
+// An alternative implementation of a key kernel, which may be chosen by the autotuner instead of the registered kernel.
+struct KernelCandidate {
+    std::string name;
+    Kernel* kernel;
+};
+
 // Manages dynamic registration and dispatch of kernels.
 // This class is hierarchical: it has an optional pointer to a parent KernelRegistry and falls back if a kernel is not found in this
 // instance.
+//
+// Kernels found by GetKernel() are cached in a flat array indexed by the slot of the key kernel type, so that subsequent lookups take no
+// locks. Registering or unregistering a kernel in any registry invalidates the caches of all the registries.
 class KernelRegistry {
 public:
     KernelRegistry() = default;
@@ -57,31 +105,115 @@ public:
         if (!pair.second) {
             throw ChainerxError{"Duplicate kernel: ", internal::GetKeyKernelName<KeyKernelType>()};
         }
+        kernel_names_.emplace(key, internal::GetKeyKernelName<KeyKernelType>());
+        // The kernel may hide the one of a parent registry, which may have been cached.
+        internal::GetKernelRegistryGeneration().fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    // Unregisters a kernel, so that another one can be registered with the same key.
+    // The kernel instance is kept alive until the registry is destroyed, since other threads may still be calling it.
+    template <typename KeyKernelType>
+    void UnregisterKernel() {
+        std::lock_guard<std::mutex> lock{*mutex_};
+        auto it = kernels_.find(internal::GetKeyKernelTypeIndex<KeyKernelType>());
+        if (it == kernels_.end()) {
+            throw ChainerxError{"Kernel not found: ", internal::GetKeyKernelName<KeyKernelType>()};
+        }
+        retired_kernels_.emplace_back(std::move(it->second));
+        kernel_names_.erase(it->first);
+        kernels_.erase(it);
+        internal::GetKernelRegistryGeneration().fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    // Registers an alternative implementation of a key kernel under a name, which must be unique among the candidates of the key kernel
+    // in this registry. Candidates are chosen among only by the autotuner; see kernel_autotuner.h.
+    template <typename KeyKernelType, typename KernelType>
+    void RegisterKernelCandidate(std::string name) {
+        static_assert(std::is_base_of<KeyKernelType, KernelType>::value, "KernelType must be a subclass of KeyKernelType.");
+        std::lock_guard<std::mutex> lock{*mutex_};
+        std::vector<KernelCandidate>& candidates = candidates_[internal::GetKeyKernelTypeIndex<KeyKernelType>()];
+        if (name == internal::kDefaultKernelCandidateName ||
+            std::any_of(candidates.begin(), candidates.end(), [&name](const KernelCandidate& c) { return c.name == name; })) {
+            throw ChainerxError{"Duplicate kernel candidate: ", internal::GetKeyKernelName<KeyKernelType>(), " ", name};
+        }
+        candidate_kernels_.emplace_back(std::make_unique<KernelType>());
+        candidates.emplace_back(KernelCandidate{std::move(name), candidate_kernels_.back().get()});
+        size_t slot = internal::GetKeyKernelSlot<KeyKernelType>();
+        if (slot < internal::kMaxCachedKeyKernelCount) {
+            internal::GetKernelCandidateFlags()[slot].store(true, std::memory_order_relaxed);
+        }
+    }
+
+    // Returns the candidates of a key kernel registered to this registry and its ancestors, in this order. The kernel returned by
+    // GetKernel() is not included.
+    template <typename KeyKernelType>
+    std::vector<KernelCandidate> GetKernelCandidates() {
+        std::vector<KernelCandidate> candidates;
+        CollectKernelCandidates(internal::GetKeyKernelTypeIndex<KeyKernelType>(), candidates);
+        return candidates;
     }
 
     // Looks up a kernel.
     template <typename KeyKernelType>
     Kernel& GetKernel() {
-        std::type_index key{internal::GetKeyKernelTypeIndex<KeyKernelType>()};
-        {
-            std::lock_guard<std::mutex> lock{*mutex_};
-            auto it = kernels_.find(key);
-            if (it != kernels_.end()) {
-                return *it->second;
-            }
-        }
-        if (parent_ != nullptr) {
-            return parent_->GetKernel<KeyKernelType>();
+        if (Kernel* kernel = LookUpKernel<KeyKernelType>()) {
+            return *kernel;
         }
         throw ChainerxError{"Kernel not found: ", internal::GetKeyKernelName<KeyKernelType>()};
     }
 
+    // Returns whether a kernel is registered in this registry or its ancestors, e.g. to fall back to other kernels if a backend does not
+    // implement an optional one.
+    template <typename KeyKernelType>
+    bool HasKernel() {
+        return LookUpKernel<KeyKernelType>() != nullptr;
+    }
+
+    // Returns the names of the key kernels registered to this registry, excluding those registered only to its ancestors, in an unspecified
+    // order.
+    std::vector<std::string> GetKernelNames() const;
+
 private:
+    template <typename KeyKernelType>
+    Kernel* LookUpKernel() {
+        size_t slot = internal::GetKeyKernelSlot<KeyKernelType>();
+        if (slot < internal::kMaxCachedKeyKernelCount &&
+            cache_->generation.load(std::memory_order_acquire) == internal::GetKernelRegistryGeneration().load(std::memory_order_acquire)) {
+            if (Kernel* kernel = cache_->kernels[slot].load(std::memory_order_acquire)) {
+                return kernel;
+            }
+        }
+        return FindKernel(internal::GetKeyKernelTypeIndex<KeyKernelType>(), slot);
+    }
+
+    struct DispatchCache {
+        std::atomic<uint64_t> generation{0};
+        std::array<std::atomic<Kernel*>, internal::kMaxCachedKeyKernelCount> kernels{};
+    };
+
+    // Looks up a kernel in this registry and its ancestors, and caches it. Returns nullptr if not found.
+    Kernel* FindKernel(std::type_index key, size_t slot);
+
+    void CollectKernelCandidates(std::type_index key, std::vector<KernelCandidate>& candidates);
+
     std::unique_ptr<std::mutex> mutex_{std::make_unique<std::mutex>()};
 
     KernelRegistry* parent_{};
 
     std::unordered_map<std::type_index, std::unique_ptr<Kernel>> kernels_{};
+
+    // Names of the key kernels of kernels_.
+    std::unordered_map<std::type_index, std::string> kernel_names_{};
+
+    // Unregistered kernels.
+    std::vector<std::unique_ptr<Kernel>> retired_kernels_{};
+
+    std::unordered_map<std::type_index, std::vector<KernelCandidate>> candidates_{};
+
+    // Instances of the candidates, which are never unregistered.
+    std::vector<std::unique_ptr<Kernel>> candidate_kernels_{};
+
+    std::unique_ptr<DispatchCache> cache_{std::make_unique<DispatchCache>()};
 };
 
 namespace internal {
@@ -101,5 +233,20 @@ public:
     }
 };
 
+// A facility to register kernel candidates statically.
+template <typename BackendType, typename KeyKernelType, typename KernelType>
+class KernelCandidateRegistrar {
+public:
+    explicit KernelCandidateRegistrar(const char* name) noexcept {
+        try {
+            KernelRegistry& kernel_registry = BackendType::GetGlobalKernelRegistry();
+            kernel_registry.RegisterKernelCandidate<KeyKernelType, KernelType>(name);
+        } catch (...) {
+            // Initialization of static storage duration should not throw an exception (cert-err58-cpp)
+            CHAINERX_NEVER_REACH();
+        }
+    }
+};
+
 }  // namespace internal
 }  // namespace chainerx
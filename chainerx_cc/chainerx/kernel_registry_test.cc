@@ -1,7 +1,9 @@
 #include "chainerx/kernel_registry.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -41,6 +43,11 @@ public:
     virtual std::string Call(const std::string& a, float b) { return a + std::to_string(b); }
 };
 
+class MyOverridingKernel : public MyKernel {
+public:
+    std::string Call(int a, const std::string& b) override { return std::to_string(a * 2) + b; }
+};
+
 }  // namespace
 
 namespace internal {
@@ -76,6 +83,9 @@ TEST(KernelRegistryTest, KernelRegistryHierarchy) {
 
     EXPECT_THROW({ kernel_registry2.GetKernel<MyChildKernel>(); }, ChainerxError);
     EXPECT_THROW({ parent_kernel_registry.GetKernel<MyChildKernel>(); }, ChainerxError);
+    EXPECT_TRUE(kernel_registry1.HasKernel<MyChildKernel>());
+    EXPECT_FALSE(kernel_registry2.HasKernel<MyChildKernel>());
+    EXPECT_TRUE(kernel_registry2.HasKernel<MyParentKernel>());
     // no throw
     Kernel& kernel1p = kernel_registry1.GetKernel<MyParentKernel>();
     Kernel& kernel2p = kernel_registry2.GetKernel<MyParentKernel>();
@@ -118,6 +128,57 @@ TEST(KernelRegistryTest, KernelRegistryWithBackend) {
     }
 }
 
+TEST(KernelRegistryTest, GetKernelNames) {
+    KernelRegistry parent_kernel_registry{};
+    KernelRegistry kernel_registry{&parent_kernel_registry};
+    EXPECT_TRUE(kernel_registry.GetKernelNames().empty());
+
+    parent_kernel_registry.RegisterKernel<MyParentKernel, MyParentKernel>();
+    kernel_registry.RegisterKernel<MyKernel, MyKernel>();
+    kernel_registry.RegisterKernel<MyChildKernel, MyChildKernel>();
+
+    // The kernels of the parent are not included.
+    std::vector<std::string> names = kernel_registry.GetKernelNames();
+    std::sort(names.begin(), names.end());
+    EXPECT_EQ((std::vector<std::string>{"mychildkernel", "mykernel"}), names);
+
+    kernel_registry.UnregisterKernel<MyKernel>();
+    EXPECT_EQ(std::vector<std::string>{"mychildkernel"}, kernel_registry.GetKernelNames());
+}
+
+TEST(KernelRegistryTest, KernelRegistryCache) {
+    KernelRegistry parent_kernel_registry{};
+    KernelRegistry kernel_registry{&parent_kernel_registry};
+
+    parent_kernel_registry.RegisterKernel<MyKernel, MyKernel>();
+
+    // The second lookup hits the cache.
+    Kernel& kernel1 = kernel_registry.GetKernel<MyKernel>();
+    Kernel& kernel2 = kernel_registry.GetKernel<MyKernel>();
+    EXPECT_EQ(&kernel1, &kernel2);
+    EXPECT_EQ(&kernel1, &parent_kernel_registry.GetKernel<MyKernel>());
+
+    // A kernel registered to the child hides the cached kernel of the parent.
+    kernel_registry.RegisterKernel<MyKernel, MyOverridingKernel>();
+    Kernel& kernel3 = kernel_registry.GetKernel<MyKernel>();
+    EXPECT_NE(&kernel1, &kernel3);
+    EXPECT_EQ("6 is 6", dynamic_cast<MyKernel&>(kernel3).Call(3, " is 6"));
+    EXPECT_EQ(&kernel1, &parent_kernel_registry.GetKernel<MyKernel>());
+
+    // Unregistering the kernel of the child reveals that of the parent again.
+    kernel_registry.UnregisterKernel<MyKernel>();
+    EXPECT_EQ(&kernel1, &kernel_registry.GetKernel<MyKernel>());
+    EXPECT_THROW(kernel_registry.UnregisterKernel<MyKernel>(), ChainerxError);
+
+    // Unregistering the kernel of the parent invalidates the cache of the child.
+    parent_kernel_registry.UnregisterKernel<MyKernel>();
+    EXPECT_THROW({ kernel_registry.GetKernel<MyKernel>(); }, ChainerxError);
+
+    // Re-registration.
+    parent_kernel_registry.RegisterKernel<MyKernel, MyOverridingKernel>();
+    EXPECT_EQ("4 is 4", dynamic_cast<MyKernel&>(kernel_registry.GetKernel<MyKernel>()).Call(2, " is 4"));
+}
+
 TEST(KernelRegistryTest, KernelRegistryThreadSafe) {
     KernelRegistry parent_kernel_registry{};
     KernelRegistry kernel_registry1{&parent_kernel_registry};
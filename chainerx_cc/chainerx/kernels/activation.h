@@ -0,0 +1,56 @@
+#pragma once
+
+#include <absl/types/optional.h>
+
+#include "chainerx/array.h"
+#include "chainerx/kernel.h"
+#include "chainerx/scalar.h"
+
+namespace chainerx {
+
+class SigmoidKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, const Array& out) = 0;
+};
+
+// Computes the gradient of the sigmoid from its output.
+class SigmoidGradKernel : public Kernel {
+public:
+    virtual void Call(const Array& out, const Array& gout, const Array& gx) = 0;
+};
+
+class SoftplusKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, double beta, const Array& out) = 0;
+};
+
+// Computes the gradient of the softplus from its output.
+class SoftplusGradKernel : public Kernel {
+public:
+    virtual void Call(const Array& out, const Array& gout, double beta, const Array& gx) = 0;
+};
+
+class EluKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, double alpha, const Array& out) = 0;
+};
+
+// Computes the gradient of the ELU from its output. alpha must be non-negative.
+class EluGradKernel : public Kernel {
+public:
+    virtual void Call(const Array& out, const Array& gout, double alpha, const Array& gx) = 0;
+};
+
+// The mask, if given, is set to whether the gradient with respect to each element of x is passed through, i.e. 0 < x < z.
+class ClippedReluKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, Scalar z, const Array& out, const absl::optional<Array>& mask) = 0;
+};
+
+// The mask, if given, is set to whether each element of x is non-negative.
+class LeakyReluKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, Scalar slope, const Array& out, const absl::optional<Array>& mask) = 0;
+};
+
+}  // namespace chainerx
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
+#include <tuple>
 
 #include <absl/types/optional.h>
 
@@ -8,6 +10,7 @@
 #include "chainerx/constant.h"
 #include "chainerx/dims.h"
 #include "chainerx/kernel.h"
+#include "chainerx/routines/connection.h"
 
 namespace chainerx {
 
@@ -31,6 +34,41 @@ public:
             const absl::optional<Array>& out) = 0;
 };
 
+// Computes the n-dimensional convolution, adds the bias and applies the activation.
+// Only floating-point output dtypes are supported. The backward is not defined.
+//
+// x: (batch_size, in_channels, in_1, in_2, ..., in_n)
+// w: (out_channels, in_channels, k_1, k_2, ..., k_n)
+// b: (out_channels)
+//
+// Returns an array of shape (batch_size, out_channels, out_1, out_2, ..., out_n).
+class ConvBiasActivationKernel : public Kernel {
+public:
+    virtual Array Call(
+            const Array& x,
+            const Array& w,
+            const absl::optional<Array>& b,
+            const Dims& stride,
+            const Dims& pad,
+            bool cover_all,
+            ConvActivation activation,
+            Dtype out_dtype) = 0;
+};
+
+// Computes the convolution with ConvKernel and applies the activation in place on its output.
+class GenericConvBiasActivationKernel : public ConvBiasActivationKernel {
+public:
+    Array Call(
+            const Array& x,
+            const Array& w,
+            const absl::optional<Array>& b,
+            const Dims& stride,
+            const Dims& pad,
+            bool cover_all,
+            ConvActivation activation,
+            Dtype out_dtype) override;
+};
+
 // Computes the n-dimensional transposed convolution.
 //
 // x: (batch_size, in_channels, in_1, in_2, ..., in_n)
@@ -64,4 +102,68 @@ public:
             const absl::optional<Array>& out) = 0;
 };
 
+// Intermediate results from `ScaledDotProductAttentionKernel::Call` can be stored in this construct and be reused in
+// `ScaledDotProductAttentionGradKernel::Call`. Each backend derives this class to define the actual set of intermediate results.
+class ScaledDotProductAttentionGradState {
+public:
+    ScaledDotProductAttentionGradState() = default;
+
+    virtual ~ScaledDotProductAttentionGradState() = default;
+
+    ScaledDotProductAttentionGradState(const ScaledDotProductAttentionGradState&) = delete;
+    ScaledDotProductAttentionGradState(ScaledDotProductAttentionGradState&&) = delete;
+    ScaledDotProductAttentionGradState& operator=(const ScaledDotProductAttentionGradState&) = delete;
+    ScaledDotProductAttentionGradState& operator=(ScaledDotProductAttentionGradState&&) = delete;
+};
+
+// Computes softmax(scale * q k^T) v over the last two axes, where the softmax is taken over the keys.
+//
+// q: (..., len_q, d)
+// k: (..., len_k, d)
+// v: (..., len_k, d_v)
+// mask: (..., len_q, len_k) of bool dtype, possibly broadcast. Keys for which the mask is false are ignored.
+//
+// Returns an array of shape (..., len_q, d_v). Queries whose keys are all masked yield zeros.
+// The returned state may be a `nullptr` if `return_state` is `false`.
+class ScaledDotProductAttentionKernel : public Kernel {
+public:
+    virtual std::tuple<Array, std::unique_ptr<ScaledDotProductAttentionGradState>> Call(
+            const Array& q, const Array& k, const Array& v, const absl::optional<Array>& mask, double scale, bool return_state) = 0;
+};
+
+// Returns gq, gk, gv.
+class ScaledDotProductAttentionGradKernel : public Kernel {
+public:
+    virtual std::tuple<Array, Array, Array> Call(
+            const Array& q,
+            const Array& k,
+            const Array& v,
+            const absl::optional<Array>& mask,
+            double scale,
+            const Array& out,
+            const Array& gout,
+            const std::shared_ptr<ScaledDotProductAttentionGradState>& state) = 0;
+};
+
+// Computes attention with other routines, materializing the (len_q, len_k) probabilities of one batch entry at a time.
+class GenericScaledDotProductAttentionKernel : public ScaledDotProductAttentionKernel {
+public:
+    std::tuple<Array, std::unique_ptr<ScaledDotProductAttentionGradState>> Call(
+            const Array& q, const Array& k, const Array& v, const absl::optional<Array>& mask, double scale, bool return_state) override;
+};
+
+// Recomputes the probabilities with other routines and ignores the state.
+class GenericScaledDotProductAttentionGradKernel : public ScaledDotProductAttentionGradKernel {
+public:
+    std::tuple<Array, Array, Array> Call(
+            const Array& q,
+            const Array& k,
+            const Array& v,
+            const absl::optional<Array>& mask,
+            double scale,
+            const Array& out,
+            const Array& gout,
+            const std::shared_ptr<ScaledDotProductAttentionGradState>& state) override;
+};
+
 }  // namespace chainerx
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "chainerx/array.h"
+#include "chainerx/kernel.h"
+#include "chainerx/scalar.h"
+
+namespace chainerx {
+
+enum class FusedElementwiseOp {
+    kAdd,
+    kSubtract,
+    kMultiply,
+    kDivide,
+    kNegative,
+    kExp,
+    kLog,
+    kSqrt,
+    kSquare,
+    kReciprocal,
+    kTanh,
+    kSigmoid,
+};
+
+// An instruction of a fused elementwise loop.
+// Operands are indices into the values of the loop, which are the inputs, followed by the scalars and the results of the preceding
+// instructions. rhs is ignored by unary operations.
+struct FusedElementwiseInstruction {
+    FusedElementwiseOp op;
+    size_t lhs;
+    size_t rhs;
+};
+
+// Evaluates the instructions for each element in a single loop and writes the result of the last instruction to out, without
+// materializing the intermediate values.
+// The inputs are broadcastable to out, and the inputs, the scalars and out are all of the same floating point dtype.
+// This kernel is optional; callers must check that the backend implements it.
+class FusedElementwiseKernel : public Kernel {
+public:
+    virtual void Call(
+            const std::vector<Array>& inputs,
+            const std::vector<Scalar>& scalars,
+            const std::vector<FusedElementwiseInstruction>& instructions,
+            const Array& out) = 0;
+};
+
+}  // namespace chainerx
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "chainerx/array.h"
+#include "chainerx/kernel.h"
+#include "chainerx/routines/loss.h"
+#include "chainerx/scalar.h"
+
+namespace chainerx {
+
+// The loss kernels below write elementwise losses to out if reduction is kNone. Otherwise, out is a 0-dimensional array that
+// receives the sum or the mean of the elementwise losses.
+//
+// The grad kernels take gout of the elementwise shape, i.e. the caller broadcasts (and for kMean, scales) the gradient of a
+// reduced loss.
+
+class GaussianKLDivergenceKernel : public Kernel {
+public:
+    virtual void Call(const Array& mean, const Array& ln_var, LossReduction reduction, const Array& out) = 0;
+};
+
+class GaussianKLDivergenceGradKernel : public Kernel {
+public:
+    virtual void Call(const Array& mean, const Array& ln_var, const Array& gout, const Array& gmean, const Array& gln_var) = 0;
+};
+
+class HuberLossKernel : public Kernel {
+public:
+    virtual void Call(const Array& x1, const Array& x2, Scalar delta, LossReduction reduction, const Array& out) = 0;
+};
+
+// Computes the gradient with respect to x1. The gradient with respect to x2 is its negation.
+class HuberLossGradKernel : public Kernel {
+public:
+    virtual void Call(const Array& x1, const Array& x2, const Array& gout, Scalar delta, const Array& gx1) = 0;
+};
+
+class SigmoidCrossEntropyKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, const Array& t, LossReduction reduction, const Array& out) = 0;
+};
+
+class SigmoidCrossEntropyGradKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, const Array& t, const Array& gout, const Array& gx) = 0;
+};
+
+// x is a 2-dimensional array and t is a 1-dimensional array of labels.
+class HingeKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, const Array& t, double norm, LossReduction reduction, const Array& out) = 0;
+};
+
+class HingeGradKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, const Array& t, const Array& gout, double norm, const Array& gx) = 0;
+};
+
+}  // namespace chainerx
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "chainerx/array.h"
 #include "chainerx/kernel.h"
 #include "chainerx/scalar.h"
@@ -50,4 +52,26 @@ public:
     virtual void Call(const Array& x1, const Array& x2, const Array& pos, const Array& neg, const Array& out) = 0;
 };
 
+// Packs the elements of a contiguous boolean array into bits, eight elements per byte in little-endian bit order.
+// out must be a 1-dimensional uint8 array whose size is the total size of x divided by 8, rounded up.
+class PackBitsKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, const Array& out) = 0;
+};
+
+// Unpacks the bits packed by PackBitsKernel.
+// out must be a 1-dimensional boolean array.
+class UnpackBitsKernel : public Kernel {
+public:
+    virtual void Call(const Array& x, const Array& out) = 0;
+};
+
+// Multiplies each of the floating-point arrays xs by inv_scale and stores the results to outs, which may alias xs.
+// Sets found_non_finite, a boolean scalar array, to true if any of the results is infinite or NaN, and leaves it unchanged otherwise.
+// This is used to scale back the gradients computed with a loss scale.
+class UnscaleGradsKernel : public Kernel {
+public:
+    virtual void Call(const std::vector<Array>& xs, Scalar inv_scale, const std::vector<Array>& outs, const Array& found_non_finite) = 0;
+};
+
 }  // namespace chainerx
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <tuple>
 #include <utility>
@@ -130,4 +131,60 @@ public:
             const absl::optional<Array>& out) override;
 };
 
+// Normalizes `x` over the trailing axes starting from `axis` and applies the elementwise affine transformation given by `gamma` and
+// `beta`, whose shapes must be identical to the normalized part of the shape of `x`.
+// Returns the output along with the mean and the inverse standard deviation of each normalized row. The statistics have the leading
+// shape of `x` (up to `axis`) and are the only intermediate results required by `LayerNormGradKernel`.
+// They are float32 if `x` is float16 and have the dtype of `x` otherwise.
+class LayerNormKernel : public Kernel {
+public:
+    virtual std::tuple<Array, Array, Array> Call(const Array& x, const Array& gamma, const Array& beta, Scalar eps, int8_t axis) = 0;
+};
+
+class LayerNormGradKernel : public Kernel {
+public:
+    // Returns gx, ggamma, gbeta.
+    // ggamma and gbeta have the same dtype as gamma.
+    virtual std::tuple<Array, Array, Array> Call(
+            const Array& x, const Array& gamma, const Array& gout, const Array& x_mean, const Array& x_inv_std, int8_t axis) = 0;
+};
+
+class GenericLayerNormKernel : public LayerNormKernel {
+public:
+    std::tuple<Array, Array, Array> Call(const Array& x, const Array& gamma, const Array& beta, Scalar eps, int8_t axis) override;
+};
+
+class GenericLayerNormGradKernel : public LayerNormGradKernel {
+public:
+    std::tuple<Array, Array, Array> Call(
+            const Array& x, const Array& gamma, const Array& gout, const Array& x_mean, const Array& x_inv_std, int8_t axis) override;
+};
+
+// Normalizes `x` of shape (batch_size, channels, ...) over each group of channels and applies the per-channel affine transformation
+// given by `gamma` and `beta` of shape (channels,).
+// Returns the output along with the mean and the inverse standard deviation of each group, both of shape (batch_size, groups).
+class GroupNormKernel : public Kernel {
+public:
+    virtual std::tuple<Array, Array, Array> Call(const Array& x, int64_t groups, const Array& gamma, const Array& beta, Scalar eps) = 0;
+};
+
+class GroupNormGradKernel : public Kernel {
+public:
+    // Returns gx, ggamma, gbeta.
+    // ggamma and gbeta have the same dtype as gamma.
+    virtual std::tuple<Array, Array, Array> Call(
+            const Array& x, int64_t groups, const Array& gamma, const Array& gout, const Array& x_mean, const Array& x_inv_std) = 0;
+};
+
+class GenericGroupNormKernel : public GroupNormKernel {
+public:
+    std::tuple<Array, Array, Array> Call(const Array& x, int64_t groups, const Array& gamma, const Array& beta, Scalar eps) override;
+};
+
+class GenericGroupNormGradKernel : public GroupNormGradKernel {
+public:
+    std::tuple<Array, Array, Array> Call(
+            const Array& x, int64_t groups, const Array& gamma, const Array& gout, const Array& x_mean, const Array& x_inv_std) override;
+};
+
 }  // namespace chainerx
@@ -0,0 +1,57 @@
+#include "chainerx/loss_scaler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <absl/types/optional.h>
+
+#include "chainerx/array.h"
+#include "chainerx/backward.h"
+#include "chainerx/error.h"
+#include "chainerx/graph.h"
+
+namespace chainerx {
+
+DynamicLossScaler::DynamicLossScaler(float initial_scale, float growth_factor, float backoff_factor, int64_t growth_interval)
+    : scale_{initial_scale}, growth_factor_{growth_factor}, backoff_factor_{backoff_factor}, growth_interval_{growth_interval} {
+    if (!std::isfinite(initial_scale) || initial_scale <= 0) {
+        throw ChainerxError{"Initial loss scale must be positive and finite: ", initial_scale};
+    }
+    if (!std::isfinite(growth_factor) || growth_factor < 1) {
+        throw ChainerxError{"Growth factor of loss scale must be at least 1: ", growth_factor};
+    }
+    if (!(0 < backoff_factor && backoff_factor < 1)) {
+        throw ChainerxError{"Backoff factor of loss scale must be in (0, 1): ", backoff_factor};
+    }
+    if (growth_interval <= 0) {
+        throw ChainerxError{"Growth interval of loss scale must be positive: ", growth_interval};
+    }
+}
+
+bool DynamicLossScaler::Backward(
+        const std::vector<ConstArrayRef>& outputs, const absl::optional<BackpropId>& backprop_id, BackwardExecutionMode execution_mode) {
+    BackwardStats stats = chainerx::Backward(outputs, backprop_id, DoubleBackpropOption::kDisable, scale_, execution_mode);
+    return Update(stats.found_non_finite_grads);
+}
+
+bool DynamicLossScaler::Update(bool found_non_finite_grads) {
+    if (found_non_finite_grads) {
+        // Never let the scale underflow to zero.
+        scale_ = std::max(scale_ * backoff_factor_, std::numeric_limits<float>::min());
+        finite_step_count_ = 0;
+        return false;
+    }
+    if (++finite_step_count_ >= growth_interval_) {
+        float grown = scale_ * growth_factor_;
+        if (std::isfinite(grown)) {
+            scale_ = grown;
+        }
+        finite_step_count_ = 0;
+    }
+    return true;
+}
+
+}  // namespace chainerx
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <absl/types/optional.h>
+
+#include "chainerx/array_fwd.h"
+#include "chainerx/backward_fwd.h"
+#include "chainerx/graph.h"
+
+namespace chainerx {
+
+// Dynamic loss scaling for training with low precision gradients, e.g. float16.
+//
+// The loss is multiplied by a scale factor before backprop so that small gradients do not underflow, and the gradients are scaled back
+// afterwards. The scale is halved (by default) whenever a gradient overflows to infinity or NaN, in which case the parameter update of
+// the step should be skipped, and doubled after a number of consecutive steps without overflow.
+//
+// This class is not thread safe.
+class DynamicLossScaler {
+public:
+    // Throws ChainerxError if any of the arguments is out of range.
+    explicit DynamicLossScaler(
+            float initial_scale = 65536.0f, float growth_factor = 2.0f, float backoff_factor = 0.5f, int64_t growth_interval = 2000);
+
+    // Runs Backward() with the current scale and updates the scale according to whether the gradients are finite.
+    // The gradients are scaled back when this function returns. Returns false if any of them contains infinity or NaN, in which case the
+    // gradients must not be used to update the parameters.
+    bool Backward(
+            const std::vector<ConstArrayRef>& outputs,
+            const absl::optional<BackpropId>& backprop_id = absl::nullopt,
+            BackwardExecutionMode execution_mode = BackwardExecutionMode::kSerial);
+
+    // Updates the scale after a step. Returns the negation of the argument, i.e. whether the step should be applied.
+    bool Update(bool found_non_finite_grads);
+
+    float scale() const { return scale_; }
+
+    // Number of consecutive steps without overflow since the scale was last changed.
+    int64_t finite_step_count() const { return finite_step_count_; }
+
+private:
+    float scale_;
+    float growth_factor_;
+    float backoff_factor_;
+    int64_t growth_interval_;
+    int64_t finite_step_count_{0};
+};
+
+}  // namespace chainerx
@@ -0,0 +1,76 @@
+#include "chainerx/loss_scaler.h"
+
+#include <absl/types/optional.h>
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/device_id.h"
+#include "chainerx/error.h"
+#include "chainerx/native/native_backend.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace {
+
+class DynamicLossScalerTest : public ::testing::Test {
+protected:
+    void SetUp() override { device_session_.emplace(DeviceId{native::NativeBackend::kDefaultName, 0}); }
+
+    void TearDown() override { device_session_.reset(); }
+
+private:
+    absl::optional<testing::DeviceSession> device_session_;
+};
+
+TEST_F(DynamicLossScalerTest, InvalidArguments) {
+    EXPECT_THROW(DynamicLossScaler(0.0f), ChainerxError);
+    EXPECT_THROW(DynamicLossScaler(1.0f, 0.5f), ChainerxError);
+    EXPECT_THROW(DynamicLossScaler(1.0f, 2.0f, 1.0f), ChainerxError);
+    EXPECT_THROW(DynamicLossScaler(1.0f, 2.0f, 0.5f, 0), ChainerxError);
+}
+
+TEST_F(DynamicLossScalerTest, Update) {
+    DynamicLossScaler scaler{8.0f, 2.0f, 0.5f, 3};
+
+    EXPECT_TRUE(scaler.Update(false));
+    EXPECT_TRUE(scaler.Update(false));
+    EXPECT_EQ(8.0f, scaler.scale());
+    EXPECT_EQ(2, scaler.finite_step_count());
+
+    // Grows after the interval.
+    EXPECT_TRUE(scaler.Update(false));
+    EXPECT_EQ(16.0f, scaler.scale());
+    EXPECT_EQ(0, scaler.finite_step_count());
+
+    // Backs off on overflow and restarts counting.
+    EXPECT_TRUE(scaler.Update(false));
+    EXPECT_FALSE(scaler.Update(true));
+    EXPECT_EQ(8.0f, scaler.scale());
+    EXPECT_EQ(0, scaler.finite_step_count());
+}
+
+TEST_F(DynamicLossScalerTest, Backward) {
+    DynamicLossScaler scaler{1024.0f, 2.0f, 0.5f, 1};
+    Array x = (*testing::BuildArray({3}).WithData<float>({1.0f, 2.0f, 3.0f})).RequireGrad();
+    Array y = x * x;
+
+    EXPECT_TRUE(scaler.Backward({y}));
+    EXPECT_ARRAY_EQ(testing::BuildArray({3}).WithData<float>({2.0f, 4.0f, 6.0f}), *x.GetGrad());
+    EXPECT_EQ(2048.0f, scaler.scale());
+}
+
+TEST_F(DynamicLossScalerTest, BackwardOverflow) {
+    DynamicLossScaler scaler{65536.0f};
+    Array x = (*testing::BuildArray({3}).WithData<float>({1.0f, 2.0f, 3.0f})).RequireGrad();
+    Array y = x * 1e35f;
+
+    EXPECT_FALSE(scaler.Backward({y}));
+    EXPECT_EQ(32768.0f, scaler.scale());
+    EXPECT_EQ(0, scaler.finite_step_count());
+}
+
+}  // namespace
+}  // namespace chainerx
@@ -14,6 +14,11 @@
     static ::chainerx::internal::KernelRegistrar<::chainerx::native::NativeBackend, key_kernel_cls, kernel_cls> \
             s_native_backend_kernel_##kernel_cls{};  // NOLINT(cert-err58-cpp)
 
+// Register a kernel candidate statically in NativeBackend, named after its class.
+#define CHAINERX_NATIVE_REGISTER_KERNEL_CANDIDATE(key_kernel_cls, kernel_cls)                                            \
+    static ::chainerx::internal::KernelCandidateRegistrar<::chainerx::native::NativeBackend, key_kernel_cls, kernel_cls> \
+            s_native_backend_kernel_candidate_##kernel_cls{#kernel_cls};  // NOLINT(cert-err58-cpp)
+
 #define CHAINERX_NATIVE_REGISTER_ELTWISE_DTYPE_UNARY_KERNEL(key_kernel_cls, kernel_body, visit_dtype) \
                                                                                                       \
     /* NOLINTNEXTLINE(misc-macro-parentheses,bugprone-macro-parentheses) */                           \
@@ -4,14 +4,17 @@
 #include <stdexcept>
 #include <string>
 
+#include <absl/types/optional.h>
 #include <gsl/gsl>
 
 #include "chainerx/native/native_device.h"
+#include "chainerx/util.h"
 
 namespace chainerx {
 namespace native {
 
 constexpr const char* NativeBackend::kDefaultName;
+constexpr const char* NativeBackend::kAsyncEnvVarName;
 
 namespace native_internal {
 
@@ -19,6 +22,8 @@ gsl::owner<NativeDevice*> CreateDevice(NativeBackend& backend, int index) { retu
 
 }  // namespace native_internal
 
+NativeBackend::~NativeBackend() { WaitForKernelQueues(); }
+
 std::string NativeBackend::GetName() const { return kDefaultName; }
 
 // TODO(sonots): Returns number of CPU cores
@@ -30,7 +35,10 @@ std::unique_ptr<Device> NativeBackend::CreateDevice(int index) {
         throw std::out_of_range{"The index number (= " + std::to_string(index) +
                                 ") is not less than the device count (= " + std::to_string(device_count) + ')'};
     }
-    return std::unique_ptr<NativeDevice>(native_internal::CreateDevice(*this, index));
+    std::unique_ptr<NativeDevice> device{native_internal::CreateDevice(*this, index)};
+    absl::optional<std::string> async = GetEnv(kAsyncEnvVarName);
+    device->SetAsync(async.has_value() && *async == "1");
+    return device;
 }
 
 bool NativeBackend::SupportsTransfer(Device& src_device, Device& dst_device) {
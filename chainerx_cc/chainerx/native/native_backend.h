@@ -29,8 +29,13 @@ class NativeBackend : public Backend {
 public:
     static constexpr const char* kDefaultName = "native";
 
+    // Devices are created executing kernels asynchronously if this environment variable is set to 1. See NativeDevice::SetAsync().
+    static constexpr const char* kAsyncEnvVarName = "CHAINERX_NATIVE_ASYNC";
+
     using Backend::Backend;
 
+    ~NativeBackend() override;
+
     std::string GetName() const override;
 
     int GetDeviceCount() const override;
@@ -1,9 +1,31 @@
 #include "chainerx/native/native_device.h"
 
+#include <memory>
+#include <utility>
+
+#include "chainerx/kernel_queue.h"
+
 namespace chainerx {
 namespace native {
 
-void NativeDevice::Synchronize() {}
+void NativeDevice::Synchronize() {
+    if (kernel_queue_ != nullptr) {
+        kernel_queue_->Wait();
+    }
+}
+
+void NativeDevice::SetAsync(bool async) {
+    if (async == is_async()) {
+        return;
+    }
+    if (async) {
+        kernel_queue_ = std::make_unique<internal::KernelQueue>();
+    } else {
+        // Errors of the queued calls are still reported.
+        std::unique_ptr<internal::KernelQueue> kernel_queue = std::move(kernel_queue_);
+        kernel_queue->Wait();
+    }
+}
 
 }  // namespace native
 }  // namespace chainerx
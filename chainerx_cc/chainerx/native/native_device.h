@@ -13,6 +13,7 @@
 #include "chainerx/dtype.h"
 #include "chainerx/indexable_array.h"
 #include "chainerx/indexer.h"
+#include "chainerx/kernel_queue.h"
 #include "chainerx/kernels/pooling.h"
 #include "chainerx/native/native_backend.h"
 #include "chainerx/routines/pooling.h"
@@ -69,8 +70,22 @@ private:
 
 class NativeDevice : public Device {
 public:
+    // Waits for the kernel calls queued on this device, if it executes kernels asynchronously, and rethrows the first exception thrown by
+    // them.
     void Synchronize() override;
 
+    // Switches between the synchronous execution of kernels on the calling threads, which is the default, and the asynchronous execution
+    // by a worker thread of this device in the order of the calls.
+    //
+    // Kernel calls returning results other than by output arrays are still made synchronously. Data is made available to the host by
+    // Synchronize(), Array::ToNative() and transfers between devices, which wait for the queued calls.
+    // This function must not be called concurrently with kernel calls on this device.
+    void SetAsync(bool async);
+
+    bool is_async() const { return kernel_queue_ != nullptr; }
+
+    internal::KernelQueue* kernel_queue() override { return kernel_queue_.get(); }
+
     // memory.cc
 
     std::shared_ptr<void> Allocate(size_t bytesize) override;
@@ -91,6 +106,8 @@ protected:
 
 private:
     friend NativeDevice* native_internal::CreateDevice(NativeBackend& backend, int index);
+
+    std::unique_ptr<internal::KernelQueue> kernel_queue_;
 };
 
 }  // namespace native
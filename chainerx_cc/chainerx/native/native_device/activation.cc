@@ -0,0 +1,218 @@
+#include "chainerx/native/native_device.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+#include <absl/types/optional.h>
+
+#include "chainerx/array.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/float16.h"
+#include "chainerx/kernels/activation.h"
+#include "chainerx/native/elementwise.h"
+#include "chainerx/native/kernel_regist.h"
+#include "chainerx/scalar.h"
+
+namespace chainerx {
+
+namespace internal {
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Sigmoid)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(SigmoidGrad)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Softplus)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(SoftplusGrad)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Elu)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(EluGrad)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(ClippedRelu)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(LeakyRelu)
+}  // namespace internal
+
+namespace native {
+namespace {
+
+// Activations of float16 arrays are computed in float.
+template <typename T>
+using ActivationComputeType = std::conditional_t<std::is_same<T, Float16>{}, float, T>;
+
+CHAINERX_NATIVE_REGISTER_ELTWISE_FLOAT_UNARY_KERNEL(SigmoidKernel, {
+    using U = ActivationComputeType<T>;
+    // exp is evaluated on a non-positive argument so that it does not overflow.
+    U x_u = static_cast<U>(x);
+    U e = std::exp(-std::abs(x_u));
+    out = static_cast<T>(x_u >= 0 ? U{1} / (U{1} + e) : e / (U{1} + e));
+});
+
+CHAINERX_NATIVE_REGISTER_ELTWISE_FLOAT_BINARY_KERNEL(SigmoidGradKernel, {
+    using U = ActivationComputeType<T>;
+    U y = static_cast<U>(x1);
+    out = static_cast<T>(static_cast<U>(x2) * y * (U{1} - y));
+});
+
+class NativeSoftplusKernel : public SoftplusKernel {
+public:
+    void Call(const Array& x, double beta, const Array& out) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, out);
+        const Array& x_cast = x.dtype() == out.dtype() ? x : x.AsType(out.dtype());
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = ActivationComputeType<T>;
+            struct Impl {
+                void operator()(int64_t /*i*/, T x, T& out) {
+                    U bx = beta * static_cast<U>(x);
+                    out = static_cast<T>((std::max(bx, U{0}) + std::log1p(std::exp(-std::abs(bx)))) * beta_inv);
+                }
+                U beta;
+                U beta_inv;
+            };
+            Elementwise<const T, T>(Impl{static_cast<U>(beta), static_cast<U>(1.0 / beta)}, x_cast, out);
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(SoftplusKernel, NativeSoftplusKernel);
+
+class NativeSoftplusGradKernel : public SoftplusGradKernel {
+public:
+    void Call(const Array& out, const Array& gout, double beta, const Array& gx) override {
+        Device& device = out.device();
+        device.CheckDevicesCompatible(out, gout, gx);
+        VisitFloatingPointDtype(gx.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = ActivationComputeType<T>;
+            struct Impl {
+                // The derivative sigmoid(beta * x) equals 1 - exp(-beta * y).
+                void operator()(int64_t /*i*/, T y, T gy, T& gx) {
+                    gx = static_cast<T>(-static_cast<U>(gy) * std::expm1(-beta * static_cast<U>(y)));
+                }
+                U beta;
+            };
+            Elementwise<const T, const T, T>(Impl{static_cast<U>(beta)}, out, gout, gx);
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(SoftplusGradKernel, NativeSoftplusGradKernel);
+
+class NativeEluKernel : public EluKernel {
+public:
+    void Call(const Array& x, double alpha, const Array& out) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, out);
+        const Array& x_cast = x.dtype() == out.dtype() ? x : x.AsType(out.dtype());
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = ActivationComputeType<T>;
+            struct Impl {
+                void operator()(int64_t /*i*/, T x, T& out) {
+                    U x_u = static_cast<U>(x);
+                    out = static_cast<T>(x_u > 0 ? x_u : alpha * std::expm1(x_u));
+                }
+                U alpha;
+            };
+            Elementwise<const T, T>(Impl{static_cast<U>(alpha)}, x_cast, out);
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(EluKernel, NativeEluKernel);
+
+class NativeEluGradKernel : public EluGradKernel {
+public:
+    void Call(const Array& out, const Array& gout, double alpha, const Array& gx) override {
+        Device& device = out.device();
+        device.CheckDevicesCompatible(out, gout, gx);
+        VisitFloatingPointDtype(gx.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = ActivationComputeType<T>;
+            struct Impl {
+                // For x <= 0, the derivative alpha * exp(x) equals y + alpha.
+                void operator()(int64_t /*i*/, T y, T gy, T& gx) {
+                    U y_u = static_cast<U>(y);
+                    gx = static_cast<T>(y_u > 0 ? static_cast<U>(gy) : static_cast<U>(gy) * (y_u + alpha));
+                }
+                U alpha;
+            };
+            Elementwise<const T, const T, T>(Impl{static_cast<U>(alpha)}, out, gout, gx);
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(EluGradKernel, NativeEluGradKernel);
+
+class NativeClippedReluKernel : public ClippedReluKernel {
+public:
+    void Call(const Array& x, Scalar z, const Array& out, const absl::optional<Array>& mask) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, out);
+        const Array& x_cast = x.dtype() == out.dtype() ? x : x.AsType(out.dtype());
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = ActivationComputeType<T>;
+            struct Impl {
+                void operator()(int64_t /*i*/, T x, T& out) {
+                    U x_u = static_cast<U>(x);
+                    out = static_cast<T>(x_u < 0 ? U{0} : (x_u > z ? z : x_u));
+                }
+                U z;
+            };
+            struct MaskImpl {
+                void operator()(int64_t /*i*/, T x, T& out, bool& mask) {
+                    Impl{z}(0, x, out);
+                    U x_u = static_cast<U>(x);
+                    mask = 0 < x_u && x_u < z;
+                }
+                U z;
+            };
+            if (mask.has_value()) {
+                device.CheckDevicesCompatible(x, *mask);
+                Elementwise<const T, T, bool>(MaskImpl{static_cast<U>(z)}, x_cast, out, *mask);
+            } else {
+                Elementwise<const T, T>(Impl{static_cast<U>(z)}, x_cast, out);
+            }
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(ClippedReluKernel, NativeClippedReluKernel);
+
+class NativeLeakyReluKernel : public LeakyReluKernel {
+public:
+    void Call(const Array& x, Scalar slope, const Array& out, const absl::optional<Array>& mask) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, out);
+        const Array& x_cast = x.dtype() == out.dtype() ? x : x.AsType(out.dtype());
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = ActivationComputeType<T>;
+            struct Impl {
+                void operator()(int64_t /*i*/, T x, T& out) {
+                    U x_u = static_cast<U>(x);
+                    out = static_cast<T>(x_u >= 0 ? x_u : slope * x_u);
+                }
+                U slope;
+            };
+            struct MaskImpl {
+                void operator()(int64_t /*i*/, T x, T& out, bool& mask) {
+                    Impl{slope}(0, x, out);
+                    mask = static_cast<U>(x) >= 0;
+                }
+                U slope;
+            };
+            if (mask.has_value()) {
+                device.CheckDevicesCompatible(x, *mask);
+                Elementwise<const T, T, bool>(MaskImpl{static_cast<U>(slope)}, x_cast, out, *mask);
+            } else {
+                Elementwise<const T, T>(Impl{static_cast<U>(slope)}, x_cast, out);
+            }
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(LeakyReluKernel, NativeLeakyReluKernel);
+
+}  // namespace
+}  // namespace native
+}  // namespace chainerx
@@ -0,0 +1,417 @@
+#include "chainerx/native/native_device.h"
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <absl/types/optional.h>
+
+#include "chainerx/array.h"
+#include "chainerx/backend_util.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/kernels/connection.h"
+#include "chainerx/macro.h"
+#include "chainerx/native/kernel_regist.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/shape.h"
+#include "chainerx/thread_pool.h"
+
+namespace chainerx {
+
+namespace internal {
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(ScaledDotProductAttention)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(ScaledDotProductAttentionGrad)
+}  // namespace internal
+
+namespace native {
+namespace {
+
+// The attention is computed on q, k and v viewed as C-contiguous arrays of shapes (batch_size, len_q, d), (batch_size, len_k, d) and
+// (batch_size, len_k, d_v) in the accumulation dtype, i.e. float32 for float16 inputs. The (len_q, len_k) scores and probabilities are
+// never materialized: each query row folds the scores of one tile of keys at a time into a running softmax, and the backward pass
+// recomputes the probabilities from the log-sum-exp of the scores of each query row.
+
+// Number of keys whose scores are computed before they are folded into the running softmax of a query row.
+constexpr int64_t kAttentionKeyTileSize = 64;
+
+// Returns the dtype in which the attention is computed.
+Dtype GetAttentionAccDtype(Dtype dtype) { return dtype == Dtype::kFloat16 ? Dtype::kFloat32 : dtype; }
+
+// Calls func(begin, end) on disjoint ranges covering [0, n) on the calling thread and the workers of the shared thread pool.
+// cost_per_item is a rough number of operations per item, used to run small workloads on the calling thread only. Workloads are also run
+// on the calling thread only if it is a worker of the pool, e.g. in the parallel replay of a static graph, to avoid oversubscription.
+template <typename Func>
+void ParallelFor(int64_t n, double cost_per_item, Func&& func) {
+    constexpr double kMinCostPerThread = 1 << 16;
+    internal::ThreadPool& pool = internal::GetSharedThreadPool();
+    int64_t max_threads = pool.IsWorkerThread() ? int64_t{1} : static_cast<int64_t>(pool.thread_count()) + 1;
+    double cost_threads = std::min(static_cast<double>(n) * cost_per_item / kMinCostPerThread, static_cast<double>(max_threads));
+    int64_t n_threads = std::min({n, max_threads, static_cast<int64_t>(cost_threads)});
+    if (n_threads <= 1) {
+        func(int64_t{0}, n);
+        return;
+    }
+
+    int64_t chunk_size = (n + n_threads - 1) / n_threads;
+    std::mutex mutex;
+    std::condition_variable cv;
+    int64_t pending_count = 0;
+    std::exception_ptr error{};
+    for (int64_t begin = chunk_size; begin < n; begin += chunk_size) {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            ++pending_count;
+        }
+        pool.Submit([&func, &mutex, &cv, &pending_count, &error, begin, end = std::min(begin + chunk_size, n)]() {
+            std::exception_ptr chunk_error{};
+            try {
+                func(begin, end);
+            } catch (...) {
+                chunk_error = std::current_exception();
+            }
+            // Notify while holding the lock, since the synchronization objects are gone once the caller returns.
+            std::lock_guard<std::mutex> lock{mutex};
+            if (chunk_error != nullptr && error == nullptr) {
+                error = chunk_error;
+            }
+            --pending_count;
+            cv.notify_all();
+        });
+    }
+    std::exception_ptr caller_error{};
+    try {
+        func(int64_t{0}, chunk_size);
+    } catch (...) {
+        caller_error = std::current_exception();
+    }
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        cv.wait(lock, [&pending_count]() { return pending_count == 0; });
+        if (caller_error == nullptr) {
+            caller_error = error;
+        }
+    }
+    if (caller_error != nullptr) {
+        std::rethrow_exception(caller_error);
+    }
+}
+
+// Returns a C-contiguous array of shape (batch_size, m, n) in the given dtype, with the leading axes of the (..., m, n) array flattened.
+Array AsContiguousBatch(const Array& a, Dtype dtype) {
+    CHAINERX_ASSERT(a.ndim() >= 2);
+    int64_t batch_size = std::accumulate(a.shape().begin(), a.shape().end() - 2, int64_t{1}, std::multiplies<>());
+    return AsContiguous(a, dtype).Reshape({batch_size, a.shape()[a.ndim() - 2], a.shape()[a.ndim() - 1]});
+}
+
+// Masks are read in place with their own, possibly broadcast, strides.
+class AttentionMask {
+public:
+    explicit AttentionMask(const absl::optional<Array>& mask) {
+        if (!mask.has_value()) {
+            return;
+        }
+        int8_t batch_ndim = mask->ndim() - 2;
+        CHAINERX_ASSERT(batch_ndim >= 0);
+        data_ = static_cast<const uint8_t*>(internal::GetRawOffsetData(*mask));
+        stride_q_ = mask->strides()[batch_ndim];
+        stride_k_ = mask->strides()[batch_ndim + 1];
+
+        // Computes the byte offsets of the (len_q, len_k) matrices in the row-major order of the leading axes.
+        int64_t batch_size = std::accumulate(mask->shape().begin(), mask->shape().end() - 2, int64_t{1}, std::multiplies<>());
+        batch_offsets_.resize(batch_size);
+        std::vector<int64_t> index(batch_ndim, 0);
+        for (int64_t b = 0; b < batch_size; ++b) {
+            int64_t offset = 0;
+            for (int8_t i = 0; i < batch_ndim; ++i) {
+                offset += index[i] * mask->strides()[i];
+            }
+            batch_offsets_[b] = offset;
+            for (int8_t i = batch_ndim - 1; i >= 0; --i) {
+                if (++index[i] < mask->shape()[i]) {
+                    break;
+                }
+                index[i] = 0;
+            }
+        }
+    }
+
+    // Returns a pointer to the mask of the given query row, or nullptr if no mask is given.
+    const uint8_t* GetRow(int64_t batch_index, int64_t query_index) const {
+        return data_ == nullptr ? nullptr : data_ + batch_offsets_[batch_index] + query_index * stride_q_;
+    }
+
+    bool IsKept(const uint8_t* row, int64_t key_index) const {
+        return row == nullptr || *reinterpret_cast<const bool*>(row + key_index * stride_k_);
+    }
+
+private:
+    const uint8_t* data_{nullptr};
+    int64_t stride_q_{0};
+    int64_t stride_k_{0};
+    std::vector<int64_t> batch_offsets_;
+};
+
+template <typename T>
+void AttentionForwardImpl(
+        const Array& q, const Array& k, const Array& v, const AttentionMask& mask, T scale, const Array& out, const Array& logsumexp) {
+    int64_t batch_size = q.shape()[0];
+    int64_t len_q = q.shape()[1];
+    int64_t len_k = k.shape()[1];
+    int64_t d = q.shape()[2];
+    int64_t d_v = v.shape()[2];
+    const T* q_data = static_cast<const T*>(internal::GetRawOffsetData(q));
+    const T* k_data = static_cast<const T*>(internal::GetRawOffsetData(k));
+    const T* v_data = static_cast<const T*>(internal::GetRawOffsetData(v));
+    T* out_data = static_cast<T*>(internal::GetRawOffsetData(out));
+    T* logsumexp_data = static_cast<T*>(internal::GetRawOffsetData(logsumexp));
+    constexpr T kNegInf = -std::numeric_limits<T>::infinity();
+
+    ParallelFor(batch_size * len_q, static_cast<double>(len_k) * (d + d_v), [&](int64_t begin, int64_t end) {
+        std::vector<T> scaled_q(d);
+        std::vector<T> scores(kAttentionKeyTileSize);
+        for (int64_t row = begin; row < end; ++row) {
+            int64_t b = row / len_q;
+            const T* k_batch = k_data + b * len_k * d;
+            const T* v_batch = v_data + b * len_k * d_v;
+            const uint8_t* mask_row = mask.GetRow(b, row % len_q);
+            T* out_row = out_data + row * d_v;
+            std::transform(q_data + row * d, q_data + (row + 1) * d, scaled_q.begin(), [scale](T x) { return x * scale; });
+            std::fill(out_row, out_row + d_v, T{0});
+
+            // out_row accumulates the unnormalized output, relative to running_max.
+            T running_max = kNegInf;
+            T running_sum = 0;
+            for (int64_t tile_begin = 0; tile_begin < len_k; tile_begin += kAttentionKeyTileSize) {
+                int64_t tile_end = std::min(tile_begin + kAttentionKeyTileSize, len_k);
+                T tile_max = kNegInf;
+                for (int64_t j = tile_begin; j < tile_end; ++j) {
+                    T score = kNegInf;
+                    if (mask.IsKept(mask_row, j)) {
+                        score = std::inner_product(scaled_q.begin(), scaled_q.end(), k_batch + j * d, T{0});
+                        tile_max = std::max(tile_max, score);
+                    }
+                    scores[j - tile_begin] = score;
+                }
+                if (tile_max == kNegInf) {
+                    continue;
+                }
+
+                T new_max = std::max(running_max, tile_max);
+                T correction = std::exp(running_max - new_max);
+                running_sum *= correction;
+                for (int64_t c = 0; c < d_v; ++c) {
+                    out_row[c] *= correction;
+                }
+                for (int64_t j = tile_begin; j < tile_end; ++j) {
+                    T score = scores[j - tile_begin];
+                    if (score == kNegInf) {
+                        continue;
+                    }
+                    T p = std::exp(score - new_max);
+                    running_sum += p;
+                    const T* v_row = v_batch + j * d_v;
+                    for (int64_t c = 0; c < d_v; ++c) {
+                        out_row[c] += p * v_row[c];
+                    }
+                }
+                running_max = new_max;
+            }
+
+            if (running_sum > 0) {
+                T inv_sum = T{1} / running_sum;
+                for (int64_t c = 0; c < d_v; ++c) {
+                    out_row[c] *= inv_sum;
+                }
+                logsumexp_data[row] = running_max + std::log(running_sum);
+            } else {
+                logsumexp_data[row] = kNegInf;
+            }
+        }
+    });
+}
+
+// gq, gk and gv must be zero-initialized. Each batch entry is processed by a single thread since the gradients of its keys and values
+// accumulate over all of its queries.
+template <typename T>
+void AttentionBackwardImpl(
+        const Array& q,
+        const Array& k,
+        const Array& v,
+        const AttentionMask& mask,
+        T scale,
+        const Array& out,
+        const Array& gout,
+        const Array& logsumexp,
+        const Array& gq,
+        const Array& gk,
+        const Array& gv) {
+    int64_t batch_size = q.shape()[0];
+    int64_t len_q = q.shape()[1];
+    int64_t len_k = k.shape()[1];
+    int64_t d = q.shape()[2];
+    int64_t d_v = v.shape()[2];
+    const T* q_data = static_cast<const T*>(internal::GetRawOffsetData(q));
+    const T* k_data = static_cast<const T*>(internal::GetRawOffsetData(k));
+    const T* v_data = static_cast<const T*>(internal::GetRawOffsetData(v));
+    const T* out_data = static_cast<const T*>(internal::GetRawOffsetData(out));
+    const T* gout_data = static_cast<const T*>(internal::GetRawOffsetData(gout));
+    const T* logsumexp_data = static_cast<const T*>(internal::GetRawOffsetData(logsumexp));
+    T* gq_data = static_cast<T*>(internal::GetRawOffsetData(gq));
+    T* gk_data = static_cast<T*>(internal::GetRawOffsetData(gk));
+    T* gv_data = static_cast<T*>(internal::GetRawOffsetData(gv));
+    constexpr T kNegInf = -std::numeric_limits<T>::infinity();
+
+    ParallelFor(batch_size, static_cast<double>(len_q) * len_k * (2 * d + 2 * d_v), [&](int64_t begin, int64_t end) {
+        for (int64_t b = begin; b < end; ++b) {
+            for (int64_t i = 0; i < len_q; ++i) {
+                int64_t row = b * len_q + i;
+                T row_logsumexp = logsumexp_data[row];
+                if (row_logsumexp == kNegInf) {
+                    // All keys are masked and the output does not depend on the inputs.
+                    continue;
+                }
+                const T* q_row = q_data + row * d;
+                const T* gout_row = gout_data + row * d_v;
+                const uint8_t* mask_row = mask.GetRow(b, i);
+                T* gq_row = gq_data + row * d;
+                T gout_dot_out = std::inner_product(gout_row, gout_row + d_v, out_data + row * d_v, T{0});
+
+                for (int64_t j = 0; j < len_k; ++j) {
+                    if (!mask.IsKept(mask_row, j)) {
+                        continue;
+                    }
+                    int64_t key_row = b * len_k + j;
+                    const T* k_row = k_data + key_row * d;
+                    const T* v_row = v_data + key_row * d_v;
+                    T p = std::exp(scale * std::inner_product(q_row, q_row + d, k_row, T{0}) - row_logsumexp);
+                    T gp = std::inner_product(gout_row, gout_row + d_v, v_row, T{0});
+                    T gscore = p * (gp - gout_dot_out) * scale;
+
+                    T* gv_row = gv_data + key_row * d_v;
+                    for (int64_t c = 0; c < d_v; ++c) {
+                        gv_row[c] += p * gout_row[c];
+                    }
+                    T* gk_row = gk_data + key_row * d;
+                    for (int64_t c = 0; c < d; ++c) {
+                        gq_row[c] += gscore * k_row[c];
+                        gk_row[c] += gscore * q_row[c];
+                    }
+                }
+            }
+        }
+    });
+}
+
+class NativeScaledDotProductAttentionGradState : public ScaledDotProductAttentionGradState {
+public:
+    explicit NativeScaledDotProductAttentionGradState(Array logsumexp) : logsumexp_{std::move(logsumexp)} {}
+
+    // (batch_size, len_q) log-sum-exp of the scores of each query row, or -inf if all keys of the row are masked.
+    const Array& logsumexp() const { return logsumexp_; }
+
+private:
+    Array logsumexp_;
+};
+
+class NativeScaledDotProductAttentionKernel : public ScaledDotProductAttentionKernel {
+public:
+    std::tuple<Array, std::unique_ptr<ScaledDotProductAttentionGradState>> Call(
+            const Array& q, const Array& k, const Array& v, const absl::optional<Array>& mask, double scale, bool return_state) override {
+        Device& device = q.device();
+        device.CheckDevicesCompatible(q, k, v);
+        if (mask.has_value()) {
+            device.CheckDevicesCompatible(q, *mask);
+        }
+
+        Dtype acc_dtype = GetAttentionAccDtype(q.dtype());
+        Array q_acc = AsContiguousBatch(q, acc_dtype);
+        Array k_acc = AsContiguousBatch(k, acc_dtype);
+        Array v_acc = AsContiguousBatch(v, acc_dtype);
+        Array out_acc = Empty({q_acc.shape()[0], q_acc.shape()[1], v_acc.shape()[2]}, acc_dtype, device);
+        Array logsumexp = Empty({q_acc.shape()[0], q_acc.shape()[1]}, acc_dtype, device);
+
+        AttentionMask attention_mask{mask};
+        if (acc_dtype == Dtype::kFloat64) {
+            AttentionForwardImpl<double>(q_acc, k_acc, v_acc, attention_mask, scale, out_acc, logsumexp);
+        } else {
+            CHAINERX_ASSERT(acc_dtype == Dtype::kFloat32);
+            AttentionForwardImpl<float>(q_acc, k_acc, v_acc, attention_mask, static_cast<float>(scale), out_acc, logsumexp);
+        }
+
+        Shape out_shape = q.shape();
+        out_shape.back() = v.shape().back();
+        Array out = out_acc.AsType(q.dtype(), false).Reshape(out_shape);
+        std::unique_ptr<ScaledDotProductAttentionGradState> state =
+                return_state ? std::make_unique<NativeScaledDotProductAttentionGradState>(std::move(logsumexp)) : nullptr;
+        return std::make_tuple(std::move(out), std::move(state));
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(ScaledDotProductAttentionKernel, NativeScaledDotProductAttentionKernel);
+
+class NativeScaledDotProductAttentionGradKernel : public ScaledDotProductAttentionGradKernel {
+public:
+    std::tuple<Array, Array, Array> Call(
+            const Array& q,
+            const Array& k,
+            const Array& v,
+            const absl::optional<Array>& mask,
+            double scale,
+            const Array& out,
+            const Array& gout,
+            const std::shared_ptr<ScaledDotProductAttentionGradState>& state) override {
+        Device& device = q.device();
+        device.CheckDevicesCompatible(q, k, v, out, gout);
+        if (mask.has_value()) {
+            device.CheckDevicesCompatible(q, *mask);
+        }
+
+        if (state == nullptr) {
+            // The log-sum-exp is not available, fall back to recomputing the probabilities with routines.
+            return GenericScaledDotProductAttentionGradKernel{}.Call(q, k, v, mask, scale, out, gout, state);
+        }
+        const Array& logsumexp = dynamic_cast<NativeScaledDotProductAttentionGradState&>(*state).logsumexp();
+
+        Dtype acc_dtype = logsumexp.dtype();
+        Array q_acc = AsContiguousBatch(q, acc_dtype);
+        Array k_acc = AsContiguousBatch(k, acc_dtype);
+        Array v_acc = AsContiguousBatch(v, acc_dtype);
+        Array out_acc = AsContiguousBatch(out, acc_dtype);
+        Array gout_acc = AsContiguousBatch(gout, acc_dtype);
+        Array gq_acc = Zeros(q_acc.shape(), acc_dtype, device);
+        Array gk_acc = Zeros(k_acc.shape(), acc_dtype, device);
+        Array gv_acc = Zeros(v_acc.shape(), acc_dtype, device);
+
+        AttentionMask attention_mask{mask};
+        if (acc_dtype == Dtype::kFloat64) {
+            AttentionBackwardImpl<double>(
+                    q_acc, k_acc, v_acc, attention_mask, scale, out_acc, gout_acc, logsumexp, gq_acc, gk_acc, gv_acc);
+        } else {
+            CHAINERX_ASSERT(acc_dtype == Dtype::kFloat32);
+            AttentionBackwardImpl<float>(
+                    q_acc, k_acc, v_acc, attention_mask, static_cast<float>(scale), out_acc, gout_acc, logsumexp, gq_acc, gk_acc, gv_acc);
+        }
+
+        return std::make_tuple(
+                gq_acc.AsType(q.dtype(), false).Reshape(q.shape()),
+                gk_acc.AsType(k.dtype(), false).Reshape(k.shape()),
+                gv_acc.AsType(v.dtype(), false).Reshape(v.shape()));
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(ScaledDotProductAttentionGradKernel, NativeScaledDotProductAttentionGradKernel);
+
+}  // namespace
+}  // namespace native
+}  // namespace chainerx
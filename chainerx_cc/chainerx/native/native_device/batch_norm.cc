@@ -1,5 +1,21 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+#include "chainerx/array.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/float16.h"
+#include "chainerx/indexable_array.h"
 #include "chainerx/kernels/normalization.h"
+#include "chainerx/macro.h"
+#include "chainerx/native/data_type.h"
 #include "chainerx/native/kernel_regist.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/scalar.h"
+#include "chainerx/shape.h"
 
 namespace chainerx {
 
@@ -7,6 +23,10 @@ namespace internal {
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(BatchNorm)
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(BatchNormGrad)
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(FixedBatchNorm)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(LayerNorm)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(LayerNormGrad)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(GroupNorm)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(GroupNormGrad)
 }  // namespace internal
 
 namespace native {
@@ -15,5 +35,283 @@ CHAINERX_NATIVE_REGISTER_KERNEL(BatchNormKernel, GenericBatchNormKernel);
 CHAINERX_NATIVE_REGISTER_KERNEL(BatchNormGradKernel, GenericBatchNormGradKernel);
 CHAINERX_NATIVE_REGISTER_KERNEL(FixedBatchNormKernel, GenericFixedBatchNormKernel);
 
+namespace {
+
+// Layer and group normalization are both computed on a 3-dimensional view of x of shape (rows, params, cols).
+// Statistics are taken over each row, i.e. over the last two axes, and the affine parameters are indexed by the second axis.
+// Layer normalization views x as (rows, normalized size, 1) and group normalization views x as
+// (batch_size * groups, channels / groups, spatial size).
+// gamma, beta, ggamma and gbeta are viewed as (params_period, params), where row i uses the parameters at i % params_period. The period
+// is 1 for layer normalization and the number of groups for group normalization.
+template <typename T>
+using NormAccType = std::conditional_t<std::is_same<T, Float16>{}, float, T>;
+
+// Computes the output and the per-row statistics in one statistics pass and one normalize-scale-shift pass over each row.
+template <typename T>
+void NormalizeRows(
+        const Array& x,
+        const Array& gamma,
+        const Array& beta,
+        double eps,
+        int64_t params_period,
+        const Array& out,
+        const Array& x_mean,
+        const Array& x_inv_std) {
+    using AccT = NormAccType<T>;
+    IndexableArray<const T, 3> x_iarray{x};
+    IndexableArray<const T, 2> gamma_iarray{gamma};
+    IndexableArray<const T, 2> beta_iarray{beta};
+    IndexableArray<T, 3> out_iarray{out};
+    IndexableArray<AccT, 1> mean_iarray{x_mean};
+    IndexableArray<AccT, 1> inv_std_iarray{x_inv_std};
+
+    int64_t n_rows = x.shape()[0];
+    int64_t n_params = x.shape()[1];
+    int64_t n_cols = x.shape()[2];
+    double inv_n = 1.0 / static_cast<double>(n_params * n_cols);
+
+    for (int64_t i = 0; i < n_rows; ++i) {
+        // Shift by the first element so that the single-pass variance does not suffer from cancellation.
+        int64_t i_0_0[] = {i, 0, 0};
+        double shift = n_params * n_cols > 0 ? static_cast<double>(native_internal::StorageToDataType<const T>(x_iarray[i_0_0])) : 0.0;
+        double sum = 0;
+        double sum_sq = 0;
+        for (int64_t p = 0; p < n_params; ++p) {
+            for (int64_t j = 0; j < n_cols; ++j) {
+                int64_t i_p_j[] = {i, p, j};
+                double v = static_cast<double>(native_internal::StorageToDataType<const T>(x_iarray[i_p_j])) - shift;
+                sum += v;
+                sum_sq += v * v;
+            }
+        }
+        double mean_shifted = sum * inv_n;
+        double var = std::max(sum_sq * inv_n - mean_shifted * mean_shifted, 0.0);
+        auto mean = static_cast<AccT>(mean_shifted + shift);
+        auto inv_std = static_cast<AccT>(1.0 / std::sqrt(var + eps));
+
+        int64_t i_arr[] = {i};
+        native_internal::StorageToDataType<AccT>(mean_iarray[i_arr]) = mean;
+        native_internal::StorageToDataType<AccT>(inv_std_iarray[i_arr]) = inv_std;
+
+        for (int64_t p = 0; p < n_params; ++p) {
+            int64_t param_index[] = {i % params_period, p};
+            auto scale = static_cast<AccT>(native_internal::StorageToDataType<const T>(gamma_iarray[param_index])) * inv_std;
+            auto shift_out = static_cast<AccT>(native_internal::StorageToDataType<const T>(beta_iarray[param_index])) - mean * scale;
+            for (int64_t j = 0; j < n_cols; ++j) {
+                int64_t i_p_j[] = {i, p, j};
+                auto v = static_cast<AccT>(native_internal::StorageToDataType<const T>(x_iarray[i_p_j]));
+                native_internal::StorageToDataType<T>(out_iarray[i_p_j]) = static_cast<T>(v * scale + shift_out);
+            }
+        }
+    }
+}
+
+// Computes gx and accumulates ggamma and gbeta in two passes over each row, using only the retained statistics.
+template <typename T>
+void NormalizeRowsGrad(
+        const Array& x,
+        const Array& gamma,
+        const Array& gout,
+        const Array& x_mean,
+        const Array& x_inv_std,
+        int64_t params_period,
+        const Array& gx,
+        const Array& ggamma,
+        const Array& gbeta) {
+    using AccT = NormAccType<T>;
+    IndexableArray<const T, 3> x_iarray{x};
+    IndexableArray<const T, 2> gamma_iarray{gamma};
+    IndexableArray<const T, 3> gout_iarray{gout};
+    IndexableArray<const AccT, 1> mean_iarray{x_mean};
+    IndexableArray<const AccT, 1> inv_std_iarray{x_inv_std};
+    IndexableArray<T, 3> gx_iarray{gx};
+    IndexableArray<AccT, 2> ggamma_iarray{ggamma};
+    IndexableArray<AccT, 2> gbeta_iarray{gbeta};
+
+    int64_t n_rows = x.shape()[0];
+    int64_t n_params = x.shape()[1];
+    int64_t n_cols = x.shape()[2];
+    auto inv_n = static_cast<AccT>(1.0 / static_cast<double>(n_params * n_cols));
+
+    for (int64_t i = 0; i < n_rows; ++i) {
+        int64_t i_arr[] = {i};
+        AccT mean = native_internal::StorageToDataType<const AccT>(mean_iarray[i_arr]);
+        AccT inv_std = native_internal::StorageToDataType<const AccT>(inv_std_iarray[i_arr]);
+
+        AccT sum_gx_hat{0};
+        AccT sum_gx_hat_x_hat{0};
+        for (int64_t p = 0; p < n_params; ++p) {
+            int64_t param_index[] = {i % params_period, p};
+            auto g = static_cast<AccT>(native_internal::StorageToDataType<const T>(gamma_iarray[param_index]));
+            AccT& ggamma_value = native_internal::StorageToDataType<AccT>(ggamma_iarray[param_index]);
+            AccT& gbeta_value = native_internal::StorageToDataType<AccT>(gbeta_iarray[param_index]);
+            for (int64_t j = 0; j < n_cols; ++j) {
+                int64_t i_p_j[] = {i, p, j};
+                AccT x_hat = (static_cast<AccT>(native_internal::StorageToDataType<const T>(x_iarray[i_p_j])) - mean) * inv_std;
+                auto gy = static_cast<AccT>(native_internal::StorageToDataType<const T>(gout_iarray[i_p_j]));
+                AccT gx_hat = gy * g;
+                sum_gx_hat += gx_hat;
+                sum_gx_hat_x_hat += gx_hat * x_hat;
+                ggamma_value += gy * x_hat;
+                gbeta_value += gy;
+            }
+        }
+        AccT mean_gx_hat = sum_gx_hat * inv_n;
+        AccT mean_gx_hat_x_hat = sum_gx_hat_x_hat * inv_n;
+
+        for (int64_t p = 0; p < n_params; ++p) {
+            int64_t param_index[] = {i % params_period, p};
+            auto g = static_cast<AccT>(native_internal::StorageToDataType<const T>(gamma_iarray[param_index]));
+            for (int64_t j = 0; j < n_cols; ++j) {
+                int64_t i_p_j[] = {i, p, j};
+                AccT x_hat = (static_cast<AccT>(native_internal::StorageToDataType<const T>(x_iarray[i_p_j])) - mean) * inv_std;
+                AccT gx_hat = static_cast<AccT>(native_internal::StorageToDataType<const T>(gout_iarray[i_p_j])) * g;
+                native_internal::StorageToDataType<T>(gx_iarray[i_p_j]) =
+                        static_cast<T>(inv_std * (gx_hat - mean_gx_hat - x_hat * mean_gx_hat_x_hat));
+            }
+        }
+    }
+}
+
+Dtype GetStatsDtype(Dtype dtype) {
+    return VisitFloatingPointDtype(dtype, [](auto pt) {
+        using T = typename decltype(pt)::type;
+        return PrimitiveType<NormAccType<T>>::kDtype;
+    });
+}
+
+// Forward implementation shared by layer and group normalization. See NormalizeRows for the shapes.
+std::tuple<Array, Array, Array> CallNormalizeRows(
+        const Array& x,
+        const Array& gamma,
+        const Array& beta,
+        Scalar eps,
+        const Shape& rows_shape,
+        int64_t params_period,
+        const Shape& stats_shape) {
+    x.device().CheckDevicesCompatible(x, gamma, beta);
+    Dtype stats_dtype = GetStatsDtype(x.dtype());
+    Shape params_shape{params_period, rows_shape[1]};
+
+    Array out = Empty(x.shape(), x.dtype(), x.device());
+    Array x_mean = Empty(stats_shape, stats_dtype, x.device());
+    Array x_inv_std = Empty(stats_shape, stats_dtype, x.device());
+
+    VisitFloatingPointDtype(x.dtype(), [&](auto pt) {
+        using T = typename decltype(pt)::type;
+        NormalizeRows<T>(
+                x.Reshape(rows_shape),
+                gamma.AsType(x.dtype(), false).Reshape(params_shape),
+                beta.AsType(x.dtype(), false).Reshape(params_shape),
+                static_cast<double>(eps),
+                params_period,
+                out.Reshape(rows_shape),
+                x_mean.Reshape({rows_shape[0]}),
+                x_inv_std.Reshape({rows_shape[0]}));
+    });
+
+    return std::make_tuple(std::move(out), std::move(x_mean), std::move(x_inv_std));
+}
+
+// Backward implementation shared by layer and group normalization. See NormalizeRows for the shapes.
+std::tuple<Array, Array, Array> CallNormalizeRowsGrad(
+        const Array& x,
+        const Array& gamma,
+        const Array& gout,
+        const Array& x_mean,
+        const Array& x_inv_std,
+        const Shape& rows_shape,
+        int64_t params_period) {
+    x.device().CheckDevicesCompatible(x, gamma, gout, x_mean, x_inv_std);
+    Dtype stats_dtype = GetStatsDtype(x.dtype());
+    CHAINERX_ASSERT(x_mean.dtype() == stats_dtype);
+    CHAINERX_ASSERT(x_inv_std.dtype() == stats_dtype);
+    Shape params_shape{params_period, rows_shape[1]};
+
+    Array gx = Empty(x.shape(), x.dtype(), x.device());
+    Array ggamma = Zeros(params_shape, stats_dtype, x.device());
+    Array gbeta = Zeros(params_shape, stats_dtype, x.device());
+
+    VisitFloatingPointDtype(x.dtype(), [&](auto pt) {
+        using T = typename decltype(pt)::type;
+        NormalizeRowsGrad<T>(
+                x.Reshape(rows_shape),
+                gamma.AsType(x.dtype(), false).Reshape(params_shape),
+                gout.AsType(x.dtype(), false).Reshape(rows_shape),
+                x_mean.Reshape({rows_shape[0]}),
+                x_inv_std.Reshape({rows_shape[0]}),
+                params_period,
+                gx.Reshape(rows_shape),
+                ggamma,
+                gbeta);
+    });
+
+    // Parameter gradients of the groups were accumulated separately. Fold them into the shape of gamma.
+    return std::make_tuple(
+            std::move(gx),
+            ggamma.Reshape(gamma.shape()).AsType(gamma.dtype(), false),
+            gbeta.Reshape(gamma.shape()).AsType(gamma.dtype(), false));
+}
+
+Shape GetLayerNormRowsShape(const Shape& x_shape, int8_t axis) {
+    Shape stats_shape{x_shape.begin(), x_shape.begin() + axis};
+    Shape norm_shape{x_shape.begin() + axis, x_shape.end()};
+    return Shape{stats_shape.GetTotalSize(), norm_shape.GetTotalSize(), 1};
+}
+
+Shape GetGroupNormRowsShape(const Shape& x_shape, int64_t groups) {
+    int64_t spatial_size = 1;
+    for (int8_t i = 2; i < x_shape.ndim(); ++i) {
+        spatial_size *= x_shape[i];
+    }
+    return Shape{x_shape[0] * groups, x_shape[1] / groups, spatial_size};
+}
+
+class NativeLayerNormKernel : public LayerNormKernel {
+public:
+    std::tuple<Array, Array, Array> Call(const Array& x, const Array& gamma, const Array& beta, Scalar eps, int8_t axis) override {
+        CHAINERX_ASSERT(0 <= axis && axis < x.ndim());
+        return CallNormalizeRows(
+                x, gamma, beta, eps, GetLayerNormRowsShape(x.shape(), axis), 1, Shape{x.shape().begin(), x.shape().begin() + axis});
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(LayerNormKernel, NativeLayerNormKernel);
+
+class NativeLayerNormGradKernel : public LayerNormGradKernel {
+public:
+    std::tuple<Array, Array, Array> Call(
+            const Array& x, const Array& gamma, const Array& gout, const Array& x_mean, const Array& x_inv_std, int8_t axis) override {
+        CHAINERX_ASSERT(0 <= axis && axis < x.ndim());
+        return CallNormalizeRowsGrad(x, gamma, gout, x_mean, x_inv_std, GetLayerNormRowsShape(x.shape(), axis), 1);
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(LayerNormGradKernel, NativeLayerNormGradKernel);
+
+class NativeGroupNormKernel : public GroupNormKernel {
+public:
+    std::tuple<Array, Array, Array> Call(const Array& x, int64_t groups, const Array& gamma, const Array& beta, Scalar eps) override {
+        CHAINERX_ASSERT(x.ndim() >= 2);
+        CHAINERX_ASSERT(x.shape()[1] % groups == 0);
+        return CallNormalizeRows(x, gamma, beta, eps, GetGroupNormRowsShape(x.shape(), groups), groups, Shape{x.shape()[0], groups});
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(GroupNormKernel, NativeGroupNormKernel);
+
+class NativeGroupNormGradKernel : public GroupNormGradKernel {
+public:
+    std::tuple<Array, Array, Array> Call(
+            const Array& x, int64_t groups, const Array& gamma, const Array& gout, const Array& x_mean, const Array& x_inv_std) override {
+        CHAINERX_ASSERT(x.ndim() >= 2);
+        CHAINERX_ASSERT(x.shape()[1] % groups == 0);
+        return CallNormalizeRowsGrad(x, gamma, gout, x_mean, x_inv_std, GetGroupNormRowsShape(x.shape(), groups), groups);
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(GroupNormGradKernel, NativeGroupNormGradKernel);
+
+}  // namespace
 }  // namespace native
 }  // namespace chainerx
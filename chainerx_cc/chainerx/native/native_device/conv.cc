@@ -21,9 +21,11 @@
 #include "chainerx/kernels/creation.h"
 #include "chainerx/macro.h"
 #include "chainerx/native/col2im.h"
+#include "chainerx/native/elementwise.h"
 #include "chainerx/native/im2col.h"
 #include "chainerx/native/kernel_regist.h"
 #include "chainerx/native/tensor_dot.h"
+#include "chainerx/routines/connection.h"
 #include "chainerx/routines/manipulation.h"
 #include "chainerx/shape.h"
 
@@ -31,6 +33,7 @@ namespace chainerx {
 
 namespace internal {
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Conv)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(ConvBiasActivation)
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(ConvTranspose)
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(ConvGradWeight)
 }  // namespace internal
@@ -90,6 +93,62 @@ public:
 
 CHAINERX_NATIVE_REGISTER_KERNEL(ConvKernel, NativeConvKernel);
 
+// Adds the bias, if any, and applies the activation to the tensor dot product in a single pass.
+class NativeConvBiasActivationKernel : public ConvBiasActivationKernel {
+public:
+    Array Call(
+            const Array& x,
+            const Array& w,
+            const absl::optional<Array>& b,
+            const Dims& stride,
+            const Dims& pad,
+            bool cover_all,
+            ConvActivation activation,
+            Dtype out_dtype) override {
+        CHAINERX_ASSERT(GetKind(out_dtype) == DtypeKind::kFloat);
+        int8_t ndim = w.ndim() - 2;  // Number of spatial dimensions
+
+        Dims kernel_size;
+        std::copy_n(w.shape().begin() + 2, ndim, std::back_inserter(kernel_size));
+        Array col = native_internal::Im2Col(x, kernel_size, stride, pad, cover_all, 0);
+
+        Axes axes;
+        axes.resize(ndim + 1);
+        std::iota(axes.begin(), axes.end(), 1);
+        Array y = TensorDot(col, w, axes, axes, out_dtype);  // (batch_size, out_1, out_2, ..., out_n, out_channel)
+
+        bool relu = activation == ConvActivation::kRelu;
+        VisitFloatingPointDtype(out_dtype, [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            if (b.has_value()) {
+                struct Impl {
+                    void operator()(int64_t /*i*/, T b, T& y) {
+                        T z = y + b;
+                        y = relu && z < T{0} ? T{0} : z;
+                    }
+                    bool relu;
+                };
+                Elementwise<const T, T>(Impl{relu}, b->AsType(out_dtype, false).BroadcastTo(y.shape()), y);
+            } else if (relu) {
+                struct Impl {
+                    void operator()(int64_t /*i*/, T& y) { y = y < T{0} ? T{0} : y; }
+                };
+                Elementwise<T>(Impl{}, y);
+            }
+        });
+
+        // Move the out channel axis to the second
+        Axes roll_axes;
+        roll_axes.resize(y.ndim());
+        roll_axes[0] = 0;
+        roll_axes[1] = ndim + 1;
+        std::iota(roll_axes.begin() + 2, roll_axes.end(), 1);
+        return y.Transpose(roll_axes);
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(ConvBiasActivationKernel, NativeConvBiasActivationKernel);
+
 class NativeConvGradWeightKernel : public ConvGradWeightKernel {
 public:
     Array Call(
@@ -139,19 +139,76 @@ float MultiplyAdd(float x, float y, float z) { return std::fmaf(x, y, z); }
 
 double MultiplyAdd(double x, double y, double z) { return std::fma(x, y, z); }
 
+void CheckDotArguments(const Array& a, const Array& b, const Array& out) {
+    Device& device = a.device();
+    device.CheckDevicesCompatible(a, b, out);
+
+    // TODO(sonots): Support ndim >= 2
+    if (a.ndim() != 2 || b.ndim() != 2 || out.ndim() != 2) {
+        throw DimensionError{"ChainerX dot supports only 2-dimensional arrays."};
+    }
+}
+
+// Computes the product by loops, without BLAS.
+void DotLoop(const Array& a, const Array& b, const Array& out) {
+    const Array& a_cast = a.dtype() == out.dtype() ? a : a.AsType(out.dtype());
+    const Array& b_cast = b.dtype() == out.dtype() ? b : b.AsType(out.dtype());
+
+    out.Fill(0);
+    VisitDtype(out.dtype(), [&](auto pt) {
+        CHAINERX_ASSERT(a_cast.dtype() == out.dtype());
+        CHAINERX_ASSERT(b_cast.dtype() == out.dtype());
+
+        using T = typename decltype(pt)::type;
+
+        IndexableArray<const T, 2> a_cast_iarray{a_cast};
+        IndexableArray<const T, 2> b_cast_iarray{b_cast};
+        IndexableArray<T, 2> out_iarray{out};
+
+        int64_t m = a_cast.shape()[0];
+        int64_t k = a_cast.shape()[1];
+        int64_t n = b_cast.shape()[1];
+        CHAINERX_ASSERT(b_cast.shape()[0] == k);
+        CHAINERX_ASSERT(out.shape()[0] == m);
+        CHAINERX_ASSERT(out.shape()[1] == n);
+
+        using AccT = std::conditional_t<std::is_same<T, Float16>{}, float, T>;
+        constexpr auto acc_dtype = PrimitiveType<AccT>::kDtype;
+
+        Array acc = out.AsType(acc_dtype, false);
+        IndexableArray<AccT, 2> acc_iarray{acc};
+        for (int64_t i = 0; i < m; ++i) {
+            for (int64_t l = 0; l < k; ++l) {
+                int64_t a_i_l[] = {i, l};
+                T a_value = native_internal::StorageToDataType<const T>(a_cast_iarray[a_i_l]);
+                for (int64_t j = 0; j < n; ++j) {
+                    int64_t acc_i_j[] = {i, j};
+                    int64_t b_l_j[] = {l, j};
+                    T b_value = native_internal::StorageToDataType<const T>(b_cast_iarray[b_l_j]);
+                    AccT& acc_value = native_internal::StorageToDataType<AccT>(acc_iarray[acc_i_j]);
+                    acc_value = MultiplyAdd(a_value, b_value, acc_value);
+                }
+            }
+        }
+        if (!std::is_same<T, AccT>{}) {
+            for (int64_t i = 0; i < m; ++i) {
+                for (int64_t j = 0; j < n; ++j) {
+                    int64_t i_j[] = {i, j};
+                    AccT acc_value = native_internal::StorageToDataType<AccT>(acc_iarray[i_j]);
+                    T& out_value = native_internal::StorageToDataType<T>(out_iarray[i_j]);
+                    out_value = static_cast<T>(acc_value);
+                }
+            }
+        }
+    });
+}
+
 }  // namespace
 
 class NativeDotKernel : public DotKernel {
 public:
     void Call(const Array& a, const Array& b, const Array& out) override {
-        Device& device = a.device();
-        device.CheckDevicesCompatible(a, b, out);
-
-        // TODO(sonots): Support ndim >= 2
-        if (a.ndim() != 2 || b.ndim() != 2 || out.ndim() != 2) {
-            throw DimensionError{"ChainerX dot supports only 2-dimensional arrays."};
-        }
-
+        CheckDotArguments(a, b, out);
         if (out.GetTotalSize() == 0) {
             return;
         }
@@ -175,60 +232,27 @@ public:
         }
 #endif  // CHAINERX_ENABLE_BLAS
 
-        const Array& a_cast = a.dtype() == out.dtype() ? a : a.AsType(out.dtype());
-        const Array& b_cast = b.dtype() == out.dtype() ? b : b.AsType(out.dtype());
-
-        out.Fill(0);
-        VisitDtype(out.dtype(), [&](auto pt) {
-            CHAINERX_ASSERT(a_cast.dtype() == out.dtype());
-            CHAINERX_ASSERT(b_cast.dtype() == out.dtype());
-
-            using T = typename decltype(pt)::type;
-
-            IndexableArray<const T, 2> a_cast_iarray{a_cast};
-            IndexableArray<const T, 2> b_cast_iarray{b_cast};
-            IndexableArray<T, 2> out_iarray{out};
-
-            int64_t m = a_cast.shape()[0];
-            int64_t k = a_cast.shape()[1];
-            int64_t n = b_cast.shape()[1];
-            CHAINERX_ASSERT(b_cast.shape()[0] == k);
-            CHAINERX_ASSERT(out.shape()[0] == m);
-            CHAINERX_ASSERT(out.shape()[1] == n);
+        DotLoop(a, b, out);
+    }
+};
 
-            using AccT = std::conditional_t<std::is_same<T, Float16>{}, float, T>;
-            constexpr auto acc_dtype = PrimitiveType<AccT>::kDtype;
+CHAINERX_NATIVE_REGISTER_KERNEL(DotKernel, NativeDotKernel);
 
-            Array acc = out.AsType(acc_dtype, false);
-            IndexableArray<AccT, 2> acc_iarray{acc};
-            for (int64_t i = 0; i < m; ++i) {
-                for (int64_t l = 0; l < k; ++l) {
-                    int64_t a_i_l[] = {i, l};
-                    T a_value = native_internal::StorageToDataType<const T>(a_cast_iarray[a_i_l]);
-                    for (int64_t j = 0; j < n; ++j) {
-                        int64_t acc_i_j[] = {i, j};
-                        int64_t b_l_j[] = {l, j};
-                        T b_value = native_internal::StorageToDataType<const T>(b_cast_iarray[b_l_j]);
-                        AccT& acc_value = native_internal::StorageToDataType<AccT>(acc_iarray[acc_i_j]);
-                        acc_value = MultiplyAdd(a_value, b_value, acc_value);
-                    }
-                }
-            }
-            if (!std::is_same<T, AccT>{}) {
-                for (int64_t i = 0; i < m; ++i) {
-                    for (int64_t j = 0; j < n; ++j) {
-                        int64_t i_j[] = {i, j};
-                        AccT acc_value = native_internal::StorageToDataType<AccT>(acc_iarray[i_j]);
-                        T& out_value = native_internal::StorageToDataType<T>(out_iarray[i_j]);
-                        out_value = static_cast<T>(acc_value);
-                    }
-                }
-            }
-        });
+#ifdef CHAINERX_ENABLE_BLAS
+// The loops may be faster than BLAS for small matrices, for which the overhead of BLAS calls dominates.
+class NativeDotLoopKernel : public DotKernel {
+public:
+    void Call(const Array& a, const Array& b, const Array& out) override {
+        CheckDotArguments(a, b, out);
+        if (out.GetTotalSize() == 0) {
+            return;
+        }
+        DotLoop(a, b, out);
     }
 };
 
-CHAINERX_NATIVE_REGISTER_KERNEL(DotKernel, NativeDotKernel);
+CHAINERX_NATIVE_REGISTER_KERNEL_CANDIDATE(DotKernel, NativeDotLoopKernel);
+#endif  // CHAINERX_ENABLE_BLAS
 
 }  // namespace native
 }  // namespace chainerx
@@ -0,0 +1,201 @@
+#include "chainerx/native/native_device.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "chainerx/arithmetic_ops.h"
+#include "chainerx/array.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/float16.h"
+#include "chainerx/indexable_array.h"
+#include "chainerx/indexer.h"
+#include "chainerx/kernels/fusion.h"
+#include "chainerx/macro.h"
+#include "chainerx/native/data_type.h"
+#include "chainerx/native/kernel_regist.h"
+#include "chainerx/numeric.h"
+#include "chainerx/scalar.h"
+#include "chainerx/shape.h"
+
+namespace chainerx {
+
+namespace internal {
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(FusedElementwise)
+}  // namespace internal
+
+namespace native {
+namespace {
+
+// Number of elements evaluated by each instruction at once. The values of a chunk are small enough to stay in the cache.
+constexpr int64_t kFusedElementwiseChunkSize = 512;
+
+// Fused loops of float16 arrays are computed in float.
+template <typename T>
+using FusedElementwiseComputeType = std::conditional_t<std::is_same<T, Float16>{}, float, T>;
+
+// Applies an instruction to a chunk of values. The operation is dispatched once per chunk so that the inner loops are vectorizable.
+template <typename U>
+void EvaluateInstruction(FusedElementwiseOp op, const U* lhs, const U* rhs, U* out, int64_t n) {
+    using Ops = ArithmeticOps<U>;
+    switch (op) {
+        case FusedElementwiseOp::kAdd:
+            for (int64_t k = 0; k < n; ++k) {
+                out[k] = Ops::Add(lhs[k], rhs[k]);
+            }
+            break;
+        case FusedElementwiseOp::kSubtract:
+            for (int64_t k = 0; k < n; ++k) {
+                out[k] = Ops::Subtract(lhs[k], rhs[k]);
+            }
+            break;
+        case FusedElementwiseOp::kMultiply:
+            for (int64_t k = 0; k < n; ++k) {
+                out[k] = Ops::Multiply(lhs[k], rhs[k]);
+            }
+            break;
+        case FusedElementwiseOp::kDivide:
+            for (int64_t k = 0; k < n; ++k) {
+                out[k] = Ops::Divide(lhs[k], rhs[k]);
+            }
+            break;
+        case FusedElementwiseOp::kNegative:
+            for (int64_t k = 0; k < n; ++k) {
+                out[k] = -lhs[k];
+            }
+            break;
+        case FusedElementwiseOp::kExp:
+            for (int64_t k = 0; k < n; ++k) {
+                out[k] = chainerx::Exp(lhs[k]);
+            }
+            break;
+        case FusedElementwiseOp::kLog:
+            for (int64_t k = 0; k < n; ++k) {
+                out[k] = chainerx::Log(lhs[k]);
+            }
+            break;
+        case FusedElementwiseOp::kSqrt:
+            for (int64_t k = 0; k < n; ++k) {
+                out[k] = chainerx::Sqrt(lhs[k]);
+            }
+            break;
+        case FusedElementwiseOp::kSquare:
+            for (int64_t k = 0; k < n; ++k) {
+                out[k] = lhs[k] * lhs[k];
+            }
+            break;
+        case FusedElementwiseOp::kReciprocal:
+            for (int64_t k = 0; k < n; ++k) {
+                out[k] = U{1} / lhs[k];
+            }
+            break;
+        case FusedElementwiseOp::kTanh:
+            for (int64_t k = 0; k < n; ++k) {
+                out[k] = chainerx::Tanh(lhs[k]);
+            }
+            break;
+        case FusedElementwiseOp::kSigmoid:
+            // Same as SigmoidKernel; exp is evaluated on a non-positive argument so that it does not overflow.
+            for (int64_t k = 0; k < n; ++k) {
+                U e = std::exp(-std::abs(lhs[k]));
+                out[k] = lhs[k] >= 0 ? U{1} / (U{1} + e) : e / (U{1} + e);
+            }
+            break;
+        default:
+            CHAINERX_NEVER_REACH();
+    }
+}
+
+class NativeFusedElementwiseKernel : public FusedElementwiseKernel {
+public:
+    void Call(
+            const std::vector<Array>& inputs,
+            const std::vector<Scalar>& scalars,
+            const std::vector<FusedElementwiseInstruction>& instructions,
+            const Array& out) override {
+        CHAINERX_ASSERT(!instructions.empty());
+        Device& device = out.device();
+        std::vector<Array> broadcast_inputs;
+        broadcast_inputs.reserve(inputs.size());
+        for (const Array& input : inputs) {
+            device.CheckDevicesCompatible(input, out);
+            CHAINERX_ASSERT(input.dtype() == out.dtype());
+            broadcast_inputs.emplace_back(input.shape() == out.shape() ? input : input.BroadcastTo(out.shape()));
+        }
+        // Broadcast inputs are not contiguous, and thus read through indexers.
+        bool all_contiguous =
+                out.IsContiguous() &&
+                std::all_of(broadcast_inputs.begin(), broadcast_inputs.end(), [](const Array& a) { return a.IsContiguous(); });
+
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = FusedElementwiseComputeType<T>;
+            constexpr int64_t kChunk = kFusedElementwiseChunkSize;
+
+            // Chunks of the inputs, the scalars and the results of the instructions, in this order.
+            size_t scalar_offset = inputs.size();
+            size_t instruction_offset = scalar_offset + scalars.size();
+            std::vector<U> values((instruction_offset + instructions.size()) * kChunk);
+            auto chunk = [&values](size_t value_index) { return &values[value_index * kChunk]; };
+            for (size_t i = 0; i < scalars.size(); ++i) {
+                std::fill_n(chunk(scalar_offset + i), kChunk, static_cast<U>(static_cast<T>(scalars[i])));
+            }
+            U* result = chunk(instruction_offset + instructions.size() - 1);
+
+            Indexer<> indexer{out.shape()};
+            std::vector<IndexableArray<const T>> input_iarrays;
+            input_iarrays.reserve(inputs.size());
+            for (const Array& input : broadcast_inputs) {
+                input_iarrays.emplace_back(input);
+            }
+            IndexableArray<T> out_iarray{out};
+
+            int64_t total_size = out.GetTotalSize();
+            for (int64_t start = 0; start < total_size; start += kChunk) {
+                int64_t n = std::min(kChunk, total_size - start);
+                for (size_t i = 0; i < inputs.size(); ++i) {
+                    U* dst = chunk(i);
+                    if (all_contiguous) {
+                        const T* src = static_cast<const T*>(input_iarrays[i].data()) + start;
+                        for (int64_t k = 0; k < n; ++k) {
+                            dst[k] = static_cast<U>(src[k]);
+                        }
+                    } else {
+                        auto it = indexer.It(start);
+                        for (int64_t k = 0; k < n; ++k, ++it) {
+                            dst[k] = static_cast<U>(native_internal::StorageToDataType<const T>(input_iarrays[i][it]));
+                        }
+                    }
+                }
+                for (size_t j = 0; j < instructions.size(); ++j) {
+                    const FusedElementwiseInstruction& instruction = instructions[j];
+                    CHAINERX_ASSERT(instruction.lhs < instruction_offset + j);
+                    CHAINERX_ASSERT(instruction.rhs < instruction_offset + j);
+                    EvaluateInstruction<U>(
+                            instruction.op, chunk(instruction.lhs), chunk(instruction.rhs), chunk(instruction_offset + j), n);
+                }
+                if (all_contiguous) {
+                    T* dst = static_cast<T*>(out_iarray.data()) + start;
+                    for (int64_t k = 0; k < n; ++k) {
+                        dst[k] = static_cast<T>(result[k]);
+                    }
+                } else {
+                    auto it = indexer.It(start);
+                    for (int64_t k = 0; k < n; ++k, ++it) {
+                        out_iarray[it] = native_internal::DataToStorageType<T>(static_cast<T>(result[k]));
+                    }
+                }
+            }
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(FusedElementwiseKernel, NativeFusedElementwiseKernel);
+
+}  // namespace
+}  // namespace native
+}  // namespace chainerx
@@ -0,0 +1,315 @@
+#include "chainerx/native/native_device.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+#include "chainerx/array.h"
+#include "chainerx/backend_util.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/float16.h"
+#include "chainerx/kernels/loss.h"
+#include "chainerx/macro.h"
+#include "chainerx/native/elementwise.h"
+#include "chainerx/native/kernel_regist.h"
+#include "chainerx/routines/loss.h"
+#include "chainerx/scalar.h"
+#include "chainerx/shape.h"
+
+namespace chainerx {
+
+namespace internal {
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(GaussianKLDivergence)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(GaussianKLDivergenceGrad)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(HuberLoss)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(HuberLossGrad)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(SigmoidCrossEntropy)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(SigmoidCrossEntropyGrad)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Hinge)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(HingeGrad)
+}  // namespace internal
+
+namespace native {
+namespace {
+
+// Losses of float16 arrays are computed in float.
+template <typename T>
+using LossComputeType = std::conditional_t<std::is_same<T, Float16>{}, float, T>;
+
+template <typename T, typename LossImpl>
+struct StoreLoss {
+    template <typename... Ts>
+    void operator()(int64_t i, T& out, Ts... xs) {
+        out = static_cast<T>(impl(i, xs...));
+    }
+    LossImpl impl;
+};
+
+template <typename LossImpl>
+struct AccumulateLoss {
+    template <typename... Ts>
+    void operator()(int64_t i, Ts... xs) {
+        *sum += static_cast<double>(impl(i, xs...));
+    }
+    LossImpl impl;
+    double* sum;
+};
+
+// Evaluates impl, which returns the loss of a single element, over the given arrays.
+// If the loss is reduced, the elementwise losses are accumulated in double without being stored.
+template <typename T, typename... Ts, typename LossImpl, typename... Arrays>
+void ElementwiseLoss(LossImpl impl, LossReduction reduction, const Array& out, const Array& x, const Arrays&... args) {
+    if (reduction == LossReduction::kNone) {
+        Elementwise<T, const Ts...>(StoreLoss<T, LossImpl>{impl}, out, x, args...);
+        return;
+    }
+    CHAINERX_ASSERT(out.ndim() == 0);
+    double sum = 0;
+    Elementwise<const Ts...>(AccumulateLoss<LossImpl>{impl, &sum}, x, args...);
+    if (reduction == LossReduction::kMean) {
+        sum /= static_cast<double>(x.GetTotalSize());
+    }
+    *static_cast<T*>(internal::GetRawOffsetData(out)) = static_cast<T>(sum);
+}
+
+class NativeGaussianKLDivergenceKernel : public GaussianKLDivergenceKernel {
+public:
+    void Call(const Array& mean, const Array& ln_var, LossReduction reduction, const Array& out) override {
+        Device& device = mean.device();
+        device.CheckDevicesCompatible(mean, ln_var, out);
+        const Array& mean_cast = mean.dtype() == out.dtype() ? mean : mean.AsType(out.dtype());
+        const Array& ln_var_cast = ln_var.dtype() == out.dtype() ? ln_var : ln_var.AsType(out.dtype());
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = LossComputeType<T>;
+            struct Impl {
+                U operator()(int64_t /*i*/, T mean, T ln_var) {
+                    U mean_u = static_cast<U>(mean);
+                    U ln_var_u = static_cast<U>(ln_var);
+                    return (mean_u * mean_u + std::exp(ln_var_u) - ln_var_u - U{1}) * U{0.5};
+                }
+            };
+            ElementwiseLoss<T, T, T>(Impl{}, reduction, out, mean_cast, ln_var_cast);
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(GaussianKLDivergenceKernel, NativeGaussianKLDivergenceKernel);
+
+class NativeGaussianKLDivergenceGradKernel : public GaussianKLDivergenceGradKernel {
+public:
+    void Call(const Array& mean, const Array& ln_var, const Array& gout, const Array& gmean, const Array& gln_var) override {
+        Device& device = mean.device();
+        device.CheckDevicesCompatible(mean, ln_var, gout, gmean, gln_var);
+        const Array& mean_cast = mean.dtype() == gout.dtype() ? mean : mean.AsType(gout.dtype());
+        const Array& ln_var_cast = ln_var.dtype() == gout.dtype() ? ln_var : ln_var.AsType(gout.dtype());
+        CHAINERX_ASSERT(gmean.dtype() == gout.dtype());
+        CHAINERX_ASSERT(gln_var.dtype() == gout.dtype());
+        VisitFloatingPointDtype(gout.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = LossComputeType<T>;
+            struct Impl {
+                void operator()(int64_t /*i*/, T mean, T ln_var, T gout, T& gmean, T& gln_var) {
+                    U gout_u = static_cast<U>(gout);
+                    gmean = static_cast<T>(gout_u * static_cast<U>(mean));
+                    gln_var = static_cast<T>(gout_u * U{0.5} * std::expm1(static_cast<U>(ln_var)));
+                }
+            };
+            Elementwise<const T, const T, const T, T, T>(Impl{}, mean_cast, ln_var_cast, gout, gmean, gln_var);
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(GaussianKLDivergenceGradKernel, NativeGaussianKLDivergenceGradKernel);
+
+class NativeHuberLossKernel : public HuberLossKernel {
+public:
+    void Call(const Array& x1, const Array& x2, Scalar delta, LossReduction reduction, const Array& out) override {
+        Device& device = x1.device();
+        device.CheckDevicesCompatible(x1, x2, out);
+        const Array& x1_cast = x1.dtype() == out.dtype() ? x1 : x1.AsType(out.dtype());
+        const Array& x2_cast = x2.dtype() == out.dtype() ? x2 : x2.AsType(out.dtype());
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = LossComputeType<T>;
+            struct Impl {
+                U operator()(int64_t /*i*/, T x1, T x2) {
+                    U diff = static_cast<U>(x1) - static_cast<U>(x2);
+                    U abs_diff = std::abs(diff);
+                    return abs_diff < delta ? U{0.5} * diff * diff : delta * (abs_diff - U{0.5} * delta);
+                }
+                U delta;
+            };
+            ElementwiseLoss<T, T, T>(Impl{static_cast<U>(delta)}, reduction, out, x1_cast, x2_cast);
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(HuberLossKernel, NativeHuberLossKernel);
+
+class NativeHuberLossGradKernel : public HuberLossGradKernel {
+public:
+    void Call(const Array& x1, const Array& x2, const Array& gout, Scalar delta, const Array& gx1) override {
+        Device& device = x1.device();
+        device.CheckDevicesCompatible(x1, x2, gout, gx1);
+        const Array& x1_cast = x1.dtype() == gx1.dtype() ? x1 : x1.AsType(gx1.dtype());
+        const Array& x2_cast = x2.dtype() == gx1.dtype() ? x2 : x2.AsType(gx1.dtype());
+        VisitFloatingPointDtype(gx1.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = LossComputeType<T>;
+            struct Impl {
+                void operator()(int64_t /*i*/, T x1, T x2, T gout, T& gx1) {
+                    U diff = static_cast<U>(x1) - static_cast<U>(x2);
+                    U clipped = std::abs(diff) < delta ? diff : (diff > 0 ? delta : -delta);
+                    gx1 = static_cast<T>(static_cast<U>(gout) * clipped);
+                }
+                U delta;
+            };
+            Elementwise<const T, const T, const T, T>(Impl{static_cast<U>(delta)}, x1_cast, x2_cast, gout, gx1);
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(HuberLossGradKernel, NativeHuberLossGradKernel);
+
+class NativeSigmoidCrossEntropyKernel : public SigmoidCrossEntropyKernel {
+public:
+    void Call(const Array& x, const Array& t, LossReduction reduction, const Array& out) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, t, out);
+        const Array& x_cast = x.dtype() == out.dtype() ? x : x.AsType(out.dtype());
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = LossComputeType<T>;
+            VisitDtype(t.dtype(), [&](auto t_pt) {
+                using TLabel = typename decltype(t_pt)::type;
+                struct Impl {
+                    U operator()(int64_t /*i*/, T x, TLabel t) {
+                        if (static_cast<double>(t) == -1) {
+                            return U{0};
+                        }
+                        U x_u = static_cast<U>(x);
+                        U step = x_u >= 0 ? U{1} : U{0};
+                        return std::log1p(std::exp(-std::abs(x_u))) - x_u * (static_cast<U>(t) - step);
+                    }
+                };
+                ElementwiseLoss<T, T, TLabel>(Impl{}, reduction, out, x_cast, t);
+            });
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(SigmoidCrossEntropyKernel, NativeSigmoidCrossEntropyKernel);
+
+class NativeSigmoidCrossEntropyGradKernel : public SigmoidCrossEntropyGradKernel {
+public:
+    void Call(const Array& x, const Array& t, const Array& gout, const Array& gx) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, t, gout, gx);
+        const Array& x_cast = x.dtype() == gx.dtype() ? x : x.AsType(gx.dtype());
+        VisitFloatingPointDtype(gx.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = LossComputeType<T>;
+            VisitDtype(t.dtype(), [&](auto t_pt) {
+                using TLabel = typename decltype(t_pt)::type;
+                struct Impl {
+                    void operator()(int64_t /*i*/, T x, TLabel t, T gout, T& gx) {
+                        if (static_cast<double>(t) == -1) {
+                            gx = T{0};
+                            return;
+                        }
+                        // Sigmoid evaluated so that exp does not overflow.
+                        U x_u = static_cast<U>(x);
+                        U e = std::exp(-std::abs(x_u));
+                        U sigmoid = x_u >= 0 ? U{1} / (U{1} + e) : e / (U{1} + e);
+                        gx = static_cast<T>(static_cast<U>(gout) * (sigmoid - static_cast<U>(t)));
+                    }
+                };
+                Elementwise<const T, const TLabel, const T, T>(Impl{}, x_cast, t, gout, gx);
+            });
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(SigmoidCrossEntropyGradKernel, NativeSigmoidCrossEntropyGradKernel);
+
+// Broadcasts the labels of the rows of x to the shape of x.
+Array BroadcastHingeLabels(const Array& x, const Array& t) {
+    CHAINERX_ASSERT(x.ndim() == 2);
+    CHAINERX_ASSERT(t.ndim() == 1);
+    return t.Reshape({t.shape()[0], 1}).BroadcastTo(x.shape());
+}
+
+class NativeHingeKernel : public HingeKernel {
+public:
+    void Call(const Array& x, const Array& t, double norm, LossReduction reduction, const Array& out) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, t, out);
+        const Array& x_cast = x.dtype() == out.dtype() ? x : x.AsType(out.dtype());
+        Array t_b = BroadcastHingeLabels(x, t);
+        int64_t n_classes = x.shape()[1];
+        VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = LossComputeType<T>;
+            VisitDtype(t.dtype(), [&](auto t_pt) {
+                using TLabel = typename decltype(t_pt)::type;
+                struct Impl {
+                    // The elements are visited in row-major order, hence i % n_classes is the class of the element.
+                    U operator()(int64_t i, T x, TLabel t) {
+                        U x_u = static_cast<U>(x);
+                        bool is_label = static_cast<double>(t) == static_cast<double>(i % n_classes);
+                        U bottom_diff = std::max(U{0}, is_label ? U{1} - x_u : U{1} + x_u);
+                        return norm == 1 ? bottom_diff : static_cast<U>(std::pow(bottom_diff, norm));
+                    }
+                    int64_t n_classes;
+                    U norm;
+                };
+                ElementwiseLoss<T, T, TLabel>(Impl{n_classes, static_cast<U>(norm)}, reduction, out, x_cast, t_b);
+            });
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(HingeKernel, NativeHingeKernel);
+
+class NativeHingeGradKernel : public HingeGradKernel {
+public:
+    void Call(const Array& x, const Array& t, const Array& gout, double norm, const Array& gx) override {
+        Device& device = x.device();
+        device.CheckDevicesCompatible(x, t, gout, gx);
+        const Array& x_cast = x.dtype() == gx.dtype() ? x : x.AsType(gx.dtype());
+        Array t_b = BroadcastHingeLabels(x, t);
+        int64_t n_classes = x.shape()[1];
+        VisitFloatingPointDtype(gx.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            using U = LossComputeType<T>;
+            VisitDtype(t.dtype(), [&](auto t_pt) {
+                using TLabel = typename decltype(t_pt)::type;
+                struct Impl {
+                    void operator()(int64_t i, T x, TLabel t, T gout, T& gx) {
+                        U x_u = static_cast<U>(x);
+                        bool is_label = static_cast<double>(t) == static_cast<double>(i % n_classes);
+                        U bottom_diff = is_label ? U{1} - x_u : U{1} + x_u;
+                        if (bottom_diff <= 0) {
+                            gx = T{0};
+                            return;
+                        }
+                        U coeff = norm == 1 ? U{1} : norm * static_cast<U>(std::pow(bottom_diff, norm - 1));
+                        gx = static_cast<T>(static_cast<U>(gout) * (is_label ? -coeff : coeff));
+                    }
+                    int64_t n_classes;
+                    U norm;
+                };
+                Elementwise<const T, const TLabel, const T, T>(Impl{n_classes, static_cast<U>(norm)}, x_cast, t_b, gout, gx);
+            });
+        });
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(HingeGradKernel, NativeHingeGradKernel);
+
+}  // namespace
+}  // namespace native
+}  // namespace chainerx
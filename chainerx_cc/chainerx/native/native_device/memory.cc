@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <utility>
 
 #include "chainerx/device.h"
 #include "chainerx/macro.h"
@@ -15,16 +16,28 @@ std::shared_ptr<void> NativeDevice::Allocate(size_t bytesize) {
     if (bytesize == 0) {
         return std::shared_ptr<void>{nullptr};
     }
-    return std::shared_ptr<uint8_t>{new uint8_t[bytesize], std::default_delete<uint8_t[]>()};
+    auto deleter = [counter = allocated_bytes_counter(), bytesize](uint8_t* ptr) {
+        delete[] ptr;
+        counter->Subtract(bytesize);
+    };
+    auto* ptr = new uint8_t[bytesize];
+    allocated_bytes_counter()->Add(bytesize);
+    return std::shared_ptr<uint8_t>{ptr, std::move(deleter)};
 }
 
 void NativeDevice::MemoryCopyFrom(void* dst, const void* src, size_t bytesize, Device& src_device) {
     CHAINERX_ASSERT(nullptr != dynamic_cast<NativeDevice*>(&src_device) && "Native device only supports copy between native devices");
+    // Either buffer may still be used by queued kernel calls.
+    Synchronize();
+    src_device.Synchronize();
     std::memcpy(dst, src, bytesize);
 }
 
 void NativeDevice::MemoryCopyTo(void* dst, const void* src, size_t bytesize, Device& dst_device) {
     CHAINERX_ASSERT(nullptr != dynamic_cast<NativeDevice*>(&dst_device) && "Native device only supports copy between native devices");
+    // Either buffer may still be used by queued kernel calls.
+    Synchronize();
+    dst_device.Synchronize();
     std::memcpy(dst, src, bytesize);
 }
 
@@ -1,12 +1,18 @@
 #include "chainerx/native/native_device.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <type_traits>
+#include <vector>
 
 #include "chainerx/array.h"
+#include "chainerx/backend_util.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
+#include "chainerx/float16.h"
 #include "chainerx/kernels/misc.h"
+#include "chainerx/macro.h"
 #include "chainerx/native/elementwise.h"
 #include "chainerx/native/kernel_regist.h"
 #include "chainerx/numeric.h"
@@ -23,6 +29,9 @@ CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(Sign)
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(IfLessElseASSA)
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(IfGreaterElseASSA)
 CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(IfGreaterElseAAAA)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(PackBits)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(UnpackBits)
+CHAINERX_REGISTER_BUILTIN_KEY_KERNEL(UnscaleGrads)
 }  // namespace internal
 
 namespace native {
@@ -108,6 +117,85 @@ public:
 
 CHAINERX_NATIVE_REGISTER_KERNEL(IfGreaterElseAAAAKernel, NativeIfGreaterElseAAAAKernel);
 
+class NativePackBitsKernel : public PackBitsKernel {
+public:
+    void Call(const Array& x, const Array& out) override {
+        x.device().CheckDevicesCompatible(x, out);
+        CHAINERX_ASSERT(x.dtype() == Dtype::kBool);
+        CHAINERX_ASSERT(x.IsContiguous());
+        CHAINERX_ASSERT(out.dtype() == Dtype::kUInt8);
+        CHAINERX_ASSERT(out.ndim() == 1);
+        struct Impl {
+            void operator()(int64_t i, uint8_t& out) {
+                int64_t begin = i * 8;
+                int64_t end = std::min(begin + 8, size);
+                uint8_t packed{0};
+                for (int64_t j = begin; j < end; ++j) {
+                    packed |= static_cast<uint8_t>(static_cast<uint8_t>(x[j]) << (j - begin));
+                }
+                out = packed;
+            }
+            const bool* x;
+            int64_t size;
+        };
+        Elementwise<uint8_t>(Impl{static_cast<const bool*>(internal::GetRawOffsetData(x)), x.GetTotalSize()}, out);
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(PackBitsKernel, NativePackBitsKernel);
+
+class NativeUnpackBitsKernel : public UnpackBitsKernel {
+public:
+    void Call(const Array& x, const Array& out) override {
+        x.device().CheckDevicesCompatible(x, out);
+        CHAINERX_ASSERT(x.dtype() == Dtype::kUInt8);
+        CHAINERX_ASSERT(x.IsContiguous());
+        CHAINERX_ASSERT(out.dtype() == Dtype::kBool);
+        CHAINERX_ASSERT(out.ndim() == 1);
+        struct Impl {
+            void operator()(int64_t i, bool& out) { out = ((x[i / 8] >> (i % 8)) & 1U) != 0; }
+            const uint8_t* x;
+        };
+        Elementwise<bool>(Impl{static_cast<const uint8_t*>(internal::GetRawOffsetData(x))}, out);
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(UnpackBitsKernel, NativeUnpackBitsKernel);
+
+class NativeUnscaleGradsKernel : public UnscaleGradsKernel {
+public:
+    void Call(const std::vector<Array>& xs, Scalar inv_scale, const std::vector<Array>& outs, const Array& found_non_finite) override {
+        CHAINERX_ASSERT(xs.size() == outs.size());
+        CHAINERX_ASSERT(found_non_finite.dtype() == Dtype::kBool);
+        CHAINERX_ASSERT(found_non_finite.ndim() == 0);
+        auto* found = static_cast<bool*>(internal::GetRawOffsetData(found_non_finite));
+        for (size_t i = 0; i < xs.size(); ++i) {
+            const Array& x = xs[i];
+            const Array& out = outs[i];
+            x.device().CheckDevicesCompatible(x, out, found_non_finite);
+            CHAINERX_ASSERT(x.dtype() == out.dtype());
+            VisitFloatingPointDtype(x.dtype(), [&](auto pt) {
+                using T = typename decltype(pt)::type;
+                // The inverse of a large loss scale is not representable in float16.
+                using U = std::conditional_t<std::is_same<T, Float16>{}, float, T>;
+                struct Impl {
+                    void operator()(int64_t /*i*/, T x, T& out) {
+                        out = static_cast<T>(static_cast<U>(x) * inv_scale);
+                        if (chainerx::IsNan(out) || chainerx::IsInf(out)) {
+                            *found = true;
+                        }
+                    }
+                    U inv_scale;
+                    bool* found;
+                };
+                Elementwise<const T, T>(Impl{static_cast<U>(inv_scale), found}, x, out);
+            });
+        }
+    }
+};
+
+CHAINERX_NATIVE_REGISTER_KERNEL(UnscaleGradsKernel, NativeUnscaleGradsKernel);
+
 }  // namespace
 }  // namespace native
 }  // namespace chainerx
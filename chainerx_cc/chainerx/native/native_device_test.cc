@@ -1,6 +1,7 @@
 #include "chainerx/native/native_device.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <thread>
@@ -8,8 +9,17 @@
 
 #include <gtest/gtest.h>
 
+#include "chainerx/array.h"
+#include "chainerx/array_index.h"
 #include "chainerx/context.h"
+#include "chainerx/device.h"
+#include "chainerx/error.h"
 #include "chainerx/native/native_backend.h"
+#include "chainerx/routines/indexing.h"
+#include "chainerx/routines/manipulation.h"
+#include "chainerx/routines/reduction.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
 #include "chainerx/testing/threading.h"
 
 namespace chainerx {
@@ -39,6 +49,33 @@ TEST(NativeDeviceTest, Allocate) {
     EXPECT_NE(nullptr, ptr);
 }
 
+TEST(NativeDeviceTest, AllocatedBytes) {
+    Context ctx;
+    NativeDevice& device = GetNativeDevice(ctx, 0);
+    EXPECT_EQ(size_t{0}, device.allocated_bytes());
+    EXPECT_EQ(size_t{0}, device.peak_allocated_bytes());
+
+    {
+        std::shared_ptr<void> ptr1 = device.Allocate(size_t{3});
+        std::shared_ptr<void> ptr2 = device.Allocate(size_t{5});
+        EXPECT_EQ(size_t{8}, device.allocated_bytes());
+        EXPECT_EQ(size_t{8}, device.peak_allocated_bytes());
+
+        ptr1.reset();
+        EXPECT_EQ(size_t{5}, device.allocated_bytes());
+        EXPECT_EQ(size_t{8}, device.peak_allocated_bytes());
+
+        EXPECT_EQ(size_t{8}, device.ResetPeakAllocatedBytes());
+        EXPECT_EQ(size_t{5}, device.peak_allocated_bytes());
+
+        device.RaisePeakAllocatedBytes(size_t{4});
+        EXPECT_EQ(size_t{5}, device.peak_allocated_bytes());
+        device.RaisePeakAllocatedBytes(size_t{7});
+        EXPECT_EQ(size_t{7}, device.peak_allocated_bytes());
+    }
+    EXPECT_EQ(size_t{0}, device.allocated_bytes());
+}
+
 TEST(NativeDeviceTest, AllocateZero) {
     Context ctx;
     NativeDevice& device = GetNativeDevice(ctx, 0);
@@ -104,6 +141,49 @@ TEST(NativeDeviceTest, Synchronize) {
     device.Synchronize();  // no throw
 }
 
+TEST(NativeDeviceTest, AsyncKernelCalls) {
+    Context ctx;
+    ContextScope context_scope{ctx};
+    NativeDevice& device = GetNativeDevice(ctx, 0);
+    DeviceScope device_scope{device};
+    device.SetAsync(true);
+    EXPECT_TRUE(device.is_async());
+    EXPECT_NE(nullptr, device.kernel_queue());
+
+    Array a = testing::BuildArray({2, 3}).WithLinearData<float>();
+    Array b = (a + 1) * 2;
+    // Reading the data on the host waits for the queued kernel calls.
+    EXPECT_ARRAY_EQ(testing::BuildArray({2, 3}).WithData<float>({2, 4, 6, 8, 10, 12}), b);
+    EXPECT_EQ(42.f, static_cast<float>(AsScalar(Sum(b * 1))));
+
+    // So do transfers.
+    NativeDevice& device1 = GetNativeDevice(ctx, 1);
+    Array c = (b - 1).ToDevice(device1);
+    EXPECT_EQ(&device1, &c.device());
+    EXPECT_ARRAY_EQ(testing::BuildArray({2, 3}).WithData<float>({1, 3, 5, 7, 9, 11}).WithDevice(device1), c);
+
+    device.SetAsync(false);
+    EXPECT_FALSE(device.is_async());
+    EXPECT_EQ(nullptr, device.kernel_queue());
+}
+
+TEST(NativeDeviceTest, AsyncKernelCallError) {
+    Context ctx;
+    ContextScope context_scope{ctx};
+    NativeDevice& device = GetNativeDevice(ctx, 0);
+    DeviceScope device_scope{device};
+    device.SetAsync(true);
+
+    Array a = testing::BuildArray({3}).WithData<float>({1, 2, 3});
+    Array indices = testing::BuildArray({1}).WithData<int64_t>({5});
+    // The error is thrown on synchronization.
+    Array b = Take(a, indices, 0, IndexBoundsMode::kRaise);
+    EXPECT_THROW(device.Synchronize(), IndexError);
+    device.Synchronize();  // no throw
+
+    device.SetAsync(false);
+}
+
 TEST(NativeDeviceTest, GetBackendMultiThread) {
     Context ctx;
     NativeDevice& device = GetNativeDevice(ctx, 0);
@@ -12,6 +12,7 @@
 #include "chainerx/array_node.h"
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
+#include "chainerx/graph_node_pool.h"
 #include "chainerx/macro.h"
 
 namespace chainerx {
@@ -21,7 +22,7 @@ ArrayProps::ArrayProps(const Array& array) : shape{array.shape()}, dtype{array.d
 ArrayProps::ArrayProps(const ArrayNode& array_node) : shape{array_node.shape()}, dtype{array_node.dtype()}, device{array_node.device()} {}
 ArrayProps::ArrayProps(const ArrayBody& array_body) : shape{array_body.shape()}, dtype{array_body.dtype()}, device{array_body.device()} {}
 
-OpNodeBackwardEntry::OpNodeBackwardEntry(OpNode& op_node, std::vector<size_t> input_array_node_indices, BackwardFunction backward_func)
+OpNodeBackwardEntry::OpNodeBackwardEntry(OpNode& op_node, InputArrayNodeIndices input_array_node_indices, BackwardFunction backward_func)
     : op_node_{op_node}, input_array_node_indices_{std::move(input_array_node_indices)}, backward_func_{std::move(backward_func)} {}
 
 std::shared_ptr<ArrayNode> FabricateOutputArrayNode(std::shared_ptr<OpNode> op_node, size_t output_array_node_index) {
@@ -31,7 +32,7 @@ std::shared_ptr<ArrayNode> FabricateOutputArrayNode(std::shared_ptr<OpNode> op_n
 
     const ArrayProps& props = op_node->GetOutputArrayProps(output_array_node_index);
 
-    auto output_array_node = std::make_shared<ArrayNode>(props.shape, props.dtype, props.device, op_node->backprop_id());
+    auto output_array_node = MakeSharedGraphNode<ArrayNode>(props.shape, props.dtype, props.device, op_node->backprop_id());
 
     op_node->output_array_nodes()[output_array_node_index] = std::weak_ptr<ArrayNode>{output_array_node};
     output_array_node->set_creator_op_node(std::move(op_node));
@@ -42,12 +43,12 @@ std::shared_ptr<ArrayNode> FabricateOutputArrayNode(std::shared_ptr<OpNode> op_n
 // static
 std::shared_ptr<OpNode> OpNode::CreateWithOutputArrayNodes(
         std::string name, BackpropId backprop_id, size_t input_count, const std::vector<ConstArrayRef>& outputs) {
-    // Trick to use make_shared with private ctor
+    // Trick to use allocate_shared with private ctor
     struct OpNodeWithPublicCtor : OpNode {
         OpNodeWithPublicCtor(std::string name, BackpropId backprop_id, size_t input_count)
             : OpNode{std::move(name), backprop_id, input_count} {}
     };
-    std::shared_ptr<OpNode> op_node = std::make_shared<OpNodeWithPublicCtor>(std::move(name), backprop_id, input_count);
+    std::shared_ptr<OpNode> op_node = MakeSharedGraphNode<OpNodeWithPublicCtor>(std::move(name), backprop_id, input_count);
 
     for (const Array& out : outputs) {
         const std::shared_ptr<ArrayBody>& out_body = GetArrayBody(out);
@@ -150,14 +151,14 @@ void OpNode::AssertConsistency() const {
 #endif  // CHAINERX_DEBUG
 }
 
-std::vector<std::shared_ptr<ArrayNode>>& OpNode::input_array_nodes() {
+OpNodeInputArrayNodes& OpNode::input_array_nodes() {
     CHAINERX_ASSERT(std::all_of(input_array_nodes_.begin(), input_array_nodes_.end(), [this](const std::shared_ptr<ArrayNode>& arr_node) {
         return arr_node == nullptr || arr_node->backprop_id() == backprop_id_;
     }));
     return input_array_nodes_;
 }
 
-const std::vector<std::shared_ptr<ArrayNode>>& OpNode::input_array_nodes() const {
+const OpNodeInputArrayNodes& OpNode::input_array_nodes() const {
     CHAINERX_ASSERT(std::all_of(input_array_nodes_.begin(), input_array_nodes_.end(), [this](const std::shared_ptr<ArrayNode>& arr_node) {
         return arr_node == nullptr || arr_node->backprop_id() == backprop_id_;
     }));
@@ -183,7 +184,7 @@ OpNodeBackwardEntry& OpNode::RegisterBackwardFunction(
     }
 
     // Store input nodes and record indices of them
-    std::vector<size_t> input_array_node_indices;
+    InputArrayNodeIndices input_array_node_indices;
     input_array_node_indices.reserve(input_array_nodes.size());
     for (auto& tup : input_array_nodes) {
         size_t input_index = std::get<0>(tup);
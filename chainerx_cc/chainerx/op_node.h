@@ -8,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include <absl/container/inlined_vector.h>
 #include <absl/types/optional.h>
 #include <absl/types/span.h>
 
@@ -31,6 +32,13 @@ namespace internal {
 class ArrayNode;
 class OpNode;
 
+// Containers of op nodes. Most ops have a few inputs and outputs and a single backward function, which are stored inline to avoid heap
+// allocations.
+using OpNodeInputArrayNodes = absl::InlinedVector<std::shared_ptr<ArrayNode>, 3>;
+using OpNodeOutputArrayNodes = absl::InlinedVector<absl::optional<std::weak_ptr<ArrayNode>>, 2>;
+using InputArrayNodeIndices = absl::InlinedVector<size_t, 3>;
+using InputRequiredFlags = absl::InlinedVector<uint8_t, 3>;
+
 struct ArrayProps {
     explicit ArrayProps(const Array& array);
     explicit ArrayProps(const ArrayNode& array_node);
@@ -43,13 +51,13 @@ struct ArrayProps {
 
 class OpNodeBackwardEntry {
 public:
-    OpNodeBackwardEntry(OpNode& op_node, std::vector<size_t> input_array_node_indices, BackwardFunction backward_func);
+    OpNodeBackwardEntry(OpNode& op_node, InputArrayNodeIndices input_array_node_indices, BackwardFunction backward_func);
 
     OpNode& op_node() const { return op_node_; }
 
     size_t input_array_node_count() const { return input_array_node_indices_.size(); }
 
-    const std::vector<size_t>& input_array_node_indices() const { return input_array_node_indices_; }
+    const InputArrayNodeIndices& input_array_node_indices() const { return input_array_node_indices_; }
 
     const BackwardFunction& backward_func() const { return backward_func_; }
 
@@ -60,7 +68,7 @@ private:
 
     // The index mapping from local (this backward function) to global (op node).
     // Can be unset if the input array does not require grad.
-    std::vector<size_t> input_array_node_indices_;
+    InputArrayNodeIndices input_array_node_indices_;
 
     BackwardFunction backward_func_;
 };
@@ -96,6 +104,14 @@ public:
     void AddEdgesToOutputArrayNodesOfOuterGraph(
             const BackpropId& outer_backprop_id, std::vector<std::shared_ptr<ArrayNode>> outer_graphs_output_array_nodes);
 
+    // Destroys the backward functions, and thus the arrays retained by them, while keeping the backward entries.
+    // The backward functions must not be called afterwards.
+    void ReleaseBackwardFunctions() {
+        for (OpNodeBackwardEntry& backward_entry : backward_entries_) {
+            backward_entry.backward_func_ = nullptr;
+        }
+    }
+
     void Unchain() {
         backward_entries_.clear();
         std::fill(input_array_nodes_.begin(), input_array_nodes_.end(), std::shared_ptr<ArrayNode>{});
@@ -106,9 +122,9 @@ public:
 
     std::string name() const { return name_; }
 
-    std::vector<std::shared_ptr<ArrayNode>>& input_array_nodes();
+    OpNodeInputArrayNodes& input_array_nodes();
 
-    const std::vector<std::shared_ptr<ArrayNode>>& input_array_nodes() const;
+    const OpNodeInputArrayNodes& input_array_nodes() const;
 
     absl::Span<OpNodeBackwardEntry> backward_entries() { return absl::MakeSpan(backward_entries_); }
 
@@ -128,10 +144,28 @@ public:
     }
 
     // Returns the list of output array nodes on "this" graph.
-    const std::vector<absl::optional<std::weak_ptr<ArrayNode>>>& output_array_nodes() const { return output_array_nodes_; }
+    const OpNodeOutputArrayNodes& output_array_nodes() const { return output_array_nodes_; }
 
     // Returns the list of output array nodes on "this" graph.
-    std::vector<absl::optional<std::weak_ptr<ArrayNode>>>& output_array_nodes() { return output_array_nodes_; }
+    OpNodeOutputArrayNodes& output_array_nodes() { return output_array_nodes_; }
+
+    // Stamps used by the backward computation to extract the subgraph between explicitly given inputs and the outputs.
+    // Each extraction uses a unique epoch, so that the stamps never have to be cleared.
+    uint64_t visit_epoch() const { return visit_epoch_; }
+
+    void set_visit_epoch(uint64_t epoch) { visit_epoch_ = epoch; }
+
+    bool IsInSubgraph(uint64_t epoch) const { return subgraph_epoch_ == epoch; }
+
+    // Adds this op node to the subgraph of the given epoch with flags indicating whether each input is included in it.
+    void AddToSubgraph(uint64_t epoch, InputRequiredFlags input_required_flags) {
+        CHAINERX_ASSERT(input_required_flags.size() == input_array_node_count());
+        subgraph_epoch_ = epoch;
+        input_required_flags_ = std::move(input_required_flags);
+    }
+
+    // Returns the flags given to the last AddToSubgraph() call.
+    const InputRequiredFlags& input_required_flags() const { return input_required_flags_; }
 
     // Returns the input array nodes of all graphs.
     const std::vector<std::tuple<BackpropId, std::vector<std::shared_ptr<ArrayNode>>>>& outer_graphs_input_array_nodes() const {
@@ -158,10 +192,10 @@ private:
     int64_t rank_{0};
 
     // List of input array nodes.
-    std::vector<std::shared_ptr<ArrayNode>> input_array_nodes_;
+    OpNodeInputArrayNodes input_array_nodes_;
 
     // List of output array nodes of this graph.
-    std::vector<absl::optional<std::weak_ptr<ArrayNode>>> output_array_nodes_;
+    OpNodeOutputArrayNodes output_array_nodes_;
 
     // List of input/output array nodes of outer graphs.
     // Outer graphs refer to graphs with lower ordinals.
@@ -170,9 +204,13 @@ private:
     std::vector<std::tuple<BackpropId, std::vector<std::shared_ptr<ArrayNode>>>> outer_graphs_output_array_nodes_;
 
     // Array props of output array nodes. This is used for creating dummy gradients.
-    std::vector<ArrayProps> output_array_props_;
+    absl::InlinedVector<ArrayProps, 2> output_array_props_;
+
+    absl::InlinedVector<OpNodeBackwardEntry, 1> backward_entries_;
 
-    std::vector<OpNodeBackwardEntry> backward_entries_;
+    uint64_t visit_epoch_{0};
+    uint64_t subgraph_epoch_{0};
+    InputRequiredFlags input_required_flags_;
 };
 
 }  // namespace internal
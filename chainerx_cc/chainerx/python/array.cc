@@ -40,6 +40,7 @@
 
 #include "chainerx/python/array_index.h"
 #include "chainerx/python/axes.h"
+#include "chainerx/python/backward.h"
 #include "chainerx/python/common.h"
 #include "chainerx/python/device.h"
 #include "chainerx/python/dtype.h"
@@ -659,13 +660,21 @@ void InitChainerxArraySpecial(pybind11::module& m, py::class_<ArrayBody, ArrayBo
           [](const ArrayBodyPtr& self,
              const absl::optional<BackpropId>& backprop_id,
              bool enable_double_backprop,
-             absl::optional<float> loss_scale) {
+             absl::optional<float> loss_scale,
+             const std::string& execution_mode) {
               auto double_backprop = enable_double_backprop ? DoubleBackpropOption::kEnable : DoubleBackpropOption::kDisable;
-              Backward(Array{self}, backprop_id, double_backprop, loss_scale);
+              BackwardExecutionMode mode = GetBackwardExecutionMode(execution_mode);
+              Array array{self};
+              absl::optional<py::gil_scoped_release> release{};
+              if (mode != BackwardExecutionMode::kSerial) {
+                  release.emplace();
+              }
+              Backward(array, backprop_id, double_backprop, loss_scale, mode);
           },
           "backprop_id"_a = nullptr,
           "enable_double_backprop"_a = false,
-          "loss_scale"_a = nullptr);
+          "loss_scale"_a = nullptr,
+          "execution_mode"_a = "serial");
     c.def("_debug_dump_computational_graph",
           [](const ArrayBodyPtr& self, const absl::optional<BackpropId>& backprop_id) {
               DebugDumpComputationalGraph(std::cout, Array{self}, backprop_id);
@@ -691,6 +700,9 @@ void InitChainerxArraySpecial(pybind11::module& m, py::class_<ArrayBody, ArrayBo
     c.def("cleargrad",
           [](const ArrayBodyPtr& self, const absl::optional<BackpropId>& backprop_id) { Array{self}.ClearGrad(backprop_id); },
           "backprop_id"_a = nullptr);
+    c.def("zerograd",
+          [](const ArrayBodyPtr& self, const absl::optional<BackpropId>& backprop_id) { Array{self}.ZeroGrad(backprop_id); },
+          "backprop_id"_a = nullptr);
     c.def_property_readonly(
             "device", [](const ArrayBodyPtr& self) -> Device& { return self->device(); }, py::return_value_policy::reference);
     c.def_property_readonly("dtype", [m](const ArrayBodyPtr& self) { return GetNumpyDtypeFromModule(m, self->dtype()); });
@@ -4,14 +4,17 @@
 
 #include <iterator>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include <absl/types/optional.h>
+#include <pybind11/pybind11.h>
 
 #include "chainerx/array.h"
 #include "chainerx/array_body.h"
 #include "chainerx/backward.h"
+#include "chainerx/backward_fwd.h"
 #include "chainerx/graph.h"
 
 #include "chainerx/python/common.h"
@@ -39,34 +42,62 @@ std::vector<Array> ConvertToArrays(const std::vector<ArrayBodyPtr>& array_body_p
 
 }  // namespace
 
+BackwardExecutionMode GetBackwardExecutionMode(const std::string& execution_mode) {
+    if (execution_mode == "serial") {
+        return BackwardExecutionMode::kSerial;
+    }
+    if (execution_mode == "parallel_deterministic") {
+        return BackwardExecutionMode::kParallelDeterministic;
+    }
+    if (execution_mode == "parallel") {
+        return BackwardExecutionMode::kParallel;
+    }
+    throw py::value_error{"execution_mode must be one of 'serial', 'parallel_deterministic' and 'parallel'"};
+}
+
 void InitChainerxBackward(pybind11::module& m) {
     m.def("backward",
           [](const ArrayBodyPtr& body,
              const absl::optional<BackpropId>& backprop_id,
              bool enable_double_backprop,
-             absl::optional<float> loss_scale) {
+             absl::optional<float> loss_scale,
+             const std::string& execution_mode) {
               Array array{body};
               auto double_backprop = enable_double_backprop ? DoubleBackpropOption::kEnable : DoubleBackpropOption::kDisable;
-              Backward(array, backprop_id, double_backprop, loss_scale);
+              BackwardExecutionMode mode = GetBackwardExecutionMode(execution_mode);
+              // Backward functions implemented in Python acquire the GIL from the worker threads.
+              absl::optional<py::gil_scoped_release> release{};
+              if (mode != BackwardExecutionMode::kSerial) {
+                  release.emplace();
+              }
+              Backward(array, backprop_id, double_backprop, loss_scale, mode);
           },
           py::arg(),
           "backprop_id"_a = nullptr,
           "enable_double_backprop"_a = false,
-          "loss_scale"_a = nullptr);
+          "loss_scale"_a = nullptr,
+          "execution_mode"_a = "serial");
 
     m.def("backward",
           [](const std::vector<ArrayBodyPtr>& outputs,
              const absl::optional<BackpropId>& backprop_id,
              bool enable_double_backprop,
-             absl::optional<float> loss_scale) {
+             absl::optional<float> loss_scale,
+             const std::string& execution_mode) {
               std::vector<Array> arrays = ConvertToArrays(outputs);
               auto double_backprop = enable_double_backprop ? DoubleBackpropOption::kEnable : DoubleBackpropOption::kDisable;
-              Backward({arrays.begin(), arrays.end()}, backprop_id, double_backprop, loss_scale);
+              BackwardExecutionMode mode = GetBackwardExecutionMode(execution_mode);
+              absl::optional<py::gil_scoped_release> release{};
+              if (mode != BackwardExecutionMode::kSerial) {
+                  release.emplace();
+              }
+              Backward({arrays.begin(), arrays.end()}, backprop_id, double_backprop, loss_scale, mode);
           },
           py::arg(),
           "backprop_id"_a = nullptr,
           "enable_double_backprop"_a = false,
-          "loss_scale"_a = nullptr);
+          "loss_scale"_a = nullptr,
+          "execution_mode"_a = "serial");
 
     m.def("grad",
           [](const std::vector<ArrayBodyPtr>& outputs,
@@ -76,22 +107,32 @@ void InitChainerxBackward(pybind11::module& m) {
              bool set_grad,
              bool retain_grad,
              const std::vector<ArrayBodyPtr>& grad_outputs,
-             absl::optional<float> loss_scale) {
+             absl::optional<float> loss_scale,
+             const std::string& execution_mode) {
               std::vector<Array> output_arrays = ConvertToArrays(outputs);
               std::vector<Array> input_arrays = ConvertToArrays(inputs);
 
               std::vector<Array> grad_output_arrays = ConvertToArrays(grad_outputs);
 
               auto double_backprop = enable_double_backprop ? DoubleBackpropOption::kEnable : DoubleBackpropOption::kDisable;
-              std::vector<absl::optional<Array>> grads =
-                      Grad({output_arrays.begin(), output_arrays.end()},
-                           {input_arrays.begin(), input_arrays.end()},
-                           backprop_id,
-                           double_backprop,
-                           set_grad,
-                           retain_grad,
-                           std::vector<ConstArrayRef>{grad_output_arrays.begin(), grad_output_arrays.end()},
-                           loss_scale);
+              BackwardExecutionMode mode = GetBackwardExecutionMode(execution_mode);
+              std::vector<absl::optional<Array>> grads{};
+              {
+                  absl::optional<py::gil_scoped_release> release{};
+                  if (mode != BackwardExecutionMode::kSerial) {
+                      release.emplace();
+                  }
+                  grads = Grad(
+                          {output_arrays.begin(), output_arrays.end()},
+                          {input_arrays.begin(), input_arrays.end()},
+                          backprop_id,
+                          double_backprop,
+                          set_grad,
+                          retain_grad,
+                          std::vector<ConstArrayRef>{grad_output_arrays.begin(), grad_output_arrays.end()},
+                          loss_scale,
+                          mode);
+              }
               return internal::MoveArrayBodies(std::move(grads));
           },
           py::arg(),  // outputs
@@ -101,7 +142,8 @@ void InitChainerxBackward(pybind11::module& m) {
           "set_grad"_a = false,
           "retain_grad"_a = false,
           "grad_outputs"_a = std::vector<ArrayBodyPtr>{},
-          "loss_scale"_a = nullptr);
+          "loss_scale"_a = nullptr,
+          "execution_mode"_a = "serial");
 }
 
 }  // namespace python_internal
@@ -1,11 +1,18 @@
 #pragma once
 
+#include <string>
+
 #include <pybind11/pybind11.h>
 
+#include "chainerx/backward_fwd.h"
+
 namespace chainerx {
 namespace python {
 namespace python_internal {
 
+// Converts the name of an execution mode of backward, i.e. "serial", "parallel_deterministic" or "parallel".
+BackwardExecutionMode GetBackwardExecutionMode(const std::string& execution_mode);
+
 void InitChainerxBackward(pybind11::module& m);
 
 }  // namespace python_internal
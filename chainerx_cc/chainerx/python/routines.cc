@@ -1156,6 +1156,16 @@ void InitChainerxStatistics(pybind11::module& m) {
           "keepdims"_a = false);
 }
 
+ConvActivation GetConvActivation(const std::string& activation) {
+    if (activation == "none") {
+        return ConvActivation::kNone;
+    }
+    if (activation == "relu") {
+        return ConvActivation::kRelu;
+    }
+    throw py::value_error{"activation must be either 'none' or 'relu'"};
+}
+
 void InitChainerxConnection(pybind11::module& m) {
     // connection routines
     m.def("conv",
@@ -1182,6 +1192,32 @@ void InitChainerxConnection(pybind11::module& m) {
           "stride"_a = 1,
           "pad"_a = 0,
           "cover_all"_a = false);
+    m.def("conv_bias_activation",
+          [](const ArrayBodyPtr& x,
+             const ArrayBodyPtr& w,
+             const absl::optional<ArrayBodyPtr>& b,
+             py::handle stride,
+             py::handle pad,
+             bool cover_all,
+             const std::string& activation) {
+              Array x_array{x};
+              int8_t ndim = x_array.ndim() - 2;
+              return MoveArrayBody(ConvBiasActivation(
+                      x_array,
+                      Array{w},
+                      b.has_value() ? absl::optional<Array>{Array{*b}} : absl::nullopt,
+                      ToStackVector<int64_t>(stride, ndim),
+                      ToStackVector<int64_t>(pad, ndim),
+                      cover_all,
+                      GetConvActivation(activation)));
+          },
+          "x"_a,
+          "w"_a,
+          "b"_a = nullptr,
+          "stride"_a = 1,
+          "pad"_a = 0,
+          "cover_all"_a = false,
+          "activation"_a = "relu");
     m.def("conv_transpose",
           [](const ArrayBodyPtr& x,
              const ArrayBodyPtr& w,
@@ -1225,6 +1261,20 @@ void InitChainerxConnection(pybind11::module& m) {
           },
           py::arg("c"),
           py::arg("x"));
+    m.def("scaled_dot_product_attention",
+          [](const ArrayBodyPtr& q,
+             const ArrayBodyPtr& k,
+             const ArrayBodyPtr& v,
+             const absl::optional<ArrayBodyPtr>& mask,
+             absl::optional<double> scale) {
+              return MoveArrayBody(ScaledDotProductAttention(
+                      Array{q}, Array{k}, Array{v}, mask.has_value() ? absl::optional<Array>{Array{*mask}} : absl::nullopt, scale));
+          },
+          "q"_a,
+          "k"_a,
+          "v"_a,
+          "mask"_a = nullptr,
+          "scale"_a = nullptr);
 }
 
 void InitChainerxNormalization(pybind11::module& m) {
@@ -1266,6 +1316,49 @@ void InitChainerxNormalization(pybind11::module& m) {
           "var"_a,
           "eps"_a = 2e-5,
           "axis"_a = nullptr);
+    m.def("fold_fixed_batch_norm",
+          [](const ArrayBodyPtr& w,
+             const absl::optional<ArrayBodyPtr>& b,
+             const ArrayBodyPtr& gamma,
+             const ArrayBodyPtr& beta,
+             const ArrayBodyPtr& mean,
+             const ArrayBodyPtr& var,
+             Scalar eps) {
+              std::tuple<Array, Array> folded = FoldFixedBatchNorm(
+                      Array{w},
+                      b.has_value() ? absl::optional<Array>{Array{*b}} : absl::nullopt,
+                      Array{gamma},
+                      Array{beta},
+                      Array{mean},
+                      Array{var},
+                      eps);
+              return std::make_tuple(MoveArrayBody(std::move(std::get<0>(folded))), MoveArrayBody(std::move(std::get<1>(folded))));
+          },
+          "w"_a,
+          "b"_a,
+          "gamma"_a,
+          "beta"_a,
+          "mean"_a,
+          "var"_a,
+          "eps"_a = 2e-5);
+    m.def("layer_norm",
+          [](const ArrayBodyPtr& x, const ArrayBodyPtr& gamma, const ArrayBodyPtr& beta, Scalar eps, int8_t axis) {
+              return MoveArrayBody(LayerNorm(Array{x}, Array{gamma}, Array{beta}, eps, axis));
+          },
+          "x"_a,
+          "gamma"_a,
+          "beta"_a,
+          "eps"_a = 1e-5,
+          "axis"_a = -1);
+    m.def("group_norm",
+          [](const ArrayBodyPtr& x, int64_t groups, const ArrayBodyPtr& gamma, const ArrayBodyPtr& beta, Scalar eps) {
+              return MoveArrayBody(GroupNorm(Array{x}, groups, Array{gamma}, Array{beta}, eps));
+          },
+          "x"_a,
+          "groups"_a,
+          "gamma"_a,
+          "beta"_a,
+          "eps"_a = 1e-5);
 }
 
 void InitChainerxPooling(pybind11::module& m) {
@@ -1315,6 +1408,19 @@ void InitChainerxPooling(pybind11::module& m) {
           "pad_mode"_a = "ignore");
 }
 
+LossReduction GetLossReduction(const std::string& reduce) {
+    if (reduce == "no") {
+        return LossReduction::kNone;
+    }
+    if (reduce == "sum") {
+        return LossReduction::kSum;
+    }
+    if (reduce == "mean") {
+        return LossReduction::kMean;
+    }
+    throw py::value_error{"reduce must be one of 'no', 'sum' and 'mean'"};
+}
+
 void InitChainerxLoss(pybind11::module& m) {
     m.def("absolute_error",
           [](const ArrayBodyPtr& x1, const ArrayBodyPtr& x2) { return MoveArrayBody(AbsoluteError(Array{x1}, Array{x2})); },
@@ -1325,31 +1431,39 @@ void InitChainerxLoss(pybind11::module& m) {
           "x1"_a,
           "x2"_a);
     m.def("gaussian_kl_divergence",
-          [](const ArrayBodyPtr& mean, const ArrayBodyPtr& ln_var) {
-              return MoveArrayBody(GaussianKLDivergence(Array{mean}, Array{ln_var}));
+          [](const ArrayBodyPtr& mean, const ArrayBodyPtr& ln_var, const std::string& reduce) {
+              return MoveArrayBody(GaussianKLDivergence(Array{mean}, Array{ln_var}, GetLossReduction(reduce)));
           },
           "mean"_a,
-          "ln_var"_a);
+          "ln_var"_a,
+          "reduce"_a = "no");
     m.def("huber_loss",
-          [](const ArrayBodyPtr& x1, const ArrayBodyPtr& x2, Scalar delta) {
-              return MoveArrayBody(HuberLoss(Array{x1}, Array{x2}, delta));
+          [](const ArrayBodyPtr& x1, const ArrayBodyPtr& x2, Scalar delta, const std::string& reduce) {
+              return MoveArrayBody(HuberLoss(Array{x1}, Array{x2}, delta, GetLossReduction(reduce)));
           },
           "x1"_a,
           "x2"_a,
-          "delta"_a);
+          "delta"_a,
+          "reduce"_a = "no");
     m.def("sigmoid_cross_entropy",
-          [](const ArrayBodyPtr& x1, const ArrayBodyPtr& x2) { return MoveArrayBody(SigmoidCrossEntropy(Array{x1}, Array{x2})); },
+          [](const ArrayBodyPtr& x1, const ArrayBodyPtr& x2, const std::string& reduce) {
+              return MoveArrayBody(SigmoidCrossEntropy(Array{x1}, Array{x2}, GetLossReduction(reduce)));
+          },
           "x1"_a,
-          "x2"_a);
+          "x2"_a,
+          "reduce"_a = "no");
     m.def("softmax_cross_entropy",
           [](const ArrayBodyPtr& x1, const ArrayBodyPtr& x2) { return MoveArrayBody(SoftmaxCrossEntropy(Array{x1}, Array{x2})); },
           "x1"_a,
           "x2"_a);
     m.def("hinge",
-          [](const ArrayBodyPtr& x1, const ArrayBodyPtr& x2, double norm) { return MoveArrayBody(Hinge(Array{x1}, Array{x2}, norm)); },
+          [](const ArrayBodyPtr& x1, const ArrayBodyPtr& x2, double norm, const std::string& reduce) {
+              return MoveArrayBody(Hinge(Array{x1}, Array{x2}, norm, GetLossReduction(reduce)));
+          },
           "x1"_a,
           "x2"_a,
-          "norm"_a = 1.0);
+          "norm"_a = 1.0,
+          "reduce"_a = "no");
 }
 void InitChainerxRNN(pybind11::module& m) {
     m.def("n_step_lstm",
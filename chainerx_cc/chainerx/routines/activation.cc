@@ -5,12 +5,18 @@
 #include <utility>
 #include <vector>
 
+#include <absl/types/optional.h>
+
 #include "chainerx/array.h"
+#include "chainerx/backprop_mode.h"
+#include "chainerx/backward_builder.h"
+#include "chainerx/backward_context.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/enum.h"
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
+#include "chainerx/kernels/activation.h"
 #include "chainerx/macro.h"
 #include "chainerx/routines/arithmetic.h"
 #include "chainerx/routines/creation.h"
@@ -50,8 +56,29 @@ std::vector<Array> ExtractGates(const Array& x, int64_t n_splits, int64_t axis)
 
 Array ClippedRelu(const Array& x, Scalar z) {
     Dtype dtype = internal::GetMathResultDtype(x.dtype());
-    const Array& x_cast = x.dtype() == dtype ? x : x.AsType(dtype);
-    return Minimum(Maximum(0, x_cast), z);
+    Array out = Empty(x.shape(), dtype, x.device());
+    // Only the mask 0 < x < z is needed for the backward, so x itself is not retained. The mask is retained packed into bits.
+    absl::optional<Array> mask{};
+    if (x.IsBackpropRequired(AnyGraph{})) {
+        mask = Empty(x.shape(), Dtype::kBool, x.device());
+    }
+
+    {
+        NoBackpropModeScope scope{};
+        x.device().backend().CallKernel<ClippedReluKernel>(x, z, out, mask);
+    }
+
+    BackwardBuilder bb{"clipped_relu", x, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+        CHAINERX_ASSERT(mask.has_value());
+        bt.Define([mask_tok = bb.RetainMask(*mask)](BackwardContext& bctx) {
+            const Array& gout = *bctx.output_grad();
+            bctx.input_grad() = Where(bctx.GetRetainedCompactArray(mask_tok), gout, 0);
+        });
+    }
+    bb.Finalize();
+
+    return out;
 }
 
 Array CRelu(const Array& x, int8_t axis) {
@@ -65,16 +92,69 @@ Array CRelu(const Array& x, int8_t axis) {
 
 Array Elu(const Array& x, double alpha) {
     Dtype dtype = internal::GetMathResultDtype(x.dtype());
-    const Array& x_cast = x.dtype() == dtype ? x : x.AsType(dtype);
-    // TODO(aksub99): Replace x > zero with x > 0 when operator > supports scalars.
-    Array zero = Zeros({}, x_cast.dtype(), x_cast.device());
-    return Where(x_cast > zero, x_cast, alpha * Expm1(x_cast));
+    if (alpha < 0) {
+        // The gradient cannot be recovered from the output alone when alpha is negative.
+        const Array& x_cast = x.dtype() == dtype ? x : x.AsType(dtype);
+        // TODO(aksub99): Replace x > zero with x > 0 when operator > supports scalars.
+        Array zero = Zeros({}, x_cast.dtype(), x_cast.device());
+        return Where(x_cast > zero, x_cast, alpha * Expm1(x_cast));
+    }
+
+    Array out = Empty(x.shape(), dtype, x.device());
+
+    {
+        NoBackpropModeScope scope{};
+        x.device().backend().CallKernel<EluKernel>(x, alpha, out);
+    }
+
+    BackwardBuilder bb{"elu", x, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+        bt.Define([out_tok = bb.RetainOutput(0), alpha](BackwardContext& bctx) {
+            const Array& out = bctx.GetRetainedOutput(out_tok);
+            const Array& gout = *bctx.output_grad();
+            if (bctx.next_required()) {
+                Array zero = Zeros({}, out.dtype(), out.device());
+                bctx.input_grad() = Where(out > zero, gout, gout * (out + alpha));
+            } else {
+                NoBackpropModeScope scope{};
+                Array gx = EmptyLike(out, out.device());
+                out.device().backend().CallKernel<EluGradKernel>(out, gout, alpha, gx);
+                bctx.input_grad() = std::move(gx);
+            }
+        });
+    }
+    bb.Finalize();
+
+    return out;
 }
 
 Array Sigmoid(const Array& x) {
     Dtype dtype = internal::GetMathResultDtype(x.dtype());
-    const Array& x_cast = x.dtype() == dtype ? x : x.AsType(dtype);
-    return Reciprocal(1 + Exp(-x_cast));
+    Array out = Empty(x.shape(), dtype, x.device());
+
+    {
+        NoBackpropModeScope scope{};
+        x.device().backend().CallKernel<SigmoidKernel>(x, out);
+    }
+
+    BackwardBuilder bb{"sigmoid", x, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+        bt.Define([out_tok = bb.RetainOutput(0)](BackwardContext& bctx) {
+            const Array& out = bctx.GetRetainedOutput(out_tok);
+            const Array& gout = *bctx.output_grad();
+            if (bctx.next_required()) {
+                bctx.input_grad() = gout * out * (1 - out);
+            } else {
+                NoBackpropModeScope scope{};
+                Array gx = EmptyLike(out, out.device());
+                out.device().backend().CallKernel<SigmoidGradKernel>(out, gout, gx);
+                bctx.input_grad() = std::move(gx);
+            }
+        });
+    }
+    bb.Finalize();
+
+    return out;
 }
 
 Array Relu(const Array& x) {
@@ -85,10 +165,29 @@ Array Relu(const Array& x) {
 
 Array LeakyRelu(const Array& x, Scalar slope) {
     Dtype dtype = internal::GetMathResultDtype(x.dtype());
-    const Array& x_cast = x.dtype() == dtype ? x : x.AsType(dtype);
-    // TODO(hamaji): Replace x >= zero with x >= 0 when operator >= supports scalars.
-    Array zero = Zeros({}, x_cast.dtype(), x_cast.device());
-    return Where(x_cast >= zero, x_cast, slope * x_cast);
+    Array out = Empty(x.shape(), dtype, x.device());
+    // Only the mask x >= 0 is needed for the backward, so x itself is not retained. The mask is retained packed into bits.
+    absl::optional<Array> mask{};
+    if (x.IsBackpropRequired(AnyGraph{})) {
+        mask = Empty(x.shape(), Dtype::kBool, x.device());
+    }
+
+    {
+        NoBackpropModeScope scope{};
+        x.device().backend().CallKernel<LeakyReluKernel>(x, slope, out, mask);
+    }
+
+    BackwardBuilder bb{"leaky_relu", x, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+        CHAINERX_ASSERT(mask.has_value());
+        bt.Define([mask_tok = bb.RetainMask(*mask), slope](BackwardContext& bctx) {
+            const Array& gout = *bctx.output_grad();
+            bctx.input_grad() = Where(bctx.GetRetainedCompactArray(mask_tok), gout, slope * gout);
+        });
+    }
+    bb.Finalize();
+
+    return out;
 }
 
 std::vector<Array> TreeLstm(std::vector<Array> arrays) {
@@ -150,11 +249,32 @@ std::vector<Array> SLstm(const Array& c_prev1, const Array& c_prev2, const Array
 
 Array Softplus(const Array& x, double beta) {
     Dtype dtype = internal::GetMathResultDtype(x.dtype());
-    const Array& x_cast = x.dtype() == dtype ? x : x.AsType(dtype);
-    double beta_inv = 1.0 / beta;
-    Array bx = beta * x_cast;
-    Array y = (Maximum(bx, 0) + Log1p(Exp(-Fabs(bx)))) * beta_inv;
-    return y;
+    Array out = Empty(x.shape(), dtype, x.device());
+
+    {
+        NoBackpropModeScope scope{};
+        x.device().backend().CallKernel<SoftplusKernel>(x, beta, out);
+    }
+
+    BackwardBuilder bb{"softplus", x, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+        // The gradient sigmoid(beta * x) is recovered from the output as 1 - exp(-beta * y).
+        bt.Define([out_tok = bb.RetainOutput(0), beta](BackwardContext& bctx) {
+            const Array& out = bctx.GetRetainedOutput(out_tok);
+            const Array& gout = *bctx.output_grad();
+            if (bctx.next_required()) {
+                bctx.input_grad() = -gout * Expm1(-beta * out);
+            } else {
+                NoBackpropModeScope scope{};
+                Array gx = EmptyLike(out, out.device());
+                out.device().backend().CallKernel<SoftplusGradKernel>(out, gout, beta, gx);
+                bctx.input_grad() = std::move(gx);
+            }
+        });
+    }
+    bb.Finalize();
+
+    return out;
 }
 
 }  // namespace chainerx
@@ -37,6 +37,14 @@ Array Negative(const Array& x) {
     return Multiply(x, Scalar{-1, GetKind(x.dtype())});
 }
 
+Array Negative(Array&& x) {
+    if (x.dtype() == Dtype::kBool) {
+        throw DtypeError{"Cannot negate a boolean array."};
+    }
+    Scalar minus_one{-1, GetKind(x.dtype())};
+    return Multiply(std::move(x), minus_one);
+}
+
 namespace {
 
 void CheckArithmeticDtypes(DtypeKind kind1, DtypeKind kind2, bool is_multiply) {
@@ -139,6 +147,28 @@ Array Add(const Array& x1, Scalar x2) { return internal::Binary(&AddASImpl, x1,
 
 Array Add(Scalar x1, const Array& x2) { return Add(x2, x1); }
 
+Array Add(Array&& x1, const Array& x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2);
+    return internal::BroadcastBinaryDonated(&AddImpl, std::move(x1), x2, dtype, true, false);
+}
+
+Array Add(const Array& x1, Array&& x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2);
+    return internal::BroadcastBinaryDonated(&AddImpl, x1, std::move(x2), dtype, false, true);
+}
+
+Array Add(Array&& x1, Array&& x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2);
+    return internal::BroadcastBinaryDonated(&AddImpl, std::move(x1), std::move(x2), dtype, true, true);
+}
+
+Array Add(Array&& x1, Scalar x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2);
+    return internal::BinaryDonated(&AddASImpl, std::move(x1), x2, dtype);
+}
+
+Array Add(Scalar x1, Array&& x2) { return Add(std::move(x2), x1); }
+
 void SubtractImpl(const Array& x1, const Array& x2, const Array& out) {
     CheckEqual(x1.shape(), x2.shape());
 
@@ -208,6 +238,26 @@ Array Subtract(Scalar x1, const Array& x2) {
     return Add(-x2, x1);
 }
 
+Array Subtract(Array&& x1, const Array& x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2);
+    return internal::BroadcastBinaryDonated(&SubtractImpl, std::move(x1), x2, dtype, true, false);
+}
+
+Array Subtract(const Array& x1, Array&& x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2);
+    return internal::BroadcastBinaryDonated(&SubtractImpl, x1, std::move(x2), dtype, false, true);
+}
+
+Array Subtract(Array&& x1, Array&& x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2);
+    return internal::BroadcastBinaryDonated(&SubtractImpl, std::move(x1), std::move(x2), dtype, true, true);
+}
+
+Array Subtract(Array&& x1, Scalar x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2);
+    return internal::BinaryDonated(&SubtractASImpl, std::move(x1), x2, dtype);
+}
+
 void MultiplyImpl(const Array& x1, const Array& x2, const Array& out) {
     CheckEqual(x1.shape(), x2.shape());
 
@@ -271,6 +321,28 @@ Array Multiply(const Array& x1, Scalar x2) { return internal::Binary(&MultiplyAS
 
 Array Multiply(Scalar x1, const Array& x2) { return Multiply(x2, x1); }
 
+Array Multiply(Array&& x1, const Array& x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2, true);
+    return internal::BroadcastBinaryDonated(&MultiplyImpl, std::move(x1), x2, dtype, true, false);
+}
+
+Array Multiply(const Array& x1, Array&& x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2, true);
+    return internal::BroadcastBinaryDonated(&MultiplyImpl, x1, std::move(x2), dtype, false, true);
+}
+
+Array Multiply(Array&& x1, Array&& x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2, true);
+    return internal::BroadcastBinaryDonated(&MultiplyImpl, std::move(x1), std::move(x2), dtype, true, true);
+}
+
+Array Multiply(Array&& x1, Scalar x2) {
+    Dtype dtype = GetArithmeticResultDtype(x1, x2, true);
+    return internal::BinaryDonated(&MultiplyASImpl, std::move(x1), x2, dtype);
+}
+
+Array Multiply(Scalar x1, Array&& x2) { return Multiply(std::move(x2), x1); }
+
 void FloorDivideImpl(const Array& x1, const Array& x2, const Array& out) {
     CheckEqual(x1.shape(), x2.shape());
 
@@ -392,36 +464,58 @@ void IDivide(const Array& x1, Scalar x2) { ITrueDivide(x1, x2); }
 
 }  // namespace internal
 
-Array TrueDivide(const Array& x1, const Array& x2) {
-    Dtype dtype = GetArithmeticResultDtype(x1, x2);
-    if (GetKind(dtype) != DtypeKind::kFloat) {
-        dtype = internal::GetDefaultDtype(DtypeKind::kFloat);
-    }
-    return internal::BroadcastBinary(&DivideImpl, x1, x2, dtype);
-}
+namespace {
 
-Array TrueDivide(const Array& x1, Scalar x2) {
+template <typename T1, typename T2>
+Dtype GetTrueDivideResultDtype(const T1& x1, const T2& x2) {
     Dtype dtype = GetArithmeticResultDtype(x1, x2);
     if (GetKind(dtype) != DtypeKind::kFloat) {
         dtype = internal::GetDefaultDtype(DtypeKind::kFloat);
     }
-    return internal::Binary(&DivideASImpl, x1, x2, dtype);
+    return dtype;
 }
 
-Array TrueDivide(Scalar x1, const Array& x2) {
-    Dtype dtype = GetArithmeticResultDtype(x1, x2);
-    if (GetKind(dtype) != DtypeKind::kFloat) {
-        dtype = internal::GetDefaultDtype(DtypeKind::kFloat);
-    }
-    return internal::Binary(&DivideSAImpl, x1, x2, dtype);
+}  // namespace
+
+Array TrueDivide(const Array& x1, const Array& x2) {
+    return internal::BroadcastBinary(&DivideImpl, x1, x2, GetTrueDivideResultDtype(x1, x2));
 }
 
+Array TrueDivide(const Array& x1, Scalar x2) { return internal::Binary(&DivideASImpl, x1, x2, GetTrueDivideResultDtype(x1, x2)); }
+
+Array TrueDivide(Scalar x1, const Array& x2) { return internal::Binary(&DivideSAImpl, x1, x2, GetTrueDivideResultDtype(x1, x2)); }
+
 Array Divide(const Array& x1, const Array& x2) { return TrueDivide(x1, x2); }
 
+Array Divide(Array&& x1, const Array& x2) {
+    Dtype dtype = GetTrueDivideResultDtype(x1, x2);
+    return internal::BroadcastBinaryDonated(&DivideImpl, std::move(x1), x2, dtype, true, false);
+}
+
+Array Divide(const Array& x1, Array&& x2) {
+    Dtype dtype = GetTrueDivideResultDtype(x1, x2);
+    return internal::BroadcastBinaryDonated(&DivideImpl, x1, std::move(x2), dtype, false, true);
+}
+
+Array Divide(Array&& x1, Array&& x2) {
+    Dtype dtype = GetTrueDivideResultDtype(x1, x2);
+    return internal::BroadcastBinaryDonated(&DivideImpl, std::move(x1), std::move(x2), dtype, true, true);
+}
+
 Array Divide(const Array& x1, Scalar x2) { return TrueDivide(x1, x2); }
 
+Array Divide(Array&& x1, Scalar x2) {
+    Dtype dtype = GetTrueDivideResultDtype(x1, x2);
+    return internal::BinaryDonated(&DivideASImpl, std::move(x1), x2, dtype);
+}
+
 Array Divide(Scalar x1, const Array& x2) { return TrueDivide(x1, x2); }
 
+Array Divide(Scalar x1, Array&& x2) {
+    Dtype dtype = GetTrueDivideResultDtype(x1, x2);
+    return internal::BinaryDonated(&DivideSAImpl, x1, std::move(x2), dtype);
+}
+
 Array Reciprocal(const Array& x) { return Scalar{1, GetKind(x.dtype())} / x; }
 
 void PowerImpl(const Array& x1, const Array& x2, const Array& out) {
@@ -5,7 +5,12 @@
 
 namespace chainerx {
 
+// The overloads of the arithmetic routines taking rvalue arrays reuse the buffer of such an argument for the output if possible, i.e. if
+// it is a temporary referenced by nothing else and has the shape and the dtype of the output, and no argument requires grad. The output is
+// then the array of the argument itself.
+
 Array Negative(const Array& x);
+Array Negative(Array&& x);
 
 namespace internal {
 
@@ -15,8 +20,13 @@ void IAdd(const Array& x1, Scalar x2);
 }  // namespace internal
 
 Array Add(const Array& x1, const Array& x2);
+Array Add(Array&& x1, const Array& x2);
+Array Add(const Array& x1, Array&& x2);
+Array Add(Array&& x1, Array&& x2);
 Array Add(const Array& x1, Scalar x2);
+Array Add(Array&& x1, Scalar x2);
 Array Add(Scalar x1, const Array& x2);
+Array Add(Scalar x1, Array&& x2);
 
 namespace internal {
 
@@ -26,7 +36,11 @@ void ISubtract(const Array& x1, Scalar x2);
 }  // namespace internal
 
 Array Subtract(const Array& x1, const Array& x2);
+Array Subtract(Array&& x1, const Array& x2);
+Array Subtract(const Array& x1, Array&& x2);
+Array Subtract(Array&& x1, Array&& x2);
 Array Subtract(const Array& x1, Scalar x2);
+Array Subtract(Array&& x1, Scalar x2);
 Array Subtract(Scalar x1, const Array& x2);
 
 namespace internal {
@@ -37,8 +51,13 @@ void IMultiply(const Array& x1, Scalar x2);
 }  // namespace internal
 
 Array Multiply(const Array& x1, const Array& x2);
+Array Multiply(Array&& x1, const Array& x2);
+Array Multiply(const Array& x1, Array&& x2);
+Array Multiply(Array&& x1, Array&& x2);
 Array Multiply(const Array& x1, Scalar x2);
+Array Multiply(Array&& x1, Scalar x2);
 Array Multiply(Scalar x1, const Array& x2);
+Array Multiply(Scalar x1, Array&& x2);
 
 namespace internal {
 
@@ -58,8 +77,13 @@ Array FloorDivide(const Array& x1, Scalar x2);
 Array FloorDivide(Scalar x1, const Array& x2);
 
 Array Divide(const Array& x1, const Array& x2);
+Array Divide(Array&& x1, const Array& x2);
+Array Divide(const Array& x1, Array&& x2);
+Array Divide(Array&& x1, Array&& x2);
 Array Divide(const Array& x1, Scalar x2);
+Array Divide(Array&& x1, Scalar x2);
 Array Divide(Scalar x1, const Array& x2);
+Array Divide(Scalar x1, Array&& x2);
 
 Array TrueDivide(const Array& x1, const Array& x2);
 Array TrueDivide(const Array& x1, Scalar x2);
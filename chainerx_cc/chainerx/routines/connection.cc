@@ -1,8 +1,13 @@
 #include "chainerx/routines/connection.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -16,20 +21,24 @@
 #include "chainerx/constant.h"
 #include "chainerx/device.h"
 #include "chainerx/dims.h"
+#include "chainerx/dtype.h"
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
 #include "chainerx/kernel_registry.h"
 #include "chainerx/kernels/arithmetic.h"
 #include "chainerx/kernels/connection.h"
 #include "chainerx/kernels/linalg.h"
+#include "chainerx/kernels/misc.h"
 #include "chainerx/macro.h"
 #include "chainerx/routines/activation.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/hyperbolic.h"
+#include "chainerx/routines/indexing.h"
 #include "chainerx/routines/linalg.h"
 #include "chainerx/routines/manipulation.h"
 #include "chainerx/routines/reduction.h"
 #include "chainerx/routines/type_util.h"
+#include "chainerx/scalar.h"
 
 namespace chainerx {
 namespace internal {
@@ -135,8 +144,139 @@ void ConvCheckNdim(const Array& x, const Array& w, const Dims& stride, const Dim
     }
 }
 
+void ConvCheckInputs(const Array& x, const Array& w, const absl::optional<Array>& b, const Dims& stride, const Dims& pad) {
+    ConvCheckNdim(x, w, stride, pad);
+    if (w.shape()[1] != x.shape()[1]) {
+        throw DimensionError{"Mismatched number of input channels in input ", x.shape(), " and weights ", w.shape(), "."};
+    }
+    if (b.has_value() && (b->ndim() != 1 || b->shape()[0] != w.shape()[0])) {
+        throw DimensionError{"Mismatched bias shape ", b->shape(), " for weights ", w.shape(), "."};
+    }
+}
+
+// Views a (..., m, n) array as an array of shape (batch_size, m, n) by flattening its leading axes.
+Array FlattenAttentionBatch(const Array& a) {
+    CHAINERX_ASSERT(a.ndim() >= 2);
+    int64_t batch_size = std::accumulate(a.shape().begin(), a.shape().end() - 2, int64_t{1}, std::multiplies<>());
+    return a.Reshape({batch_size, a.shape()[a.ndim() - 2], a.shape()[a.ndim() - 1]});
+}
+
+// Returns the (len_q, len_k) attention probabilities of a single batch entry. The probabilities of masked keys are zeros.
+Array ComputeAttentionProbs(const Array& q, const Array& k, const absl::optional<Array>& mask, double scale) {
+    if (k.shape()[0] == 0) {
+        return Zeros({q.shape()[0], 0}, q.dtype(), q.device());
+    }
+    Array scores = Dot(q, k.Transpose()) * scale;
+    if (!mask.has_value()) {
+        return Softmax(scores, Axes{1});
+    }
+    // Queries whose keys are all masked give NaNs in the softmax, which are discarded by the outer Where.
+    Array masked_scores = Where(*mask, scores, -std::numeric_limits<double>::infinity());
+    return Where(*mask, Softmax(masked_scores, Axes{1}), 0);
+}
+
+// Computes the attention with routines, one batch entry at a time.
+Array ComputeAttention(const Array& q, const Array& k, const Array& v, const absl::optional<Array>& mask, double scale) {
+    Shape out_shape = q.shape();
+    out_shape.back() = v.shape().back();
+
+    Array q_flat = FlattenAttentionBatch(q);
+    Array k_flat = FlattenAttentionBatch(k);
+    Array v_flat = FlattenAttentionBatch(v);
+    absl::optional<Array> mask_flat = mask.has_value() ? absl::optional<Array>{FlattenAttentionBatch(*mask)} : absl::nullopt;
+    int64_t batch_size = q_flat.shape()[0];
+    if (batch_size == 0) {
+        return Zeros(out_shape, q.dtype(), q.device());
+    }
+
+    std::vector<Array> outs;
+    outs.reserve(batch_size);
+    for (int64_t i = 0; i < batch_size; ++i) {
+        absl::optional<Array> mask_i = mask_flat.has_value() ? absl::optional<Array>{mask_flat->At({i})} : absl::nullopt;
+        outs.emplace_back(Dot(ComputeAttentionProbs(q_flat.At({i}), k_flat.At({i}), mask_i, scale), v_flat.At({i})));
+    }
+    return Stack(outs, 0).Reshape(out_shape);
+}
+
+// Computes the gradients of the attention with respect to q, k and v with routines, one batch entry at a time.
+// The probabilities are recomputed from q and k.
+std::tuple<Array, Array, Array> ComputeAttentionGrad(
+        const Array& q, const Array& k, const Array& v, const absl::optional<Array>& mask, double scale, const Array& gout) {
+    Array q_flat = FlattenAttentionBatch(q);
+    Array k_flat = FlattenAttentionBatch(k);
+    Array v_flat = FlattenAttentionBatch(v);
+    Array gout_flat = FlattenAttentionBatch(gout);
+    absl::optional<Array> mask_flat = mask.has_value() ? absl::optional<Array>{FlattenAttentionBatch(*mask)} : absl::nullopt;
+    int64_t batch_size = q_flat.shape()[0];
+    if (batch_size == 0) {
+        return std::make_tuple(
+                Zeros(q.shape(), q.dtype(), q.device()), Zeros(k.shape(), k.dtype(), k.device()), Zeros(v.shape(), v.dtype(), v.device()));
+    }
+
+    std::vector<Array> gqs;
+    std::vector<Array> gks;
+    std::vector<Array> gvs;
+    gqs.reserve(batch_size);
+    gks.reserve(batch_size);
+    gvs.reserve(batch_size);
+    for (int64_t i = 0; i < batch_size; ++i) {
+        const Array& q_i = q_flat.At({i});
+        const Array& k_i = k_flat.At({i});
+        const Array& v_i = v_flat.At({i});
+        const Array& gout_i = gout_flat.At({i});
+        absl::optional<Array> mask_i = mask_flat.has_value() ? absl::optional<Array>{mask_flat->At({i})} : absl::nullopt;
+        Array probs = ComputeAttentionProbs(q_i, k_i, mask_i, scale);
+        Array gprobs = Dot(gout_i, v_i.Transpose());
+        Array gscores = probs * (gprobs - Sum(gprobs * probs, Axes{1}, true)) * scale;
+        gqs.emplace_back(Dot(gscores, k_i));
+        gks.emplace_back(Dot(gscores.Transpose(), q_i));
+        gvs.emplace_back(Dot(probs.Transpose(), gout_i));
+    }
+    return std::make_tuple(Stack(gqs, 0).Reshape(q.shape()), Stack(gks, 0).Reshape(k.shape()), Stack(gvs, 0).Reshape(v.shape()));
+}
+
 }  // namespace
 
+Array GenericConvBiasActivationKernel::Call(
+        const Array& x,
+        const Array& w,
+        const absl::optional<Array>& b,
+        const Dims& stride,
+        const Dims& pad,
+        bool cover_all,
+        ConvActivation activation,
+        Dtype out_dtype) {
+    Array out = x.device().backend().CallKernel<ConvKernel>(x, w, b, stride, pad, cover_all, out_dtype, absl::nullopt);
+    switch (activation) {
+        case ConvActivation::kNone:
+            break;
+        case ConvActivation::kRelu:
+            // out = out < 0 ? 0 : out
+            out.device().backend().CallKernel<IfLessElseASSAKernel>(out, Scalar{0}, Scalar{0}, out, out);
+            break;
+        default:
+            CHAINERX_NEVER_REACH();
+    }
+    return out;
+}
+
+std::tuple<Array, std::unique_ptr<ScaledDotProductAttentionGradState>> GenericScaledDotProductAttentionKernel::Call(
+        const Array& q, const Array& k, const Array& v, const absl::optional<Array>& mask, double scale, bool /*return_state*/) {
+    return std::make_tuple(ComputeAttention(q, k, v, mask, scale), nullptr);
+}
+
+std::tuple<Array, Array, Array> GenericScaledDotProductAttentionGradKernel::Call(
+        const Array& q,
+        const Array& k,
+        const Array& v,
+        const absl::optional<Array>& mask,
+        double scale,
+        const Array& /*out*/,
+        const Array& gout,
+        const std::shared_ptr<ScaledDotProductAttentionGradState>& /*state*/) {
+    return ComputeAttentionGrad(q, k, v, mask, scale, gout);
+}
+
 Array Conv(
         const Array& x,
         const Array& w,
@@ -145,13 +285,7 @@ Array Conv(
         const Dims& pad,
         bool cover_all,
         absl::optional<Dtype> out_dtype) {
-    ConvCheckNdim(x, w, stride, pad);
-    if (w.shape()[1] != x.shape()[1]) {
-        throw DimensionError{"Mismatched number of input channels in input ", x.shape(), " and weights ", w.shape(), "."};
-    }
-    if (b.has_value() && (b->ndim() != 1 || b->shape()[0] != w.shape()[0])) {
-        throw DimensionError{"Mismatched bias shape ", b->shape(), " for weights ", w.shape(), "."};
-    }
+    ConvCheckInputs(x, w, b, stride, pad);
 
     Dtype real_out_dtype = out_dtype.has_value() ? *out_dtype : b.has_value() ? ResultType(x, w, *b) : ResultType(x, w);
 
@@ -207,6 +341,37 @@ Array Conv(
     return out;
 }
 
+Array ConvBiasActivation(
+        const Array& x,
+        const Array& w,
+        const absl::optional<Array>& b,
+        const Dims& stride,
+        const Dims& pad,
+        bool cover_all,
+        ConvActivation activation) {
+    ConvCheckInputs(x, w, b, stride, pad);
+
+    Dtype out_dtype = b.has_value() ? ResultType(x, w, *b) : ResultType(x, w);
+    if (GetKind(out_dtype) != DtypeKind::kFloat) {
+        throw DtypeError{"ConvBiasActivation requires a floating-point output dtype. Actual: ", out_dtype, "."};
+    }
+
+    if (x.IsBackpropRequired(AnyGraph{}) || w.IsBackpropRequired(AnyGraph{}) || (b.has_value() && b->IsBackpropRequired(AnyGraph{}))) {
+        Array y = Conv(x, w, b, stride, pad, cover_all, out_dtype);
+        switch (activation) {
+            case ConvActivation::kNone:
+                return y;
+            case ConvActivation::kRelu:
+                return Relu(y);
+            default:
+                CHAINERX_NEVER_REACH();
+        }
+    }
+
+    NoBackpropModeScope scope{};
+    return x.device().backend().CallKernel<ConvBiasActivationKernel>(x, w, b, stride, pad, cover_all, activation, out_dtype);
+}
+
 Array ConvTranspose(
         const Array& x,
         const Array& w,
@@ -445,4 +610,87 @@ std::vector<Array> Lstm(const Array& c, const Array& x) {
     return out;
 }
 
+Array ScaledDotProductAttention(
+        const Array& q, const Array& k, const Array& v, const absl::optional<Array>& mask, absl::optional<double> scale) {
+    if (q.ndim() < 2) {
+        throw DimensionError{"ScaledDotProductAttention requires q with at least 2 dimensions. Actual: ", q.ndim(), "."};
+    }
+    if (k.ndim() != q.ndim() || v.ndim() != q.ndim()) {
+        throw DimensionError{"Mismatched number of dimensions of q ", q.ndim(), ", k ", k.ndim(), " and v ", v.ndim(), "."};
+    }
+    int8_t ndim = q.ndim();
+    if (!std::equal(q.shape().begin(), q.shape().end() - 2, k.shape().begin()) ||
+        !std::equal(q.shape().begin(), q.shape().end() - 2, v.shape().begin())) {
+        throw DimensionError{"Mismatched batch shapes of q ", q.shape(), ", k ", k.shape(), " and v ", v.shape(), "."};
+    }
+    if (q.shape()[ndim - 1] != k.shape()[ndim - 1]) {
+        throw DimensionError{"Mismatched feature sizes of q ", q.shape(), " and k ", k.shape(), "."};
+    }
+    if (k.shape()[ndim - 2] != v.shape()[ndim - 2]) {
+        throw DimensionError{"Mismatched numbers of keys of k ", k.shape(), " and values of v ", v.shape(), "."};
+    }
+    if (GetKind(q.dtype()) != DtypeKind::kFloat) {
+        throw DtypeError{"ScaledDotProductAttention operation requires floating point inputs. Actual: ", q.dtype(), "."};
+    }
+    if (k.dtype() != q.dtype() || v.dtype() != q.dtype()) {
+        throw DtypeError{"Mismatched dtypes of q ", q.dtype(), ", k ", k.dtype(), " and v ", v.dtype(), "."};
+    }
+
+    // The mask is broadcast without copying, so that the (len_q, len_k) matrix is only materialized if the given mask is.
+    absl::optional<Array> mask_broadcast{};
+    if (mask.has_value()) {
+        if (mask->dtype() != Dtype::kBool) {
+            throw DtypeError{"Mask of ScaledDotProductAttention must be of bool dtype. Actual: ", mask->dtype(), "."};
+        }
+        Shape scores_shape = q.shape();
+        scores_shape.back() = k.shape()[ndim - 2];
+        mask_broadcast = mask->AsGradStopped().BroadcastTo(scores_shape);
+    }
+    int64_t d = q.shape()[ndim - 1];
+    double actual_scale = scale.has_value() ? *scale : (d > 0 ? 1.0 / std::sqrt(static_cast<double>(d)) : 1.0);
+
+    Array out{};
+    std::shared_ptr<ScaledDotProductAttentionGradState> state{};
+    {
+        NoBackpropModeScope scope{};
+        std::tie(out, state) = q.device().backend().CallKernel<ScaledDotProductAttentionKernel>(
+                q.AsGradStopped(), k.AsGradStopped(), v.AsGradStopped(), mask_broadcast, actual_scale, true);
+    }
+
+    BackwardBuilder bb{"scaled_dot_product_attention", {q, k, v}, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget({0, 1, 2})) {
+        bt.Define([q_tok = bb.RetainInput(0),
+                   k_tok = bb.RetainInput(1),
+                   v_tok = bb.RetainInput(2),
+                   out_tok = bb.RetainOutput(0),
+                   mask = std::move(mask_broadcast),
+                   actual_scale,
+                   state = std::move(state)](BackwardContext& bctx) {
+            const Array& gout = *bctx.output_grad();
+            const Array& q = bctx.GetRetainedInput(q_tok);
+            const Array& k = bctx.GetRetainedInput(k_tok);
+            const Array& v = bctx.GetRetainedInput(v_tok);
+
+            Array gq{};
+            Array gk{};
+            Array gv{};
+            if (bctx.next_required()) {
+                std::tie(gq, gk, gv) = ComputeAttentionGrad(q, k, v, mask, actual_scale, gout);
+            } else {
+                NoBackpropModeScope scope{};
+                const Array& out = bctx.GetRetainedOutput(out_tok);
+                std::tie(gq, gk, gv) = q.device().backend().CallKernel<ScaledDotProductAttentionGradKernel>(
+                        q, k, v, mask, actual_scale, out, gout, state);
+            }
+
+            bctx.input_grad(0) = std::move(gq);
+            bctx.input_grad(1) = std::move(gk);
+            bctx.input_grad(2) = std::move(gv);
+        });
+    }
+    bb.Finalize();
+
+    return out;
+}
+
 }  // namespace chainerx
@@ -37,6 +37,26 @@ Array Conv(
         bool cover_all = false,
         absl::optional<Dtype> out_dtype = absl::nullopt);
 
+// Activation applied by ConvBiasActivation.
+enum class ConvActivation {
+    kNone = 1,
+    kRelu,
+};
+
+// Computes the n-dimensional convolution followed by the bias addition and the activation, for inference.
+//
+// The activation is applied in place on the convolution output, so that no intermediate array is allocated.
+// Combined with FoldFixedBatchNorm, this replaces a Conv, FixedBatchNorm and activation sequence with a single call.
+// If backprop is required for any of the inputs, the result is computed with Conv and the differentiable activation instead.
+Array ConvBiasActivation(
+        const Array& x,
+        const Array& w,
+        const absl::optional<Array>& b,
+        const Dims& stride,
+        const Dims& pad,
+        bool cover_all = false,
+        ConvActivation activation = ConvActivation::kRelu);
+
 Array ConvTranspose(
         const Array& x,
         const Array& w,
@@ -50,4 +70,20 @@ Array Linear(const Array& x, const Array& w, const absl::optional<Array>& b = ab
 
 std::vector<Array> Lstm(const Array& c, const Array& x);
 
+// Computes the scaled dot-product attention softmax(scale * q k^T) v.
+//
+// q: (..., len_q, d)
+// k: (..., len_k, d)
+// v: (..., len_k, d_v)
+// mask: bool array broadcastable to (..., len_q, len_k). Keys for which the mask is false are ignored.
+//
+// The scale defaults to 1 / sqrt(d). Returns an array of shape (..., len_q, d_v).
+// Queries whose keys are all masked yield zeros.
+Array ScaledDotProductAttention(
+        const Array& q,
+        const Array& k,
+        const Array& v,
+        const absl::optional<Array>& mask = absl::nullopt,
+        absl::optional<double> scale = absl::nullopt);
+
 }  // namespace chainerx
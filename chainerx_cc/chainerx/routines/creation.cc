@@ -18,6 +18,7 @@
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/graph.h"
+#include "chainerx/kernel_call_recorder.h"
 #include "chainerx/kernels/creation.h"
 #include "chainerx/kernels/misc.h"
 #include "chainerx/macro.h"
@@ -29,6 +30,32 @@
 
 namespace chainerx {
 namespace internal {
+namespace {
+
+// Allocates a buffer for an uninitialized array.
+std::shared_ptr<void> AllocateEmpty(Device& device, size_t bytesize) {
+    std::shared_ptr<void> data = device.Allocate(bytesize);
+    if (KernelCallRecorder* recorder = GetKernelCallRecorder()) {
+        recorder->RecordAllocation(data, bytesize);
+    }
+    return data;
+}
+
+// Deleter of the data of arrays sharing buffers not allocated by ChainerX, which keeps the original owner alive.
+struct ForeignDataDeleter {
+    void operator()(void* /*ptr*/) { data.reset(); }
+
+    std::shared_ptr<void> data;
+};
+
+std::shared_ptr<void> MakeForeignData(std::shared_ptr<void> data) {
+    void* ptr = data.get();
+    return std::shared_ptr<void>{ptr, ForeignDataDeleter{std::move(data)}};
+}
+
+}  // namespace
+
+bool IsForeignData(const std::shared_ptr<void>& data) { return std::get_deleter<ForeignDataDeleter>(data) != nullptr; }
 
 size_t GetRequiredBytes(const Shape& shape, const Strides& strides, size_t item_size) {
     CHAINERX_ASSERT(shape.ndim() == strides.ndim());
@@ -50,12 +77,16 @@ Array FromHostData(
     auto range = GetDataRange(shape, strides, GetItemSize(dtype));
     // TODO(niboshi): Copy only required region. Currently the whole preceding (offset) region is copied.
     std::shared_ptr<void> device_data = device.FromHostMemory(data, offset + std::get<1>(range));
+    // The host data may be shared instead of copied, e.g. by native devices.
+    if (device_data.get() == data.get()) {
+        device_data = MakeForeignData(std::move(device_data));
+    }
     return internal::MakeArray(shape, strides, dtype, device, std::move(device_data), offset);
 }
 
 Array Empty(const Shape& shape, Dtype dtype, const Strides& strides, Device& device) {
     auto bytesize = GetRequiredBytes(shape, strides, GetItemSize(dtype));
-    std::shared_ptr<void> data = device.Allocate(bytesize);
+    std::shared_ptr<void> data = AllocateEmpty(device, bytesize);
     return MakeArray(shape, strides, dtype, device, std::move(data));
 }
 
@@ -86,12 +117,17 @@ Array FromData(
         int64_t offset,
         Device& device) {
     return internal::MakeArray(
-            shape, strides.value_or(Strides{shape, dtype}), dtype, device, device.MakeDataFromForeignPointer(data), offset);
+            shape,
+            strides.value_or(Strides{shape, dtype}),
+            dtype,
+            device,
+            internal::MakeForeignData(device.MakeDataFromForeignPointer(data)),
+            offset);
 }
 
 Array Empty(const Shape& shape, Dtype dtype, Device& device) {
     auto bytesize = static_cast<size_t>(shape.GetTotalSize() * GetItemSize(dtype));
-    std::shared_ptr<void> data = device.Allocate(bytesize);
+    std::shared_ptr<void> data = internal::AllocateEmpty(device, bytesize);
     return internal::MakeArray(shape, Strides{shape, dtype}, dtype, device, std::move(data));
 }
 
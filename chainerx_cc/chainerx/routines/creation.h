@@ -32,6 +32,10 @@ Array FromHostData(
         int64_t offset,
         Device& device = GetDefaultDevice());
 
+// Returns whether the data is a buffer given to FromData() or FromHostData() and shared with the caller instead of copied. Such buffers
+// may be referenced outside ChainerX and are therefore never reused as outputs of routines.
+bool IsForeignData(const std::shared_ptr<void>& data);
+
 // Creates an empty array with specified strides.
 Array Empty(const Shape& shape, Dtype dtype, const Strides& strides, Device& device = GetDefaultDevice());
 
@@ -0,0 +1,336 @@
+#include "chainerx/routines/fusion.h"
+
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <absl/types/optional.h>
+
+#include "chainerx/array.h"
+#include "chainerx/array_body.h"
+#include "chainerx/backend.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/graph.h"
+#include "chainerx/kernels/fusion.h"
+#include "chainerx/macro.h"
+#include "chainerx/routines/activation.h"
+#include "chainerx/routines/arithmetic.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/explog.h"
+#include "chainerx/routines/hyperbolic.h"
+#include "chainerx/routines/misc.h"
+#include "chainerx/scalar.h"
+#include "chainerx/shape.h"
+
+namespace chainerx {
+namespace internal {
+
+// A node of a lazy expression, which is either an array or an operation.
+// Operands of an operation are lhs, and rhs or scalar if binary.
+struct LazyArrayNode {
+    absl::optional<Array> array;
+    FusedElementwiseOp op{};
+    std::shared_ptr<const LazyArrayNode> lhs;
+    std::shared_ptr<const LazyArrayNode> rhs;
+    absl::optional<Scalar> scalar;
+    bool scalar_is_lhs{false};
+};
+
+}  // namespace internal
+
+namespace {
+
+using internal::LazyArrayNode;
+
+LazyArray MakeUnary(FusedElementwiseOp op, const LazyArray& x) {
+    auto node = std::make_shared<LazyArrayNode>();
+    node->op = op;
+    node->lhs = x.node();
+    return LazyArray{std::move(node)};
+}
+
+LazyArray MakeBinary(FusedElementwiseOp op, const LazyArray& x1, const LazyArray& x2) {
+    auto node = std::make_shared<LazyArrayNode>();
+    node->op = op;
+    node->lhs = x1.node();
+    node->rhs = x2.node();
+    return LazyArray{std::move(node)};
+}
+
+LazyArray MakeBinary(FusedElementwiseOp op, const LazyArray& x, Scalar scalar, bool scalar_is_lhs) {
+    auto node = std::make_shared<LazyArrayNode>();
+    node->op = op;
+    node->lhs = x.node();
+    node->scalar = scalar;
+    node->scalar_is_lhs = scalar_is_lhs;
+    return LazyArray{std::move(node)};
+}
+
+// Flattens an expression into the arguments of FusedElementwiseKernel.
+// Nodes shared in the expression, and nodes of the same array, are evaluated once.
+class FusedElementwiseProgram {
+public:
+    explicit FusedElementwiseProgram(const LazyArrayNode& root) { Visit(root); }
+
+    // Returns whether the program can be evaluated by FusedElementwiseKernel.
+    bool CanFuse() const {
+        // A single operation is not faster fused.
+        if (instructions_.size() < 2) {
+            return false;
+        }
+        const Array& first = inputs_.front();
+        if (GetKind(first.dtype()) != DtypeKind::kFloat) {
+            return false;
+        }
+        for (const Array& input : inputs_) {
+            if (input.dtype() != first.dtype() || &input.device() != &first.device() || input.IsBackpropRequired(AnyGraph{})) {
+                return false;
+            }
+        }
+        return first.device().backend().kernel_registry().HasKernel<FusedElementwiseKernel>();
+    }
+
+    Array Evaluate() const {
+        const Array& first = inputs_.front();
+        Shape shape = first.shape();
+        for (const Array& input : inputs_) {
+            shape = internal::BroadcastShapes(shape, input.shape());
+        }
+
+        // Operands are resolved to the indices of the values of the loop: the inputs, the scalars, and the results of the instructions.
+        auto resolve = [this](const Operand& operand) {
+            switch (operand.kind) {
+                case OperandKind::kInput:
+                    return operand.index;
+                case OperandKind::kScalar:
+                    return inputs_.size() + operand.index;
+                case OperandKind::kInstruction:
+                    return inputs_.size() + scalars_.size() + operand.index;
+                default:
+                    CHAINERX_NEVER_REACH();
+            }
+        };
+        std::vector<FusedElementwiseInstruction> instructions;
+        instructions.reserve(instructions_.size());
+        for (const Instruction& instruction : instructions_) {
+            instructions.emplace_back(FusedElementwiseInstruction{instruction.op, resolve(instruction.lhs), resolve(instruction.rhs)});
+        }
+
+        Array out = Empty(shape, first.dtype(), first.device());
+        first.device().backend().CallKernel<FusedElementwiseKernel>(inputs_, scalars_, instructions, out);
+        return out;
+    }
+
+private:
+    enum class OperandKind {
+        kInput,
+        kScalar,
+        kInstruction,
+    };
+
+    struct Operand {
+        OperandKind kind;
+        size_t index;
+    };
+
+    struct Instruction {
+        FusedElementwiseOp op;
+        Operand lhs;
+        Operand rhs;
+    };
+
+    Operand Visit(const LazyArrayNode& node) {
+        auto it = visited_.find(&node);
+        if (it != visited_.end()) {
+            return it->second;
+        }
+
+        Operand result{};
+        if (node.array.has_value()) {
+            const internal::ArrayBody* array_body = internal::GetArrayBody(*node.array).get();
+            auto input_it = input_indices_.find(array_body);
+            if (input_it == input_indices_.end()) {
+                input_it = input_indices_.emplace(array_body, inputs_.size()).first;
+                inputs_.emplace_back(*node.array);
+            }
+            result = Operand{OperandKind::kInput, input_it->second};
+        } else {
+            Operand x = Visit(*node.lhs);
+            Operand lhs = x;
+            Operand rhs = x;
+            if (node.scalar.has_value()) {
+                Operand scalar{OperandKind::kScalar, scalars_.size()};
+                scalars_.emplace_back(*node.scalar);
+                (node.scalar_is_lhs ? lhs : rhs) = scalar;
+            } else if (node.rhs != nullptr) {
+                rhs = Visit(*node.rhs);
+            }
+            instructions_.emplace_back(Instruction{node.op, lhs, rhs});
+            result = Operand{OperandKind::kInstruction, instructions_.size() - 1};
+        }
+        visited_.emplace(&node, result);
+        return result;
+    }
+
+    std::vector<Array> inputs_;
+    std::vector<Scalar> scalars_;
+    std::vector<Instruction> instructions_;
+    std::unordered_map<const internal::ArrayBody*, size_t> input_indices_;
+    std::unordered_map<const LazyArrayNode*, Operand> visited_;
+};
+
+Array EvaluateBinary(FusedElementwiseOp op, const Array& x1, const Array& x2) {
+    switch (op) {
+        case FusedElementwiseOp::kAdd:
+            return Add(x1, x2);
+        case FusedElementwiseOp::kSubtract:
+            return Subtract(x1, x2);
+        case FusedElementwiseOp::kMultiply:
+            return Multiply(x1, x2);
+        case FusedElementwiseOp::kDivide:
+            return Divide(x1, x2);
+        default:
+            CHAINERX_NEVER_REACH();
+    }
+}
+
+Array EvaluateBinary(FusedElementwiseOp op, const Array& x1, Scalar x2) {
+    switch (op) {
+        case FusedElementwiseOp::kAdd:
+            return Add(x1, x2);
+        case FusedElementwiseOp::kSubtract:
+            return Subtract(x1, x2);
+        case FusedElementwiseOp::kMultiply:
+            return Multiply(x1, x2);
+        case FusedElementwiseOp::kDivide:
+            return Divide(x1, x2);
+        default:
+            CHAINERX_NEVER_REACH();
+    }
+}
+
+Array EvaluateBinary(FusedElementwiseOp op, Scalar x1, const Array& x2) {
+    switch (op) {
+        case FusedElementwiseOp::kAdd:
+            return Add(x1, x2);
+        case FusedElementwiseOp::kSubtract:
+            return Subtract(x1, x2);
+        case FusedElementwiseOp::kMultiply:
+            return Multiply(x1, x2);
+        case FusedElementwiseOp::kDivide:
+            return Divide(x1, x2);
+        default:
+            CHAINERX_NEVER_REACH();
+    }
+}
+
+Array EvaluateUnary(FusedElementwiseOp op, const Array& x) {
+    switch (op) {
+        case FusedElementwiseOp::kNegative:
+            return Negative(x);
+        case FusedElementwiseOp::kExp:
+            return Exp(x);
+        case FusedElementwiseOp::kLog:
+            return Log(x);
+        case FusedElementwiseOp::kSqrt:
+            return Sqrt(x);
+        case FusedElementwiseOp::kSquare:
+            return Square(x);
+        case FusedElementwiseOp::kReciprocal:
+            return Reciprocal(x);
+        case FusedElementwiseOp::kTanh:
+            return Tanh(x);
+        case FusedElementwiseOp::kSigmoid:
+            return Sigmoid(x);
+        default:
+            CHAINERX_NEVER_REACH();
+    }
+}
+
+// Evaluates an expression by the routines, which record the graph of each operation.
+Array EvaluateUnfused(const LazyArrayNode& node, std::unordered_map<const LazyArrayNode*, Array>& results) {
+    if (node.array.has_value()) {
+        return *node.array;
+    }
+    auto it = results.find(&node);
+    if (it != results.end()) {
+        return it->second;
+    }
+
+    Array x = EvaluateUnfused(*node.lhs, results);
+    Array result{};
+    if (node.scalar.has_value()) {
+        result = node.scalar_is_lhs ? EvaluateBinary(node.op, *node.scalar, x) : EvaluateBinary(node.op, x, *node.scalar);
+    } else if (node.rhs != nullptr) {
+        result = EvaluateBinary(node.op, x, EvaluateUnfused(*node.rhs, results));
+    } else {
+        result = EvaluateUnary(node.op, x);
+    }
+    results.emplace(&node, result);
+    return result;
+}
+
+}  // namespace
+
+LazyArray::LazyArray(const Array& array) {
+    auto node = std::make_shared<LazyArrayNode>();
+    node->array = array;
+    node_ = std::move(node);
+}
+
+Array LazyArray::Materialize() const {
+    if (node_->array.has_value()) {
+        return *node_->array;
+    }
+    FusedElementwiseProgram program{*node_};
+    if (program.CanFuse()) {
+        return program.Evaluate();
+    }
+    std::unordered_map<const LazyArrayNode*, Array> results;
+    return EvaluateUnfused(*node_, results);
+}
+
+LazyArray operator-(const LazyArray& x) { return MakeUnary(FusedElementwiseOp::kNegative, x); }
+
+LazyArray operator+(const LazyArray& x1, const LazyArray& x2) { return MakeBinary(FusedElementwiseOp::kAdd, x1, x2); }
+LazyArray operator+(const LazyArray& x1, const Array& x2) { return MakeBinary(FusedElementwiseOp::kAdd, x1, Lazy(x2)); }
+LazyArray operator+(const Array& x1, const LazyArray& x2) { return MakeBinary(FusedElementwiseOp::kAdd, Lazy(x1), x2); }
+LazyArray operator+(const LazyArray& x1, Scalar x2) { return MakeBinary(FusedElementwiseOp::kAdd, x1, x2, false); }
+LazyArray operator+(Scalar x1, const LazyArray& x2) { return MakeBinary(FusedElementwiseOp::kAdd, x2, x1, true); }
+
+LazyArray operator-(const LazyArray& x1, const LazyArray& x2) { return MakeBinary(FusedElementwiseOp::kSubtract, x1, x2); }
+LazyArray operator-(const LazyArray& x1, const Array& x2) { return MakeBinary(FusedElementwiseOp::kSubtract, x1, Lazy(x2)); }
+LazyArray operator-(const Array& x1, const LazyArray& x2) { return MakeBinary(FusedElementwiseOp::kSubtract, Lazy(x1), x2); }
+LazyArray operator-(const LazyArray& x1, Scalar x2) { return MakeBinary(FusedElementwiseOp::kSubtract, x1, x2, false); }
+LazyArray operator-(Scalar x1, const LazyArray& x2) { return MakeBinary(FusedElementwiseOp::kSubtract, x2, x1, true); }
+
+LazyArray operator*(const LazyArray& x1, const LazyArray& x2) { return MakeBinary(FusedElementwiseOp::kMultiply, x1, x2); }
+LazyArray operator*(const LazyArray& x1, const Array& x2) { return MakeBinary(FusedElementwiseOp::kMultiply, x1, Lazy(x2)); }
+LazyArray operator*(const Array& x1, const LazyArray& x2) { return MakeBinary(FusedElementwiseOp::kMultiply, Lazy(x1), x2); }
+LazyArray operator*(const LazyArray& x1, Scalar x2) { return MakeBinary(FusedElementwiseOp::kMultiply, x1, x2, false); }
+LazyArray operator*(Scalar x1, const LazyArray& x2) { return MakeBinary(FusedElementwiseOp::kMultiply, x2, x1, true); }
+
+LazyArray operator/(const LazyArray& x1, const LazyArray& x2) { return MakeBinary(FusedElementwiseOp::kDivide, x1, x2); }
+LazyArray operator/(const LazyArray& x1, const Array& x2) { return MakeBinary(FusedElementwiseOp::kDivide, x1, Lazy(x2)); }
+LazyArray operator/(const Array& x1, const LazyArray& x2) { return MakeBinary(FusedElementwiseOp::kDivide, Lazy(x1), x2); }
+LazyArray operator/(const LazyArray& x1, Scalar x2) { return MakeBinary(FusedElementwiseOp::kDivide, x1, x2, false); }
+LazyArray operator/(Scalar x1, const LazyArray& x2) { return MakeBinary(FusedElementwiseOp::kDivide, x2, x1, true); }
+
+LazyArray Exp(const LazyArray& x) { return MakeUnary(FusedElementwiseOp::kExp, x); }
+
+LazyArray Log(const LazyArray& x) { return MakeUnary(FusedElementwiseOp::kLog, x); }
+
+LazyArray Sqrt(const LazyArray& x) { return MakeUnary(FusedElementwiseOp::kSqrt, x); }
+
+LazyArray Square(const LazyArray& x) { return MakeUnary(FusedElementwiseOp::kSquare, x); }
+
+LazyArray Reciprocal(const LazyArray& x) { return MakeUnary(FusedElementwiseOp::kReciprocal, x); }
+
+LazyArray Tanh(const LazyArray& x) { return MakeUnary(FusedElementwiseOp::kTanh, x); }
+
+LazyArray Sigmoid(const LazyArray& x) { return MakeUnary(FusedElementwiseOp::kSigmoid, x); }
+
+}  // namespace chainerx
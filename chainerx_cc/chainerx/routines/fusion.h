@@ -0,0 +1,87 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "chainerx/array.h"
+#include "chainerx/scalar.h"
+
+namespace chainerx {
+namespace internal {
+
+struct LazyArrayNode;
+
+}  // namespace internal
+
+// A deferred elementwise expression of arrays.
+//
+// Elementwise operations on lazy arrays build an expression instead of computing it. The expression is evaluated when it is converted to
+// an Array, e.g. when passed to a reduction or any other routine taking arrays, by a single FusedElementwiseKernel loop which does not
+// allocate the intermediate values.
+//
+// The expression is instead evaluated by the ordinary routines, one for each operation, if any of its arrays requires a graph, if the
+// arrays are not of the same floating point dtype and device, or if the backend does not implement the fused kernel. The results are
+// the same in either case, except for rounding of float16 intermediate values, which the fused loop computes in float.
+//
+// Example:
+//     Array y = Reciprocal(1 + Exp(-Lazy(x)));
+class LazyArray {
+public:
+    explicit LazyArray(const Array& array);
+
+    explicit LazyArray(std::shared_ptr<const internal::LazyArrayNode> node) : node_{std::move(node)} {}
+
+    // Evaluates the expression. Each call evaluates it again.
+    Array Materialize() const;
+
+    operator Array() const { return Materialize(); }  // NOLINT(google-explicit-constructor)
+
+    const std::shared_ptr<const internal::LazyArrayNode>& node() const { return node_; }
+
+private:
+    std::shared_ptr<const internal::LazyArrayNode> node_;
+};
+
+inline LazyArray Lazy(const Array& array) { return LazyArray{array}; }
+
+LazyArray operator-(const LazyArray& x);
+
+LazyArray operator+(const LazyArray& x1, const LazyArray& x2);
+LazyArray operator+(const LazyArray& x1, const Array& x2);
+LazyArray operator+(const Array& x1, const LazyArray& x2);
+LazyArray operator+(const LazyArray& x1, Scalar x2);
+LazyArray operator+(Scalar x1, const LazyArray& x2);
+
+LazyArray operator-(const LazyArray& x1, const LazyArray& x2);
+LazyArray operator-(const LazyArray& x1, const Array& x2);
+LazyArray operator-(const Array& x1, const LazyArray& x2);
+LazyArray operator-(const LazyArray& x1, Scalar x2);
+LazyArray operator-(Scalar x1, const LazyArray& x2);
+
+LazyArray operator*(const LazyArray& x1, const LazyArray& x2);
+LazyArray operator*(const LazyArray& x1, const Array& x2);
+LazyArray operator*(const Array& x1, const LazyArray& x2);
+LazyArray operator*(const LazyArray& x1, Scalar x2);
+LazyArray operator*(Scalar x1, const LazyArray& x2);
+
+LazyArray operator/(const LazyArray& x1, const LazyArray& x2);
+LazyArray operator/(const LazyArray& x1, const Array& x2);
+LazyArray operator/(const Array& x1, const LazyArray& x2);
+LazyArray operator/(const LazyArray& x1, Scalar x2);
+LazyArray operator/(Scalar x1, const LazyArray& x2);
+
+LazyArray Exp(const LazyArray& x);
+
+LazyArray Log(const LazyArray& x);
+
+LazyArray Sqrt(const LazyArray& x);
+
+LazyArray Square(const LazyArray& x);
+
+LazyArray Reciprocal(const LazyArray& x);
+
+LazyArray Tanh(const LazyArray& x);
+
+LazyArray Sigmoid(const LazyArray& x);
+
+}  // namespace chainerx
@@ -0,0 +1,91 @@
+#include "chainerx/routines/fusion.h"
+
+#include <vector>
+
+#include <absl/types/optional.h>
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/backward.h"
+#include "chainerx/device_id.h"
+#include "chainerx/native/native_backend.h"
+#include "chainerx/routines/activation.h"
+#include "chainerx/routines/arithmetic.h"
+#include "chainerx/routines/explog.h"
+#include "chainerx/routines/misc.h"
+#include "chainerx/routines/reduction.h"
+#include "chainerx/static_graph.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace {
+
+class FusionTest : public ::testing::Test {
+protected:
+    void SetUp() override { device_session_.emplace(DeviceId{native::NativeBackend::kDefaultName, 0}); }
+
+    void TearDown() override { device_session_.reset(); }
+
+private:
+    absl::optional<testing::DeviceSession> device_session_;
+};
+
+TEST_F(FusionTest, Materialize) {
+    Array x = testing::BuildArray({2, 3}).WithLinearData<float>(-2.0f, 0.75f);
+    Array y = Reciprocal(1 + Exp(-Lazy(x)));
+    EXPECT_ARRAY_ALL_CLOSE(Reciprocal(1 + Exp(-x)), y);
+    EXPECT_ARRAY_ALL_CLOSE(Sigmoid(x), y);
+}
+
+TEST_F(FusionTest, MaterializeSingleKernelCall) {
+    auto step = [](const std::vector<Array>& xs) -> std::vector<Array> { return {Sigmoid(Lazy(xs[0]) * xs[1] + 1) - Lazy(xs[0]) / 2}; };
+    Array x0 = testing::BuildArray({2, 3}).WithLinearData<float>(-1.0f, 0.5f);
+    Array x1 = testing::BuildArray({2, 3}).WithLinearData<float>(0.5f, 0.25f);
+    StaticGraph graph = StaticGraph::Capture(step, {x0, x1});
+    EXPECT_EQ(1U, graph.kernel_call_count());
+    EXPECT_ARRAY_ALL_CLOSE(Sigmoid(x0 * x1 + 1) - x0 / 2, graph.Replay({x0, x1})[0]);
+}
+
+TEST_F(FusionTest, MaterializeBroadcastNonContiguous) {
+    Array mean = testing::BuildArray({2, 3}).WithLinearData<double>(-1.0, 0.5).WithPadding(1);
+    Array ln_var = testing::BuildArray({3}).WithData<double>({-0.5, 0.0, 1.0});
+    Array y = (Square(Lazy(mean)) + Exp(ln_var) - ln_var - 1) * 0.5;
+    EXPECT_EQ(mean.shape(), y.shape());
+    EXPECT_ARRAY_ALL_CLOSE((Square(mean) + Exp(ln_var) - ln_var - 1) * 0.5, y);
+
+    // Large enough to be split into chunks.
+    Array x = testing::BuildArray({3, 1000}).WithLinearData<float>(-1.0f, 0.001f);
+    Array x_t = x.Transpose();
+    EXPECT_ARRAY_ALL_CLOSE(Sqrt(Square(x_t) + 1) / 3, Array{Sqrt(Square(Lazy(x_t)) + 1) / 3});
+}
+
+TEST_F(FusionTest, MaterializeSharedExpression) {
+    Array x = testing::BuildArray({4}).WithData<float>({1.0f, 2.0f, 3.0f, 4.0f});
+    LazyArray t = Log(Lazy(x)) * 2;
+    Array y = t * t + Lazy(x) - x;
+    EXPECT_ARRAY_ALL_CLOSE(Log(x) * 2 * (Log(x) * 2), y);
+}
+
+TEST_F(FusionTest, MaterializeUnfused) {
+    // Integral dtypes are evaluated by the routines.
+    Array a = testing::BuildArray({3}).WithData<int32_t>({1, 2, 3});
+    Array b = testing::BuildArray({3}).WithData<int32_t>({4, 5, 6});
+    Array c = Lazy(a) * 2 + b;
+    EXPECT_ARRAY_EQ(a * 2 + b, c);
+
+    // Mixed dtypes are promoted as by the routines.
+    Array d = testing::BuildArray({3}).WithData<float>({0.5f, 1.5f, 2.5f});
+    EXPECT_ARRAY_EQ(a * d + 1, Array{Lazy(a) * d + 1});
+}
+
+TEST_F(FusionTest, MaterializeBackward) {
+    Array x = (*testing::BuildArray({3}).WithData<float>({1.0f, 2.0f, 3.0f})).RequireGrad();
+    Array y = Square(Lazy(x)) * 3 - x;
+    Backward(Sum(y));
+    EXPECT_ARRAY_ALL_CLOSE(testing::BuildArray({3}).WithData<float>({5.0f, 11.0f, 17.0f}), *x.GetGrad());
+}
+
+}  // namespace
+}  // namespace chainerx
@@ -1,6 +1,18 @@
 #include "chainerx/routines/loss.h"
 
+#include <cstdint>
+#include <utility>
+
 #include "chainerx/array.h"
+#include "chainerx/backprop_mode.h"
+#include "chainerx/backward_builder.h"
+#include "chainerx/backward_context.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/graph.h"
+#include "chainerx/kernels/loss.h"
+#include "chainerx/routines/activation.h"
 #include "chainerx/routines/arithmetic.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/explog.h"
@@ -9,29 +21,149 @@
 #include "chainerx/routines/manipulation.h"
 #include "chainerx/routines/misc.h"
 #include "chainerx/routines/reduction.h"
+#include "chainerx/routines/type_util.h"
 #include "chainerx/scalar.h"
+#include "chainerx/shape.h"
 
 namespace chainerx {
+namespace {
+
+Shape GetLossOutputShape(const Shape& shape, LossReduction reduction) { return reduction == LossReduction::kNone ? shape : Shape{}; }
+
+// Broadcasts the gradient of a possibly reduced loss to the elementwise shape.
+Array BroadcastLossGrad(const Array& gout, const Shape& shape, LossReduction reduction) {
+    if (reduction == LossReduction::kMean && shape.GetTotalSize() > 0) {
+        return (gout * (1.0 / shape.GetTotalSize())).BroadcastTo(shape);
+    }
+    return gout.BroadcastTo(shape);
+}
+
+}  // namespace
 
 Array AbsoluteError(const Array& x1, const Array& x2) { return Absolute(x1 - x2); }
 
 Array SquaredError(const Array& x1, const Array& x2) { return Square(x1 - x2); }
 
-Array GaussianKLDivergence(const Array& mean, const Array& ln_var) { return (Square(mean) + Exp(ln_var) - ln_var - 1) * 0.5; }
+Array GaussianKLDivergence(const Array& mean, const Array& ln_var, LossReduction reduction) {
+    Dtype dtype = internal::GetMathResultDtype(ResultType(mean, ln_var));
+    Shape shape = internal::BroadcastShapes(mean.shape(), ln_var.shape());
+    Array mean_b = mean.BroadcastTo(shape);
+    Array ln_var_b = ln_var.BroadcastTo(shape);
+    Array out = Empty(GetLossOutputShape(shape, reduction), dtype, mean.device());
+
+    {
+        NoBackpropModeScope scope{};
+        mean.device().backend().CallKernel<GaussianKLDivergenceKernel>(mean_b, ln_var_b, reduction, out);
+    }
+
+    BackwardBuilder bb{"gaussian_kl_divergence", {mean_b, ln_var_b}, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget({0, 1})) {
+        bt.Define([mean_tok = bb.RetainInput(0), ln_var_tok = bb.RetainInput(1), reduction](BackwardContext& bctx) {
+            const Array& mean = bctx.GetRetainedInput(mean_tok);
+            const Array& ln_var = bctx.GetRetainedInput(ln_var_tok);
+            Array gout = BroadcastLossGrad(*bctx.output_grad(), mean.shape(), reduction);
+
+            Array gmean{};
+            Array gln_var{};
+            if (bctx.next_required()) {
+                gmean = gout * mean;
+                gln_var = gout * Expm1(ln_var) * 0.5;
+            } else {
+                NoBackpropModeScope scope{};
+                gmean = Empty(mean.shape(), gout.dtype(), mean.device());
+                gln_var = Empty(ln_var.shape(), gout.dtype(), ln_var.device());
+                mean.device().backend().CallKernel<GaussianKLDivergenceGradKernel>(mean, ln_var, gout, gmean, gln_var);
+            }
 
-Array HuberLoss(const Array& x1, const Array& x2, Scalar delta) {
-    Array a = x1 - x2;
-    Array abs_a = Absolute(a);
-    Array delta_array = chainerx::FullLike(a, delta, a.device());
+            if (bctx.is_input_grad_required(0)) {
+                bctx.input_grad(0) = gmean.AsType(mean.dtype(), false);
+            }
+            if (bctx.is_input_grad_required(1)) {
+                bctx.input_grad(1) = gln_var.AsType(ln_var.dtype(), false);
+            }
+        });
+    }
+    bb.Finalize();
 
-    // TODO(kshitij12345) : use Array < Scalar when implemented.
-    return Where(abs_a < delta_array, 0.5 * Square(a), delta * (abs_a - Scalar{0.5} * delta));
+    return out;
 }
 
-Array SigmoidCrossEntropy(const Array& x1, const Array& x2) {
-    Array ignore_label = -OnesLike(x2, x2.device());
-    Array ignore_mask = NotEqual(x2, ignore_label);
-    return -(ignore_mask * (x1 * (x2 - (GreaterEqual(x1, ZerosLike(x1, x1.device()))).AsType(x1.dtype())) - Log1p(Exp(-Absolute(x1)))));
+Array HuberLoss(const Array& x1, const Array& x2, Scalar delta, LossReduction reduction) {
+    Dtype dtype = internal::GetMathResultDtype(ResultType(x1, x2));
+    Shape shape = internal::BroadcastShapes(x1.shape(), x2.shape());
+    Array x1_b = x1.BroadcastTo(shape);
+    Array x2_b = x2.BroadcastTo(shape);
+    Array out = Empty(GetLossOutputShape(shape, reduction), dtype, x1.device());
+
+    {
+        NoBackpropModeScope scope{};
+        x1.device().backend().CallKernel<HuberLossKernel>(x1_b, x2_b, delta, reduction, out);
+    }
+
+    BackwardBuilder bb{"huber_loss", {x1_b, x2_b}, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget({0, 1})) {
+        bt.Define([x1_tok = bb.RetainInput(0), x2_tok = bb.RetainInput(1), delta, reduction](BackwardContext& bctx) {
+            const Array& x1 = bctx.GetRetainedInput(x1_tok);
+            const Array& x2 = bctx.GetRetainedInput(x2_tok);
+            Array gout = BroadcastLossGrad(*bctx.output_grad(), x1.shape(), reduction);
+
+            Array gx1{};
+            if (bctx.next_required()) {
+                // The derivative of the Huber loss is the difference clipped to [-delta, delta].
+                gx1 = gout * Minimum(Maximum(x1 - x2, -delta), delta);
+            } else {
+                NoBackpropModeScope scope{};
+                gx1 = Empty(x1.shape(), gout.dtype(), x1.device());
+                x1.device().backend().CallKernel<HuberLossGradKernel>(x1, x2, gout, delta, gx1);
+            }
+
+            if (bctx.is_input_grad_required(0)) {
+                bctx.input_grad(0) = gx1.AsType(x1.dtype(), false);
+            }
+            if (bctx.is_input_grad_required(1)) {
+                bctx.input_grad(1) = (-gx1).AsType(x2.dtype(), false);
+            }
+        });
+    }
+    bb.Finalize();
+
+    return out;
+}
+
+Array SigmoidCrossEntropy(const Array& x1, const Array& x2, LossReduction reduction) {
+    Dtype dtype = internal::GetMathResultDtype(x1.dtype());
+    Shape shape = internal::BroadcastShapes(x1.shape(), x2.shape());
+    Array x_b = x1.BroadcastTo(shape);
+    // The labels are not differentiated.
+    Array t_b = x2.AsGradStopped().BroadcastTo(shape);
+    Array out = Empty(GetLossOutputShape(shape, reduction), dtype, x1.device());
+
+    {
+        NoBackpropModeScope scope{};
+        x1.device().backend().CallKernel<SigmoidCrossEntropyKernel>(x_b, t_b, reduction, out);
+    }
+
+    BackwardBuilder bb{"sigmoid_cross_entropy", x_b, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+        bt.Define([x_tok = bb.RetainInput(0), t = std::move(t_b), reduction](BackwardContext& bctx) {
+            const Array& x = bctx.GetRetainedInput(x_tok);
+            Array gout = BroadcastLossGrad(*bctx.output_grad(), x.shape(), reduction);
+
+            Array gx{};
+            if (bctx.next_required()) {
+                Array ignore_mask = NotEqual(t, -OnesLike(t, t.device()));
+                gx = gout * ignore_mask * (Sigmoid(x) - t);
+            } else {
+                NoBackpropModeScope scope{};
+                gx = Empty(x.shape(), gout.dtype(), x.device());
+                x.device().backend().CallKernel<SigmoidCrossEntropyGradKernel>(x, t, gout, gx);
+            }
+            bctx.input_grad() = gx.AsType(x.dtype(), false);
+        });
+    }
+    bb.Finalize();
+
+    return out;
 }
 
 Array SoftmaxCrossEntropy(const Array& x1, const Array& x2) {
@@ -49,7 +181,7 @@ Array SoftmaxCrossEntropy(const Array& x1, const Array& x2) {
     return -(score * mask).Sum({1});
 }
 
-Array Hinge(const Array& x, const Array& t, double norm) {
+Array Hinge(const Array& x, const Array& t, double norm, LossReduction reduction) {
     if (x.ndim() != 2) {
         throw DimensionError{"Input array must be 2 dimensional."};
     }
@@ -60,11 +192,39 @@ Array Hinge(const Array& x, const Array& t, double norm) {
         throw DimensionError{"x.shape[0] must be equal to t.shape[0]"};
     }
 
-    int64_t num = x.shape()[1];
-    Array one_minus_diff = Where(ExpandDims(t, 1) == Arange(num), 1 - x, 1 + x);
-    Array bottom_diff = Maximum(0, one_minus_diff);
+    Dtype dtype = internal::GetMathResultDtype(x.dtype());
+    Array out = Empty(GetLossOutputShape(x.shape(), reduction), dtype, x.device());
+
+    {
+        NoBackpropModeScope scope{};
+        x.device().backend().CallKernel<HingeKernel>(x, t, norm, reduction, out);
+    }
+
+    BackwardBuilder bb{"hinge", x, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
+        bt.Define([x_tok = bb.RetainInput(0), t = t.AsGradStopped(), norm, reduction](BackwardContext& bctx) {
+            const Array& x = bctx.GetRetainedInput(x_tok);
+            Array gout = BroadcastLossGrad(*bctx.output_grad(), x.shape(), reduction);
+
+            Array gx{};
+            if (bctx.next_required()) {
+                int64_t num = x.shape()[1];
+                Array is_label = ExpandDims(t, 1) == Arange(num, x.device());
+                Array bottom_diff = Where(is_label, 1 - x, 1 + x);
+                Array zero = Zeros({}, bottom_diff.dtype(), x.device());
+                Array coeff = norm == 1 ? gout : gout * norm * Power(bottom_diff, Scalar{norm - 1});
+                gx = Where(bottom_diff > zero, Where(is_label, -coeff, coeff), 0);
+            } else {
+                NoBackpropModeScope scope{};
+                gx = Empty(x.shape(), gout.dtype(), x.device());
+                x.device().backend().CallKernel<HingeGradKernel>(x, t, gout, norm, gx);
+            }
+            bctx.input_grad() = gx.AsType(x.dtype(), false);
+        });
+    }
+    bb.Finalize();
 
-    return Power(bottom_diff, Scalar{norm});
+    return out;
 }
 
 }  // namespace chainerx
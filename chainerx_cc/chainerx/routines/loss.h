@@ -5,18 +5,26 @@
 
 namespace chainerx {
 
+// Reduction applied to elementwise losses. kSum and kMean reduce over all the elements and return 0-dimensional arrays.
+enum class LossReduction {
+    kNone = 1,
+    kSum,
+    kMean,
+};
+
 Array AbsoluteError(const Array& x1, const Array& x2);
 
 Array SquaredError(const Array& x1, const Array& x2);
 
-Array GaussianKLDivergence(const Array& mean, const Array& ln_var);
+Array GaussianKLDivergence(const Array& mean, const Array& ln_var, LossReduction reduction = LossReduction::kNone);
 
-Array HuberLoss(const Array& x1, const Array& x2, Scalar delta);
+Array HuberLoss(const Array& x1, const Array& x2, Scalar delta, LossReduction reduction = LossReduction::kNone);
 
-Array SigmoidCrossEntropy(const Array& x1, const Array& x2);
+// Elements whose label x2 is -1 are ignored. They still count towards the denominator of kMean.
+Array SigmoidCrossEntropy(const Array& x1, const Array& x2, LossReduction reduction = LossReduction::kNone);
 
 Array SoftmaxCrossEntropy(const Array& x1, const Array& x2);
 
-Array Hinge(const Array& x, const Array& t, double norm = 1.0);
+Array Hinge(const Array& x, const Array& t, double norm = 1.0, LossReduction reduction = LossReduction::kNone);
 
 }  // namespace chainerx
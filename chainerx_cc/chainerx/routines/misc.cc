@@ -14,6 +14,7 @@
 #include "chainerx/kernels/misc.h"
 #include "chainerx/macro.h"
 #include "chainerx/routines/creation.h"
+#include "chainerx/routines/indexing.h"
 #include "chainerx/routines/logic.h"
 #include "chainerx/routines/routines_util.h"
 #include "chainerx/routines/type_util.h"
@@ -33,12 +34,25 @@ void CheckComparisonDtypes(const Array& x1, const Array& x2) { return CheckCompa
 
 void CheckComparisonDtypes(const Array& x1, Scalar x2) { return CheckComparisonDtypes(GetKind(x1.dtype()), x2.kind()); }
 
+// Returns the mask x1 < x2 of a comparison with a scalar.
+Array LessScalarMask(const Array& x1, Scalar x2) {
+    NoBackpropModeScope scope{};
+    Dtype dtype = ResultType(x1, x2);
+    return Less(x1.AsType(dtype, false), Full({}, x2, dtype, x1.device()));
+}
+
+// Returns the mask x1 > x2 of a comparison with a scalar.
+Array GreaterScalarMask(const Array& x1, Scalar x2) {
+    NoBackpropModeScope scope{};
+    Dtype dtype = ResultType(x1, x2);
+    return Greater(x1.AsType(dtype, false), Full({}, x2, dtype, x1.device()));
+}
+
 // Calculates: x1 < x2 ? pos : neg
 // Can only differentiate with respect to neg.
 Array IfLessElse(const Array& x1, Scalar x2, Scalar pos, const Array& neg) {
     CheckComparisonDtypes(x1, x2);
     Array out = Empty(x1.shape(), ResultType(pos, neg), x1.device());
-    // TODO(niboshi): Create mask array and reuse in backprop.
 
     {
         NoBackpropModeScope scope{};
@@ -47,9 +61,12 @@ Array IfLessElse(const Array& x1, Scalar x2, Scalar pos, const Array& neg) {
 
     BackwardBuilder bb{"if_less_else", neg, out};
     if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
-        bt.Define([x1 = x1.AsGradStopped(), x2](BackwardContext& bctx) {
+        // Only the mask of the elements taken from pos is needed for the backward, so x1 itself is not retained.
+        RetainedCompactArrayToken mask_tok = bb.RetainMask(LessScalarMask(x1, x2));
+        bt.Define([mask_tok = std::move(mask_tok), neg_dtype = neg.dtype()](BackwardContext& bctx) {
             const Array& gout = *bctx.output_grad();
-            bctx.input_grad() = IfLessElse(x1, x2, Scalar{0, GetKind(gout.dtype())}, gout).AsType(x1.dtype(), false);
+            const Array& mask = bctx.GetRetainedCompactArray(mask_tok);
+            bctx.input_grad() = Where(mask, Scalar{0, GetKind(gout.dtype())}, gout).AsType(neg_dtype, false);
         });
     }
     bb.Finalize();
@@ -62,7 +79,6 @@ Array IfLessElse(const Array& x1, Scalar x2, Scalar pos, const Array& neg) {
 Array IfGreaterElse(const Array& x1, Scalar x2, Scalar pos, const Array& neg) {
     CheckComparisonDtypes(x1, x2);
     Array out = Empty(x1.shape(), ResultType(pos, neg), x1.device());
-    // TODO(niboshi): Create mask array and reuse in backprop.
 
     {
         NoBackpropModeScope scope{};
@@ -71,9 +87,12 @@ Array IfGreaterElse(const Array& x1, Scalar x2, Scalar pos, const Array& neg) {
 
     BackwardBuilder bb{"if_greater_else", neg, out};
     if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
-        bt.Define([x1 = x1.AsGradStopped(), x2](BackwardContext& bctx) {
+        // Only the mask of the elements taken from pos is needed for the backward, so x1 itself is not retained.
+        RetainedCompactArrayToken mask_tok = bb.RetainMask(GreaterScalarMask(x1, x2));
+        bt.Define([mask_tok = std::move(mask_tok), neg_dtype = neg.dtype()](BackwardContext& bctx) {
             const Array& gout = *bctx.output_grad();
-            bctx.input_grad() = IfGreaterElse(x1, x2, Scalar{0, GetKind(gout.dtype())}, gout).AsType(x1.dtype(), false);
+            const Array& mask = bctx.GetRetainedCompactArray(mask_tok);
+            bctx.input_grad() = Where(mask, Scalar{0, GetKind(gout.dtype())}, gout).AsType(neg_dtype, false);
         });
     }
     bb.Finalize();
@@ -92,18 +111,18 @@ void IfGreaterElseImpl(const Array& x1, const Array& x2, const Array& pos, const
         BackwardBuilder bb{"if_greater_else", {pos, neg}, out};
         if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
             // TODO(imanishi): Remove redundantly comparison x1 > x2 twice.
-            Array mask = Greater(x1, x2);
-            bt.Define([mask = std::move(mask), pos_dtype = pos.dtype()](BackwardContext& bctx) {
+            RetainedCompactArrayToken mask_tok = bb.RetainMask(Greater(x1, x2));
+            bt.Define([mask_tok = std::move(mask_tok), pos_dtype = pos.dtype()](BackwardContext& bctx) {
                 const Array& gout = *bctx.output_grad();
-                bctx.input_grad() = gout.AsType(pos_dtype, false) * mask;
+                bctx.input_grad() = gout.AsType(pos_dtype, false) * bctx.GetRetainedCompactArray(mask_tok);
             });
         }
         if (BackwardBuilder::Target bt = bb.CreateTarget(1)) {
             // TODO(imanishi): Remove redundantly comparison x1 > x2 twice.
-            Array not_mask = Less(x1, x2);
-            bt.Define([not_mask = std::move(not_mask), neg_dtype = neg.dtype()](BackwardContext& bctx) {
+            RetainedCompactArrayToken not_mask_tok = bb.RetainMask(Less(x1, x2));
+            bt.Define([not_mask_tok = std::move(not_mask_tok), neg_dtype = neg.dtype()](BackwardContext& bctx) {
                 const Array& gout = *bctx.output_grad();
-                bctx.input_grad() = gout.AsType(neg_dtype, false) * not_mask;
+                bctx.input_grad() = gout.AsType(neg_dtype, false) * bctx.GetRetainedCompactArray(not_mask_tok);
             });
         }
         bb.Finalize();
@@ -28,6 +28,7 @@
 #include "chainerx/routines/activation.h"
 #include "chainerx/routines/connection.h"
 #include "chainerx/routines/creation.h"
+#include "chainerx/routines/fusion.h"
 #include "chainerx/routines/hyperbolic.h"
 #include "chainerx/routines/linalg.h"
 #include "chainerx/routines/manipulation.h"
@@ -72,15 +73,13 @@ std::vector<Array> GruImpl(
 
     std::vector<Array> split_w = Split(gru_x, 3, 1);
     std::vector<Array> split_h = Split(gru_h, 3, 1);
-    Array r_prev = split_w[0] + split_h[0];
-    Array r = Sigmoid(r_prev);
-    Array z_prev = split_w[1] + split_h[1];
-    Array z = Sigmoid(z_prev);
-    Array h_bar_prev = split_w[2] + r * split_h[2];
-    Array h_bar = Tanh(h_bar_prev);
+    // The gates are evaluated by fused loops if no graph is required.
+    Array r = Sigmoid(Lazy(split_w[0]) + split_h[0]);
+    Array z = Sigmoid(Lazy(split_w[1]) + split_h[1]);
+    Array h_bar = Tanh(Lazy(split_w[2]) + Lazy(r) * split_h[2]);
     std::vector<Array> out{};
     out.reserve(1);
-    Array f = (1 - z) * h_bar + z * h;
+    Array f = (1 - Lazy(z)) * h_bar + Lazy(z) * h;
     out.emplace_back(f);
     return out;
 }
@@ -2,7 +2,9 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <iterator>
 #include <memory>
+#include <numeric>
 #include <tuple>
 #include <utility>
 
@@ -110,6 +112,83 @@ Array ArrayOrZeros(const absl::optional<Array>& array, const Array& zeros_templa
     return Zeros(zeros_template.shape(), dtype, zeros_template.device());
 }
 
+void CheckNormalizationSupportedKind(const Array& array, const char* op_name) {
+    if (GetKind(array.dtype()) != DtypeKind::kFloat) {
+        throw DtypeError{op_name, " only supports floating kind inputs."};
+    }
+}
+
+// Returns the dtype in which LayerNorm and GroupNorm compute and retain their statistics.
+Dtype GetNormalizationStatsDtype(Dtype dtype) { return dtype == Dtype::kFloat16 ? Dtype::kFloat32 : dtype; }
+
+// Returns the axes in the half-open range [begin, end).
+Axes GetAxesInRange(int8_t begin, int8_t end) {
+    Axes axes{};
+    axes.resize(end - begin);
+    std::iota(axes.begin(), axes.end(), begin);
+    return axes;
+}
+
+// Returns the shape of (channels,)-shaped group normalization parameters broadcastable to x, i.e. (1, channels, 1, ..., 1).
+Shape GetGroupNormParamShape(const Shape& x_shape) {
+    Shape param_shape{};
+    for (int8_t i = 0; i < x_shape.ndim(); ++i) {
+        param_shape.emplace_back(i == 1 ? x_shape[1] : 1);
+    }
+    return param_shape;
+}
+
+// Returns the shape (batch_size, groups, elements per group) in which group normalization computes its statistics.
+Shape GetGroupNormGroupedShape(const Shape& x_shape, int64_t groups) {
+    int64_t group_size = x_shape[1] / groups;
+    for (int8_t i = 2; i < x_shape.ndim(); ++i) {
+        group_size *= x_shape[i];
+    }
+    return Shape{x_shape[0], groups, group_size};
+}
+
+// Computes gx, ggamma and gbeta of layer normalization.
+// The statistics must be given with the normalized axes kept, so that they broadcast to x. They determine the intermediate dtype.
+// This function is composed of differentiable routines so that it can also be used to define double backpropagation.
+std::tuple<Array, Array, Array> ComputeLayerNormGrad(
+        const Array& x, const Array& gamma, const Array& gout, const Array& x_mean, const Array& x_inv_std, int8_t axis) {
+    Axes norm_axes = GetAxesInRange(axis, x.ndim());
+    Axes batch_axes = GetAxesInRange(0, axis);
+    Dtype interm_dtype = x_mean.dtype();
+
+    const Array& gout_cast = gout.AsType(interm_dtype, false);
+    Array x_hat = (x.AsType(interm_dtype, false) - x_mean) * x_inv_std;
+    Array gx_hat = gout_cast * gamma.AsType(interm_dtype, false);
+
+    Array gx = x_inv_std * (gx_hat - Mean(gx_hat, norm_axes, true) - x_hat * Mean(gx_hat * x_hat, norm_axes, true));
+    Array ggamma = (gout_cast * x_hat).Sum(batch_axes);
+    Array gbeta = gout_cast.Sum(batch_axes);
+
+    return std::make_tuple(gx.AsType(x.dtype(), false), ggamma.AsType(gamma.dtype(), false), gbeta.AsType(gamma.dtype(), false));
+}
+
+// Computes gx, ggamma and gbeta of group normalization.
+// The statistics must be given in the shape (batch_size, groups, 1). They determine the intermediate dtype.
+// This function is composed of differentiable routines so that it can also be used to define double backpropagation.
+std::tuple<Array, Array, Array> ComputeGroupNormGrad(
+        const Array& x, int64_t groups, const Array& gamma, const Array& gout, const Array& x_mean, const Array& x_inv_std) {
+    Shape grouped_shape = GetGroupNormGroupedShape(x.shape(), groups);
+    Axes param_axes = GetAxesInRange(0, x.ndim());
+    param_axes.erase(param_axes.begin() + 1);
+    Dtype interm_dtype = x_mean.dtype();
+
+    const Array& gout_cast = gout.AsType(interm_dtype, false);
+    Array x_hat = (x.AsType(interm_dtype, false).Reshape(grouped_shape) - x_mean) * x_inv_std;
+    Array gx_hat = (gout_cast * gamma.AsType(interm_dtype, false).Reshape(GetGroupNormParamShape(x.shape()))).Reshape(grouped_shape);
+
+    Array gx = x_inv_std * (gx_hat - Mean(gx_hat, Axes{2}, true) - x_hat * Mean(gx_hat * x_hat, Axes{2}, true));
+    Array ggamma = (gout_cast * x_hat.Reshape(x.shape())).Sum(param_axes);
+    Array gbeta = gout_cast.Sum(param_axes);
+
+    return std::make_tuple(
+            gx.Reshape(x.shape()).AsType(x.dtype(), false), ggamma.AsType(gamma.dtype(), false), gbeta.AsType(gamma.dtype(), false));
+}
+
 std::tuple<Array, std::unique_ptr<BatchNormGradState>> ApplyGenericBatchNorm(
         const Array& x,
         const Array& gamma,
@@ -263,6 +342,50 @@ Array GenericFixedBatchNormKernel::Call(
     return out.has_value() ? *out : std::get<0>(result);
 }
 
+std::tuple<Array, Array, Array> GenericLayerNormKernel::Call(
+        const Array& x, const Array& gamma, const Array& beta, Scalar eps, int8_t axis) {
+    CHAINERX_ASSERT(0 <= axis && axis < x.ndim());
+    Axes norm_axes = GetAxesInRange(axis, x.ndim());
+    Shape stats_shape{x.shape().begin(), x.shape().begin() + axis};
+    Dtype interm_dtype = GetNormalizationStatsDtype(x.dtype());
+
+    const Array& x_cast = x.AsType(interm_dtype, false);
+    Array x_mean = Mean(x_cast, norm_axes, true);
+    Array x_inv_std = Reciprocal(Sqrt(Var(x_cast, norm_axes, true) + eps));
+    Array out = (x_cast - x_mean) * x_inv_std * gamma.AsType(interm_dtype, false) + beta.AsType(interm_dtype, false);
+
+    return std::make_tuple(out.AsType(x.dtype(), false), x_mean.Reshape(stats_shape), x_inv_std.Reshape(stats_shape));
+}
+
+std::tuple<Array, Array, Array> GenericLayerNormGradKernel::Call(
+        const Array& x, const Array& gamma, const Array& gout, const Array& x_mean, const Array& x_inv_std, int8_t axis) {
+    CHAINERX_ASSERT(0 <= axis && axis < x.ndim());
+    Shape stats_shape = internal::ReduceShape(x.shape(), GetAxesInRange(axis, x.ndim()), true);
+    return ComputeLayerNormGrad(x, gamma, gout, x_mean.Reshape(stats_shape), x_inv_std.Reshape(stats_shape), axis);
+}
+
+std::tuple<Array, Array, Array> GenericGroupNormKernel::Call(
+        const Array& x, int64_t groups, const Array& gamma, const Array& beta, Scalar eps) {
+    Shape grouped_shape = GetGroupNormGroupedShape(x.shape(), groups);
+    Shape param_shape = GetGroupNormParamShape(x.shape());
+    Dtype interm_dtype = GetNormalizationStatsDtype(x.dtype());
+
+    const Array& x_grouped = x.AsType(interm_dtype, false).Reshape(grouped_shape);
+    Array x_mean = Mean(x_grouped, Axes{2}, true);
+    Array x_inv_std = Reciprocal(Sqrt(Var(x_grouped, Axes{2}, true) + eps));
+    Array x_hat = ((x_grouped - x_mean) * x_inv_std).Reshape(x.shape());
+    Array out = x_hat * gamma.AsType(interm_dtype, false).Reshape(param_shape) + beta.AsType(interm_dtype, false).Reshape(param_shape);
+
+    Shape stats_shape{x.shape()[0], groups};
+    return std::make_tuple(out.AsType(x.dtype(), false), x_mean.Reshape(stats_shape), x_inv_std.Reshape(stats_shape));
+}
+
+std::tuple<Array, Array, Array> GenericGroupNormGradKernel::Call(
+        const Array& x, int64_t groups, const Array& gamma, const Array& gout, const Array& x_mean, const Array& x_inv_std) {
+    Shape stats_shape{x.shape()[0], groups, 1};
+    return ComputeGroupNormGrad(x, groups, gamma, gout, x_mean.Reshape(stats_shape), x_inv_std.Reshape(stats_shape));
+}
+
 Array BatchNorm(
         const Array& x,
         const Array& gamma,
@@ -423,4 +546,178 @@ Array FixedBatchNorm(
     }
 }
 
+std::tuple<Array, Array> FoldFixedBatchNorm(
+        const Array& w,
+        const absl::optional<Array>& b,
+        const Array& gamma,
+        const Array& beta,
+        const Array& mean,
+        const Array& var,
+        Scalar eps) {
+    if (w.ndim() < 1) {
+        throw DimensionError{"Weights must have the output channel axis. Actual shape: ", w.shape(), "."};
+    }
+    int64_t out_channels = w.shape()[0];
+    auto check_param = [out_channels](const Array& param, const char* name) {
+        if (param.ndim() != 1 || param.shape()[0] != out_channels) {
+            throw DimensionError{name, " must be of shape (", out_channels, ",). Actual: ", param.shape(), "."};
+        }
+    };
+    check_param(gamma, "Gamma");
+    check_param(beta, "Beta");
+    check_param(mean, "Mean");
+    check_param(var, "Variance");
+    if (b.has_value()) {
+        check_param(*b, "Bias");
+    }
+
+    Array scale = gamma * Reciprocal(Sqrt(var + eps));
+    Shape scale_shape{out_channels};
+    std::fill_n(std::back_inserter(scale_shape), w.ndim() - 1, int64_t{1});
+
+    Array folded_w = w * scale.Reshape(scale_shape);
+    Array folded_b = (b.has_value() ? *b - mean : -mean) * scale + beta;
+    return std::make_tuple(std::move(folded_w), std::move(folded_b));
+}
+
+Array LayerNorm(const Array& x, const Array& gamma, const Array& beta, Scalar eps, int8_t axis) {
+    CheckNormalizationSupportedKind(x, "LayerNorm");
+    CheckNormalizationSupportedKind(gamma, "LayerNorm");
+    CheckNormalizationSupportedKind(beta, "LayerNorm");
+
+    int8_t norm_axis = internal::NormalizeAxis(axis, x.ndim());
+    Shape norm_shape{x.shape().begin() + norm_axis, x.shape().end()};
+    int64_t norm_size = norm_shape.GetTotalSize();
+    if (gamma.GetTotalSize() != norm_size) {
+        throw DimensionError{
+                "Gamma must have the same size as the normalized input. Actual: ", gamma.GetTotalSize(), ". Expected: ", norm_size, "."};
+    }
+    if (beta.GetTotalSize() != norm_size) {
+        throw DimensionError{
+                "Beta must have the same size as the normalized input. Actual: ", beta.GetTotalSize(), ". Expected: ", norm_size, "."};
+    }
+    Array gamma_reshaped = ReshapeOrIdentity(gamma, norm_shape);
+    Array beta_reshaped = ReshapeOrIdentity(beta, norm_shape);
+
+    Array out{};
+    Array x_mean{};
+    Array x_inv_std{};
+    {
+        NoBackpropModeScope scope{};
+        std::tie(out, x_mean, x_inv_std) = x.device().backend().CallKernel<LayerNormKernel>(
+                x.AsGradStopped(), gamma_reshaped.AsGradStopped(), beta_reshaped.AsGradStopped(), eps, norm_axis);
+    }
+
+    BackwardBuilder bb{"layer_norm", {x, gamma_reshaped, beta_reshaped}, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget({0, 1, 2})) {
+        bt.Define([x_tok = bb.RetainInput(0),
+                   gamma_tok = bb.RetainInput(1),
+                   x_mean = std::move(x_mean),
+                   x_inv_std = std::move(x_inv_std),
+                   eps,
+                   norm_axis,
+                   beta_dtype = beta_reshaped.dtype()](BackwardContext& bctx) {
+            const Array& gout = *bctx.output_grad();
+            const Array& x = bctx.GetRetainedInput(x_tok);
+            const Array& gamma = bctx.GetRetainedInput(gamma_tok);
+
+            Array gx{};
+            Array ggamma{};
+            Array gbeta{};
+            if (bctx.next_required()) {
+                // Recompute the statistics with routines so that they are differentiated with respect to x as well.
+                Axes norm_axes = GetAxesInRange(norm_axis, x.ndim());
+                const Array& x_cast = x.AsType(x_mean.dtype(), false);
+                std::tie(gx, ggamma, gbeta) = ComputeLayerNormGrad(
+                        x, gamma, gout, Mean(x_cast, norm_axes, true), Reciprocal(Sqrt(Var(x_cast, norm_axes, true) + eps)), norm_axis);
+            } else {
+                NoBackpropModeScope scope{};
+                std::tie(gx, ggamma, gbeta) =
+                        x.device().backend().CallKernel<LayerNormGradKernel>(x, gamma, gout, x_mean, x_inv_std, norm_axis);
+            }
+
+            bctx.input_grad(0) = std::move(gx);
+            bctx.input_grad(1) = std::move(ggamma);
+            bctx.input_grad(2) = gbeta.dtype() == beta_dtype ? std::move(gbeta) : gbeta.AsType(beta_dtype);
+        });
+    }
+    bb.Finalize();
+
+    return out;
+}
+
+Array GroupNorm(const Array& x, int64_t groups, const Array& gamma, const Array& beta, Scalar eps) {
+    CheckNormalizationSupportedKind(x, "GroupNorm");
+    CheckNormalizationSupportedKind(gamma, "GroupNorm");
+    CheckNormalizationSupportedKind(beta, "GroupNorm");
+
+    if (x.ndim() < 2) {
+        throw DimensionError{"GroupNorm requires an input with at least 2 dimensions. Actual: ", x.ndim(), "."};
+    }
+    int64_t channels = x.shape()[1];
+    if (groups <= 0 || channels % groups != 0) {
+        throw DimensionError{
+                "The number of channels must be a multiple of the number of groups. Channels: ", channels, ". Groups: ", groups, "."};
+    }
+    if (gamma.GetTotalSize() != channels) {
+        throw DimensionError{
+                "Gamma must have the same size as the channels. Actual: ", gamma.GetTotalSize(), ". Expected: ", channels, "."};
+    }
+    if (beta.GetTotalSize() != channels) {
+        throw DimensionError{"Beta must have the same size as the channels. Actual: ", beta.GetTotalSize(), ". Expected: ", channels, "."};
+    }
+    Array gamma_reshaped = ReshapeOrIdentity(gamma, Shape{channels});
+    Array beta_reshaped = ReshapeOrIdentity(beta, Shape{channels});
+
+    Array out{};
+    Array x_mean{};
+    Array x_inv_std{};
+    {
+        NoBackpropModeScope scope{};
+        std::tie(out, x_mean, x_inv_std) = x.device().backend().CallKernel<GroupNormKernel>(
+                x.AsGradStopped(), groups, gamma_reshaped.AsGradStopped(), beta_reshaped.AsGradStopped(), eps);
+    }
+
+    BackwardBuilder bb{"group_norm", {x, gamma_reshaped, beta_reshaped}, out};
+    if (BackwardBuilder::Target bt = bb.CreateTarget({0, 1, 2})) {
+        bt.Define([x_tok = bb.RetainInput(0),
+                   gamma_tok = bb.RetainInput(1),
+                   x_mean = std::move(x_mean),
+                   x_inv_std = std::move(x_inv_std),
+                   groups,
+                   eps,
+                   beta_dtype = beta_reshaped.dtype()](BackwardContext& bctx) {
+            const Array& gout = *bctx.output_grad();
+            const Array& x = bctx.GetRetainedInput(x_tok);
+            const Array& gamma = bctx.GetRetainedInput(gamma_tok);
+
+            Array gx{};
+            Array ggamma{};
+            Array gbeta{};
+            if (bctx.next_required()) {
+                // Recompute the statistics with routines so that they are differentiated with respect to x as well.
+                const Array& x_grouped = x.AsType(x_mean.dtype(), false).Reshape(GetGroupNormGroupedShape(x.shape(), groups));
+                std::tie(gx, ggamma, gbeta) = ComputeGroupNormGrad(
+                        x,
+                        groups,
+                        gamma,
+                        gout,
+                        Mean(x_grouped, Axes{2}, true),
+                        Reciprocal(Sqrt(Var(x_grouped, Axes{2}, true) + eps)));
+            } else {
+                NoBackpropModeScope scope{};
+                std::tie(gx, ggamma, gbeta) =
+                        x.device().backend().CallKernel<GroupNormGradKernel>(x, groups, gamma, gout, x_mean, x_inv_std);
+            }
+
+            bctx.input_grad(0) = std::move(gx);
+            bctx.input_grad(1) = std::move(ggamma);
+            bctx.input_grad(2) = gbeta.dtype() == beta_dtype ? std::move(gbeta) : gbeta.AsType(beta_dtype);
+        });
+    }
+    bb.Finalize();
+
+    return out;
+}
+
 }  // namespace chainerx
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstdint>
+#include <tuple>
+
 #include <absl/types/optional.h>
 
 #include "chainerx/array.h"
@@ -33,4 +36,30 @@ Array FixedBatchNorm(
         Scalar eps,
         const OptionalAxes& axis = absl::nullopt);
 
+// Folds FixedBatchNorm applied to the output channels of a convolution or a linear layer into its weights and bias.
+//
+// w: (out_channels, ...), e.g. convolution weights of shape (out_channels, in_channels, k_1, ..., k_n) or linear weights.
+// b: (out_channels), or absl::nullopt if the layer has no bias.
+// gamma, beta, mean, var: (out_channels)
+//
+// Returns the folded weights and bias (w', b') with which the layer computes
+// FixedBatchNorm(layer(x, w, b), gamma, beta, mean, var, eps) without the normalization pass.
+std::tuple<Array, Array> FoldFixedBatchNorm(
+        const Array& w,
+        const absl::optional<Array>& b,
+        const Array& gamma,
+        const Array& beta,
+        const Array& mean,
+        const Array& var,
+        Scalar eps = 2e-5);
+
+// Computes the layer normalization.
+// The input is normalized over the axes from `axis` to the last one. gamma and beta must have the same size as these axes.
+Array LayerNorm(const Array& x, const Array& gamma, const Array& beta, Scalar eps = 1e-5, int8_t axis = -1);
+
+// Computes the group normalization.
+// The input of shape (batch_size, channels, ...) is normalized over each of the `groups` groups of channels.
+// gamma and beta must have the size of the channels.
+Array GroupNorm(const Array& x, int64_t groups, const Array& gamma, const Array& beta, Scalar eps = 1e-5);
+
 }  // namespace chainerx
@@ -3,10 +3,16 @@
 #include <functional>
 #include <initializer_list>
 #include <memory>
+#include <utility>
 
 #include "chainerx/array.h"
+#include "chainerx/array_body.h"
+#include "chainerx/dtype.h"
 #include "chainerx/error.h"
+#include "chainerx/graph.h"
 #include "chainerx/routines/creation.h"
+#include "chainerx/scalar.h"
+#include "chainerx/shape.h"
 
 namespace chainerx {
 namespace internal {
@@ -71,6 +77,34 @@ Array BroadcastBinary(Impl&& impl, const Array& x1, const Array& x2, Dtype dtype
     return func(x1.BroadcastTo(result_shape), x2.BroadcastTo(result_shape));
 }
 
+// Returns whether the buffer of an input of an elementwise routine can be reused for the output, i.e. the input is a temporary given up by
+// the caller and referenced by nothing else, it is on no graph, and it has the shape and the dtype of the output. Buffers shared with the
+// callers of FromData() or FromHostData() are never reused, since their use counts do not include the references outside ChainerX.
+// The caller must also make sure that no input is retained for backward.
+inline bool IsDonatable(const Array& x, const Shape& shape, Dtype dtype) {
+    const std::shared_ptr<ArrayBody>& body = internal::GetArrayBody(x);
+    return body.use_count() == 1 && body->data().use_count() == 1 && body->nodes().empty() && x.shape() == shape && x.dtype() == dtype &&
+           x.IsContiguous() && !IsForeignData(body->data());
+}
+
+// Same as BroadcastBinary(), but writes the output to the buffer of a donated input if possible. See IsDonatable().
+// Donated inputs must be moved in by the caller so that the returned array is the only reference to the buffer.
+template <typename Impl>
+Array BroadcastBinaryDonated(Impl&& impl, Array x1, Array x2, Dtype dtype, bool x1_donated, bool x2_donated) {
+    if (!x1.IsBackpropRequired(AnyGraph{}) && !x2.IsBackpropRequired(AnyGraph{})) {
+        Shape shape = x1.shape() == x2.shape() ? x1.shape() : internal::BroadcastShapes(x1.shape(), x2.shape());
+        if (x1_donated && IsDonatable(x1, shape, dtype)) {
+            impl(x1, x2.shape() == shape ? x2 : x2.BroadcastTo(shape), x1);
+            return x1;
+        }
+        if (x2_donated && IsDonatable(x2, shape, dtype)) {
+            impl(x1.shape() == shape ? x1 : x1.BroadcastTo(shape), x2, x2);
+            return x2;
+        }
+    }
+    return BroadcastBinary(std::forward<Impl>(impl), x1, x2, dtype);
+}
+
 // Called from IAdd, ISubtract, IMultiply, IDivide, etc. to handle broadcasting.
 template <typename Impl>
 void BroadcastBinaryInplace(Impl&& impl, const Array& x1, const Array& x2) {
@@ -96,6 +130,26 @@ Array Binary(Impl&& impl, Scalar x1, const Array& x2, Dtype dtype) {
     return out;
 }
 
+// Same as Binary(), but writes the output to the buffer of x1, which the caller gives up, if possible. See IsDonatable().
+template <typename Impl>
+Array BinaryDonated(Impl&& impl, Array x1, Scalar x2, Dtype dtype) {
+    if (!x1.IsBackpropRequired(AnyGraph{}) && IsDonatable(x1, x1.shape(), dtype)) {
+        impl(x1, x2, x1);
+        return x1;
+    }
+    return Binary(std::forward<Impl>(impl), x1, x2, dtype);
+}
+
+// Same as Binary(), but writes the output to the buffer of x2, which the caller gives up, if possible. See IsDonatable().
+template <typename Impl>
+Array BinaryDonated(Impl&& impl, Scalar x1, Array x2, Dtype dtype) {
+    if (!x2.IsBackpropRequired(AnyGraph{}) && IsDonatable(x2, x2.shape(), dtype)) {
+        impl(x1, x2, x2);
+        return x2;
+    }
+    return Binary(std::forward<Impl>(impl), x1, x2, dtype);
+}
+
 template <typename Impl>
 void BinaryInplace(Impl&& impl, const Array& x1, Scalar x2) {
     internal::CheckNoUnsafeInplace(x1, {x1});
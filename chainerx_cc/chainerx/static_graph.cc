@@ -0,0 +1,473 @@
+#include "chainerx/static_graph.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <absl/types/optional.h>
+
+#include "chainerx/array.h"
+#include "chainerx/array_body.h"
+#include "chainerx/device.h"
+#include "chainerx/error.h"
+#include "chainerx/kernel_call_recorder.h"
+#include "chainerx/kernel_queue.h"
+#include "chainerx/kernels/creation.h"
+#include "chainerx/macro.h"
+#include "chainerx/strides.h"
+#include "chainerx/thread_local_state.h"
+#include "chainerx/thread_pool.h"
+
+namespace chainerx {
+namespace {
+
+class StaticGraphRecorder : public internal::KernelCallRecorder {
+public:
+    void Record(std::function<void()> replay, internal::RecordedArrayBodies array_bodies) override {
+        std::lock_guard<std::mutex> lock{mutex_};
+        kernel_calls_.emplace_back(std::move(replay));
+        kernel_call_array_bodies_.emplace_back(std::move(array_bodies));
+    }
+
+    void RecordUnsupported(const char* kernel_name) override {
+        std::lock_guard<std::mutex> lock{mutex_};
+        unsupported_kernel_names_.emplace(kernel_name);
+    }
+
+    void RecordAllocation(const std::shared_ptr<void>& data, size_t bytesize) override {
+        if (data == nullptr) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock{mutex_};
+        allocations_.emplace_back(data, bytesize);
+    }
+
+    std::vector<std::function<void()>>& kernel_calls() { return kernel_calls_; }
+
+    std::vector<internal::RecordedArrayBodies>& kernel_call_array_bodies() { return kernel_call_array_bodies_; }
+
+    std::vector<std::pair<std::weak_ptr<void>, size_t>>& allocations() { return allocations_; }
+
+    const std::set<std::string>& unsupported_kernel_names() const { return unsupported_kernel_names_; }
+
+private:
+    std::mutex mutex_;
+    std::vector<std::function<void()>> kernel_calls_;
+    std::vector<internal::RecordedArrayBodies> kernel_call_array_bodies_;
+    std::vector<std::pair<std::weak_ptr<void>, size_t>> allocations_;
+    std::set<std::string> unsupported_kernel_names_;
+};
+
+// Installs a recorder on the current thread during its lifetime.
+class KernelCallRecorderScope {
+public:
+    explicit KernelCallRecorderScope(internal::KernelCallRecorder& recorder) : previous_recorder_{internal::GetKernelCallRecorder()} {
+        internal::SetKernelCallRecorder(&recorder);
+    }
+
+    ~KernelCallRecorderScope() { internal::SetKernelCallRecorder(previous_recorder_); }
+
+    KernelCallRecorderScope(const KernelCallRecorderScope&) = delete;
+    KernelCallRecorderScope(KernelCallRecorderScope&&) = delete;
+    KernelCallRecorderScope& operator=(const KernelCallRecorderScope&) = delete;
+    KernelCallRecorderScope& operator=(KernelCallRecorderScope&&) = delete;
+
+private:
+    internal::KernelCallRecorder* previous_recorder_;
+};
+
+// Alignment of the buffers placed in the workspaces, which suffices for any dtype and for vectorized kernels.
+constexpr size_t kWorkspaceAlignment = 256;
+
+size_t AlignWorkspaceOffset(size_t offset) { return (offset + kWorkspaceAlignment - 1) / kWorkspaceAlignment * kWorkspaceAlignment; }
+
+// An intermediate buffer of a static graph and the range of the kernel calls using it.
+struct PlannedBuffer {
+    std::shared_ptr<void> data;
+    size_t bytesize;
+    size_t first_call;
+    size_t last_call;
+    std::vector<std::shared_ptr<internal::ArrayBody>> array_bodies;
+    size_t offset{0};
+
+    bool IsLiveWith(const PlannedBuffer& other) const { return first_call <= other.last_call && other.first_call <= last_call; }
+};
+
+// Assigns the offsets of buffers on the same device and returns the size of the workspace.
+size_t PlaceBuffers(std::vector<PlannedBuffer*>& buffers) {
+    // Larger buffers first, so that smaller ones fill the gaps between them. Buffers of the same size are placed in the order of their
+    // first uses, which is optimal if all the buffers are of the same size.
+    std::stable_sort(buffers.begin(), buffers.end(), [](const PlannedBuffer* a, const PlannedBuffer* b) {
+        return a->bytesize != b->bytesize ? a->bytesize > b->bytesize : a->first_call < b->first_call;
+    });
+
+    size_t workspace_bytesize{0};
+    std::vector<const PlannedBuffer*> placed;
+    std::vector<const PlannedBuffer*> live;
+    for (PlannedBuffer* buffer : buffers) {
+        live.clear();
+        std::copy_if(placed.begin(), placed.end(), std::back_inserter(live), [buffer](const PlannedBuffer* other) {
+            return buffer->IsLiveWith(*other);
+        });
+        std::sort(live.begin(), live.end(), [](const PlannedBuffer* a, const PlannedBuffer* b) { return a->offset < b->offset; });
+
+        // Best fit among the gaps between the live buffers, or right after the last one.
+        size_t cursor{0};
+        size_t best_offset{0};
+        size_t best_gap{SIZE_MAX};
+        for (const PlannedBuffer* other : live) {
+            if (other->offset >= cursor + buffer->bytesize && other->offset - cursor < best_gap) {
+                best_offset = cursor;
+                best_gap = other->offset - cursor;
+            }
+            cursor = std::max(cursor, AlignWorkspaceOffset(other->offset + other->bytesize));
+        }
+        buffer->offset = best_gap == SIZE_MAX ? cursor : best_offset;
+        workspace_bytesize = std::max(workspace_bytesize, buffer->offset + buffer->bytesize);
+        placed.emplace_back(buffer);
+    }
+    return workspace_bytesize;
+}
+
+// A range of addresses [first, last) accessed by a kernel call.
+struct MemoryRange {
+    uintptr_t first;
+    uintptr_t last;
+
+    bool Overlaps(const MemoryRange& other) const { return first < other.last && other.first < last; }
+
+    bool Covers(const MemoryRange& other) const { return first <= other.first && other.last <= last; }
+};
+
+}  // namespace
+
+StaticGraph StaticGraph::Capture(const StaticGraphFunction& func, const std::vector<Array>& inputs) {
+    std::vector<Array> captured_inputs;
+    captured_inputs.reserve(inputs.size());
+    for (const Array& input : inputs) {
+        captured_inputs.emplace_back(input.AsGradStopped(CopyKind::kCopy));
+    }
+
+    StaticGraphRecorder recorder{};
+    std::vector<Array> outputs{};
+    {
+        KernelCallRecorderScope scope{recorder};
+        outputs = func(captured_inputs);
+    }
+
+    if (!recorder.unsupported_kernel_names().empty()) {
+        std::ostringstream os;
+        for (const std::string& name : recorder.unsupported_kernel_names()) {
+            os << (os.tellp() == 0 ? "" : ", ") << name;
+        }
+        throw ChainerxError{"Cannot capture a static graph including kernels which return objects other than arrays: ", os.str()};
+    }
+
+    // The graphs of the outputs are not replayed; release them.
+    for (Array& output : outputs) {
+        output = output.AsGradStopped();
+    }
+    std::vector<Allocation> allocations;
+    allocations.reserve(recorder.allocations().size());
+    for (auto& allocation : recorder.allocations()) {
+        allocations.emplace_back(Allocation{std::move(allocation.first), allocation.second});
+    }
+    return StaticGraph{std::move(captured_inputs),
+                       std::move(outputs),
+                       std::move(recorder.kernel_calls()),
+                       std::move(recorder.kernel_call_array_bodies()),
+                       std::move(allocations)};
+}
+
+std::vector<Array> StaticGraph::Replay(const std::vector<Array>& inputs, StaticGraphExecutionMode execution_mode) {
+    if (inputs.size() != inputs_.size()) {
+        throw ChainerxError{"Number of inputs to replay a static graph mismatch: expected ", inputs_.size(), ", but got ", inputs.size()};
+    }
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        const Array& input = inputs[i];
+        const Array& captured_input = inputs_[i];
+        if (input.shape() != captured_input.shape()) {
+            throw DimensionError{
+                    "Shape of input ",
+                    i,
+                    " to replay a static graph mismatch: expected ",
+                    captured_input.shape(),
+                    ", but got ",
+                    input.shape()};
+        }
+        if (input.dtype() != captured_input.dtype()) {
+            throw DtypeError{
+                    "Dtype of input ",
+                    i,
+                    " to replay a static graph mismatch: expected ",
+                    captured_input.dtype(),
+                    ", but got ",
+                    input.dtype()};
+        }
+        if (&input.device() != &captured_input.device()) {
+            throw DeviceError{
+                    "Device of input ",
+                    i,
+                    " to replay a static graph mismatch: expected ",
+                    captured_input.device().name(),
+                    ", but got ",
+                    input.device().name()};
+        }
+    }
+
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        inputs_[i].device().backend().CallKernel<CopyKernel>(inputs[i], inputs_[i]);
+    }
+    // The kernels are called directly on this thread, and thus after those queued on the devices executing kernels asynchronously.
+    for (const Array& input : inputs_) {
+        input.device().Synchronize();
+    }
+    internal::SynchronousKernelCallScope scope{};
+    if (execution_mode == StaticGraphExecutionMode::kParallel && !internal::GetSharedThreadPool().IsWorkerThread()) {
+        RunKernelCallsParallel();
+    } else {
+        for (const std::function<void()>& kernel_call : kernel_calls_) {
+            kernel_call();
+        }
+    }
+    return outputs_;
+}
+
+void StaticGraph::BuildKernelCallDependencies() {
+    size_t call_count = kernel_calls_.size();
+    kernel_call_dependents_.assign(call_count, {});
+    kernel_call_dependency_counts_.assign(call_count, 0);
+
+    // The last kernel call accessing each range. A range covered by a range of a later call is dropped, since the calls accessing it
+    // afterwards depend on the later call, which in turn depends on the earlier one.
+    std::vector<std::pair<MemoryRange, size_t>> last_accesses;
+    std::vector<MemoryRange> ranges;
+    std::vector<size_t> dependencies;
+    for (size_t i = 0; i < call_count; ++i) {
+        ranges.clear();
+        for (const std::weak_ptr<internal::ArrayBody>& weak_array_body : kernel_call_array_bodies_[i]) {
+            std::shared_ptr<internal::ArrayBody> array_body = weak_array_body.lock();
+            CHAINERX_ASSERT(array_body != nullptr);
+            if (array_body->GetTotalSize() == 0) {
+                continue;
+            }
+            int64_t lower{};
+            int64_t upper{};
+            std::tie(lower, upper) = GetDataRange(array_body->shape(), array_body->strides(), array_body->GetItemSize());
+            uintptr_t base = reinterpret_cast<uintptr_t>(array_body->data().get()) + array_body->offset();
+            ranges.emplace_back(MemoryRange{base + lower, base + upper});
+        }
+
+        dependencies.clear();
+        for (const MemoryRange& range : ranges) {
+            for (const auto& access : last_accesses) {
+                if (access.second != i && access.first.Overlaps(range)) {
+                    dependencies.emplace_back(access.second);
+                }
+            }
+            last_accesses.erase(
+                    std::remove_if(
+                            last_accesses.begin(),
+                            last_accesses.end(),
+                            [&range](const auto& access) { return range.Covers(access.first); }),
+                    last_accesses.end());
+            last_accesses.emplace_back(range, i);
+        }
+
+        std::sort(dependencies.begin(), dependencies.end());
+        dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+        for (size_t dependency : dependencies) {
+            kernel_call_dependents_[dependency].emplace_back(i);
+        }
+        kernel_call_dependency_counts_[i] = dependencies.size();
+    }
+    kernel_call_dependencies_built_ = true;
+}
+
+void StaticGraph::RunKernelCallsParallel() {
+    if (!kernel_call_dependencies_built_) {
+        BuildKernelCallDependencies();
+    }
+    size_t call_count = kernel_calls_.size();
+    if (call_count == 0) {
+        return;
+    }
+
+    internal::ThreadPool& pool = internal::GetSharedThreadPool();
+    ThreadLocalState thread_local_state = ThreadLocalState::Get();
+
+    std::vector<std::atomic<size_t>> pending_dependency_counts(call_count);
+    for (size_t i = 0; i < call_count; ++i) {
+        pending_dependency_counts[i].store(kernel_call_dependency_counts_[i]);
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t finished_count{0};
+    std::exception_ptr error{};
+    std::atomic<bool> failed{false};
+
+    // Makes a kernel call and then those which become ready by it. The first of them is made on the same worker, which likely has its
+    // inputs in the cache, and the others are submitted to the pool. Skipped calls are also accounted as finished.
+    std::function<void(size_t)> run = [&](size_t index) {
+        ThreadLocalState previous_thread_local_state = ThreadLocalState::Get();
+        ThreadLocalState::Set(thread_local_state);
+        while (true) {
+            if (!failed) {
+                internal::SynchronousKernelCallScope scope{};
+                try {
+                    kernel_calls_[index]();
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock{mutex};
+                    if (error == nullptr) {
+                        error = std::current_exception();
+                    }
+                    failed = true;
+                }
+            }
+
+            absl::optional<size_t> next{};
+            for (size_t dependent : kernel_call_dependents_[index]) {
+                if (pending_dependency_counts[dependent].fetch_sub(1) == 1) {
+                    if (next.has_value()) {
+                        pool.Submit([&run, dependent]() { run(dependent); });
+                    } else {
+                        next = dependent;
+                    }
+                }
+            }
+            if (!next.has_value()) {
+                break;
+            }
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                ++finished_count;
+            }
+            index = *next;
+        }
+        ThreadLocalState::Set(previous_thread_local_state);
+
+        // Notify while holding the lock, since the synchronization objects are gone once the last kernel call finishes.
+        std::lock_guard<std::mutex> lock{mutex};
+        ++finished_count;
+        cv.notify_one();
+    };
+
+    for (size_t i = 0; i < call_count; ++i) {
+        if (kernel_call_dependency_counts_[i] == 0) {
+            pool.Submit([&run, i]() { run(i); });
+        }
+    }
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        cv.wait(lock, [&finished_count, call_count]() { return finished_count == call_count; });
+    }
+    if (error != nullptr) {
+        std::rethrow_exception(error);
+    }
+}
+
+StaticGraphMemoryPlan StaticGraph::PlanMemory() {
+    // Live buffers allocated during the capture, in the order of allocation. Each holds a reference, which is accounted for below.
+    std::vector<PlannedBuffer> buffers;
+    std::unordered_map<void*, size_t> buffer_indices;
+    for (const Allocation& allocation : allocations_) {
+        if (std::shared_ptr<void> data = allocation.data.lock()) {
+            buffer_indices.emplace(data.get(), buffers.size());
+            buffers.emplace_back(PlannedBuffer{std::move(data), allocation.bytesize, SIZE_MAX, 0, {}});
+        }
+    }
+    allocations_.clear();
+    kernel_call_dependencies_built_ = false;
+
+    // Count the references to the array bodies from the kernel calls, and find the range of the kernel calls using each buffer.
+    std::unordered_map<internal::ArrayBody*, std::pair<std::shared_ptr<internal::ArrayBody>, size_t>> array_body_refs;
+    for (size_t i = 0; i < kernel_call_array_bodies_.size(); ++i) {
+        for (const std::weak_ptr<internal::ArrayBody>& weak_array_body : kernel_call_array_bodies_[i]) {
+            std::shared_ptr<internal::ArrayBody> array_body = weak_array_body.lock();
+            CHAINERX_ASSERT(array_body != nullptr);
+            auto it = buffer_indices.find(array_body->data().get());
+            if (it == buffer_indices.end()) {
+                continue;
+            }
+            PlannedBuffer& buffer = buffers[it->second];
+            buffer.first_call = std::min(buffer.first_call, i);
+            buffer.last_call = std::max(buffer.last_call, i);
+            auto& ref = array_body_refs[array_body.get()];
+            if (ref.first == nullptr) {
+                ref.first = array_body;
+                buffer.array_bodies.emplace_back(array_body);
+            }
+            ++ref.second;
+        }
+    }
+
+    // Exclude the buffers referenced from outside of the kernel calls. A buffer is referenced by its array bodies and by `buffers`, and an
+    // array body by the kernel calls, `array_body_refs` and `PlannedBuffer::array_bodies`.
+    std::vector<std::pair<Device*, std::vector<PlannedBuffer*>>> device_buffers;
+    for (PlannedBuffer& buffer : buffers) {
+        if (buffer.array_bodies.empty() || static_cast<size_t>(buffer.data.use_count()) != buffer.array_bodies.size() + 1) {
+            continue;
+        }
+        if (!std::all_of(buffer.array_bodies.begin(), buffer.array_bodies.end(), [&array_body_refs](const auto& array_body) {
+                return static_cast<size_t>(array_body.use_count()) == array_body_refs[array_body.get()].second + 2;
+            })) {
+            continue;
+        }
+        Device* device = &buffer.array_bodies.front()->device();
+        auto it = std::find_if(device_buffers.begin(), device_buffers.end(), [device](const auto& pair) { return pair.first == device; });
+        if (it == device_buffers.end()) {
+            it = device_buffers.emplace(device_buffers.end(), device, std::vector<PlannedBuffer*>{});
+        }
+        it->second.emplace_back(&buffer);
+    }
+    array_body_refs.clear();
+
+    StaticGraphMemoryPlan plan{};
+    for (auto& pair : device_buffers) {
+        Device& device = *pair.first;
+        std::vector<PlannedBuffer*>& planned_buffers = pair.second;
+
+        for (const PlannedBuffer* buffer : planned_buffers) {
+            ++plan.buffer_count;
+            plan.total_bytes += buffer->bytesize;
+        }
+        for (size_t i = 0; i < kernel_calls_.size(); ++i) {
+            size_t live_bytes{0};
+            for (const PlannedBuffer* buffer : planned_buffers) {
+                if (buffer->first_call <= i && i <= buffer->last_call) {
+                    live_bytes += buffer->bytesize;
+                }
+            }
+            plan.peak_live_bytes = std::max(plan.peak_live_bytes, live_bytes);
+        }
+
+        size_t workspace_bytesize = PlaceBuffers(planned_buffers);
+        plan.planned_bytes += workspace_bytesize;
+
+        std::shared_ptr<void> workspace = device.Allocate(workspace_bytesize);
+        for (PlannedBuffer* buffer : planned_buffers) {
+            std::shared_ptr<void> data{workspace, static_cast<uint8_t*>(workspace.get()) + buffer->offset};
+            for (const std::shared_ptr<internal::ArrayBody>& array_body : buffer->array_bodies) {
+                array_body->ReplaceData(data);
+            }
+        }
+    }
+    return plan;
+}
+
+}  // namespace chainerx
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "chainerx/array.h"
+#include "chainerx/kernel_call_recorder.h"
+
+namespace chainerx {
+
+// A step of a computation to be captured, which computes output arrays from input arrays.
+using StaticGraphFunction = std::function<std::vector<Array>(const std::vector<Array>&)>;
+
+// Report of StaticGraph::PlanMemory().
+struct StaticGraphMemoryPlan {
+    // Number of intermediate buffers relocated into the workspaces.
+    size_t buffer_count{0};
+
+    // Total bytes of the buffers, i.e. the memory they occupied before planning.
+    size_t total_bytes{0};
+
+    // Largest total bytes of the buffers used by or live across the same kernel call. This is the peak of a naive allocator which
+    // allocates each buffer right before its first use and frees it right after its last use, without fragmentation.
+    size_t peak_live_bytes{0};
+
+    // Total bytes of the workspaces, one for each device.
+    size_t planned_bytes{0};
+};
+
+enum class StaticGraphExecutionMode {
+    // Kernel calls are made one after another on the calling thread, in the captured order.
+    kSerial,
+    // Independent kernel calls are made concurrently on the shared thread pool.
+    kParallel,
+};
+
+// A sequence of kernel calls captured from a step of a computation, which can be replayed with new input data.
+//
+// This is meant for steps which are run many times with arrays of the same shapes, e.g. the training step of a model including its
+// backward computation. Replaying a captured step only calls the kernels; no array bodies, graph nodes or backward functions are created
+// and no kernels are looked up.
+//
+// A static graph reuses the buffers of the arrays created during the capture. The outputs returned by Replay() are thus overwritten by the
+// next replay, and arrays referenced by the step, e.g. parameters and their gradients, are updated in place as in the captured run.
+// The step must not depend on the values of arrays on the host, e.g. through AsScalar(), or on data transfers which are not kernel calls,
+// since only kernel calls are replayed. Steps calling kernels which return objects other than arrays, e.g. the states of batch
+// normalization or pooling retained for their backward, cannot be captured.
+class StaticGraph {
+public:
+    // Captures a step by running it once with copies of the given input arrays.
+    // The copies are not connected to any graph.
+    //
+    // Throws ChainerxError if the step calls a kernel which cannot be replayed.
+    static StaticGraph Capture(const StaticGraphFunction& func, const std::vector<Array>& inputs);
+
+    ~StaticGraph() = default;
+
+    StaticGraph(const StaticGraph&) = delete;
+    StaticGraph(StaticGraph&&) = default;
+    StaticGraph& operator=(const StaticGraph&) = delete;
+    StaticGraph& operator=(StaticGraph&&) = default;
+
+    // Replays the captured step with new input data, and returns the outputs.
+    //
+    // The inputs must have the same shapes, dtypes and devices as the inputs given on capture. Otherwise DimensionError, DtypeError or
+    // DeviceError is thrown, respectively, before any kernel is called.
+    //
+    // In the parallel mode, a kernel call is dispatched as soon as all the preceding calls touching the same memory have completed, so that
+    // independent branches of the step, e.g. the towers of a model or the gates of a recurrent cell, run concurrently. Since kernels do not
+    // declare which of their arrays they write, every array is regarded as both read and written; calls reading the same array are thus
+    // still ordered. The results are the same as those of the serial mode. If a kernel call throws, the calls which have not started yet
+    // are skipped and the first exception is rethrown. The serial mode is used instead if called from a worker of the shared pool.
+    std::vector<Array> Replay(
+            const std::vector<Array>& inputs, StaticGraphExecutionMode execution_mode = StaticGraphExecutionMode::kSerial);
+
+    // Relocates the intermediate buffers of the captured step into a single preallocated workspace for each device, and returns a report.
+    //
+    // The buffers subject to planning are those allocated by Empty() during the capture and referenced only by the captured kernel
+    // calls, i.e. not by the inputs, the outputs or any array outside of this graph such as gradients of parameters. Their lifetimes are
+    // the ranges of the kernel calls using them, and buffers whose lifetimes do not overlap share memory. Offsets are assigned greedily
+    // in decreasing order of size, each to the smallest gap between the buffers of overlapping lifetimes that fits.
+    //
+    // The buffers are assumed to be written only by kernels, which holds for arrays created by routines. A buffer is never shared by
+    // two arrays used by the same kernel call, since kernels do not declare whether their outputs may alias their inputs.
+    //
+    // Only the first call relocates buffers; subsequent calls return an empty report.
+    StaticGraphMemoryPlan PlanMemory();
+
+    // Returns the number of kernel calls replayed by Replay(), excluding the copies of the inputs.
+    size_t kernel_call_count() const { return kernel_calls_.size(); }
+
+private:
+    // A buffer allocated by Empty() during the capture.
+    struct Allocation {
+        std::weak_ptr<void> data;
+        size_t bytesize;
+    };
+
+    StaticGraph(
+            std::vector<Array> inputs,
+            std::vector<Array> outputs,
+            std::vector<std::function<void()>> kernel_calls,
+            std::vector<internal::RecordedArrayBodies> kernel_call_array_bodies,
+            std::vector<Allocation> allocations)
+        : inputs_{std::move(inputs)},
+          outputs_{std::move(outputs)},
+          kernel_calls_{std::move(kernel_calls)},
+          kernel_call_array_bodies_{std::move(kernel_call_array_bodies)},
+          allocations_{std::move(allocations)} {}
+
+    // Finds the dependencies between the kernel calls from the memory ranges of their arrays.
+    void BuildKernelCallDependencies();
+
+    void RunKernelCallsParallel();
+
+    // Arrays given to the step on capture. Input data are copied to these arrays on replay.
+    std::vector<Array> inputs_;
+
+    std::vector<Array> outputs_;
+
+    std::vector<std::function<void()>> kernel_calls_;
+
+    // Bodies of the arrays held by each of the kernel calls.
+    std::vector<internal::RecordedArrayBodies> kernel_call_array_bodies_;
+
+    // Buffers subject to PlanMemory().
+    std::vector<Allocation> allocations_;
+
+    // Dependencies between the kernel calls for the parallel replay, built on its first use and rebuilt after PlanMemory() relocates the
+    // buffers. A kernel call is dispatched once the calls it depends on have completed, and then dispatches its dependents.
+    bool kernel_call_dependencies_built_{false};
+    std::vector<std::vector<size_t>> kernel_call_dependents_;
+    std::vector<size_t> kernel_call_dependency_counts_;
+};
+
+}  // namespace chainerx
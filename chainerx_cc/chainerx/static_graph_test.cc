@@ -0,0 +1,225 @@
+#include "chainerx/static_graph.h"
+
+#include <vector>
+
+#include <absl/types/optional.h>
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/array_body.h"
+#include "chainerx/backward.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dims.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/native/native_backend.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/explog.h"
+#include "chainerx/routines/normalization.h"
+#include "chainerx/routines/pooling.h"
+#include "chainerx/routines/reduction.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace {
+
+class StaticGraphTest : public ::testing::Test {
+protected:
+    void SetUp() override { device_session_.emplace(DeviceId{native::NativeBackend::kDefaultName, 0}); }
+
+    void TearDown() override { device_session_.reset(); }
+
+private:
+    absl::optional<testing::DeviceSession> device_session_;
+};
+
+std::vector<Array> Step(const std::vector<Array>& xs) { return {Exp(xs[0]) * 2 + xs[1], Sum(xs[0] * xs[1])}; }
+
+TEST_F(StaticGraphTest, Replay) {
+    Array x0 = testing::BuildArray({2, 3}).WithLinearData<float>(-1.0f, 0.25f);
+    Array x1 = testing::BuildArray({2, 3}).WithLinearData<float>(0.5f, 0.5f);
+    StaticGraph graph = StaticGraph::Capture(Step, {x0, x1});
+
+    // Exp, Multiply, Add, Multiply and Sum.
+    EXPECT_EQ(5U, graph.kernel_call_count());
+
+    Array y0 = testing::BuildArray({2, 3}).WithLinearData<float>(1.0f, -0.5f);
+    Array y1 = testing::BuildArray({2, 3}).WithLinearData<float>(2.0f, 0.125f).WithPadding(1);
+    std::vector<Array> expected = Step({y0, y1});
+    std::vector<Array> outputs = graph.Replay({y0, y1});
+    ASSERT_EQ(expected.size(), outputs.size());
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        EXPECT_ARRAY_EQ(expected[i], outputs[i]);
+    }
+
+    // The outputs are overwritten by the next replay.
+    std::vector<Array> outputs2 = graph.Replay({x0, x1});
+    EXPECT_EQ(internal::GetArrayBody(outputs[0])->data(), internal::GetArrayBody(outputs2[0])->data());
+    EXPECT_ARRAY_EQ(Step({x0, x1})[0], outputs[0]);
+}
+
+TEST_F(StaticGraphTest, ReplayBackward) {
+    Array w = (*testing::BuildArray({3}).WithData<float>({1.0f, 2.0f, 3.0f})).RequireGrad();
+    auto step = [&w](const std::vector<Array>& xs) -> std::vector<Array> {
+        Array loss = Sum(xs[0] * w * w);
+        Backward(loss);
+        return {loss};
+    };
+
+    Array x0 = testing::BuildArray({3}).WithData<float>({1.0f, 1.0f, 1.0f});
+    StaticGraph graph = StaticGraph::Capture(step, {x0});
+    EXPECT_ARRAY_EQ(testing::BuildArray({3}).WithData<float>({2.0f, 4.0f, 6.0f}), *w.GetGrad());
+
+    // Parameters updated in place are used by the replay, and their gradients are overwritten.
+    {
+        Array w_data = w.AsGradStopped();
+        w_data *= 2;
+    }
+    Array x1 = testing::BuildArray({3}).WithData<float>({1.0f, -1.0f, 0.5f});
+    std::vector<Array> outputs = graph.Replay({x1});
+    EXPECT_ARRAY_EQ(Full({}, 2.0f * 2.0f - 16.0f + 0.5f * 36.0f), outputs[0]);
+    EXPECT_ARRAY_EQ(testing::BuildArray({3}).WithData<float>({4.0f, -8.0f, 6.0f}), *w.GetGrad());
+}
+
+TEST_F(StaticGraphTest, ReplayNestedKernelCalls) {
+    Array x = testing::BuildArray({2, 3}).WithLinearData<float>(-1.0f, 0.5f);
+    Array gamma = testing::BuildArray({3}).WithData<float>({1.0f, 2.0f, 0.5f});
+    Array beta = testing::BuildArray({3}).WithData<float>({0.0f, 1.0f, -1.0f});
+    auto step = [&gamma, &beta](const std::vector<Array>& xs) -> std::vector<Array> { return {LayerNorm(xs[0], gamma, beta)}; };
+
+    StaticGraph graph = StaticGraph::Capture(step, {x});
+
+    // The kernels called by the layer normalization kernel are not recorded by themselves.
+    EXPECT_EQ(1U, graph.kernel_call_count());
+
+    Array x2 = testing::BuildArray({2, 3}).WithLinearData<float>(3.0f, -0.25f);
+    EXPECT_ARRAY_ALL_CLOSE(step({x2})[0], graph.Replay({x2})[0]);
+}
+
+TEST_F(StaticGraphTest, PlanMemory) {
+    auto step = [](const std::vector<Array>& xs) -> std::vector<Array> { return {Exp(Exp(Exp(Exp(xs[0] * 0.25f))))}; };
+
+    Array x = testing::BuildArray({64}).WithLinearData<float>(-1.0f, 0.03125f);
+    StaticGraph graph = StaticGraph::Capture(step, {x});
+    StaticGraphMemoryPlan plan = graph.PlanMemory();
+
+    // The results of the multiplication and the first three exponentials, of which at most two are live at the same time.
+    EXPECT_EQ(4U, plan.buffer_count);
+    EXPECT_EQ(4U * 64U * sizeof(float), plan.total_bytes);
+    EXPECT_EQ(2U * 64U * sizeof(float), plan.peak_live_bytes);
+    EXPECT_EQ(2U * 64U * sizeof(float), plan.planned_bytes);
+
+    Array x2 = testing::BuildArray({64}).WithLinearData<float>(0.5f, -0.015625f);
+    EXPECT_ARRAY_ALL_CLOSE(step({x2})[0], graph.Replay({x2})[0]);
+    EXPECT_ARRAY_ALL_CLOSE(step({x})[0], graph.Replay({x})[0]);
+
+    // The buffers are relocated only once.
+    EXPECT_EQ(0U, graph.PlanMemory().buffer_count);
+    EXPECT_ARRAY_ALL_CLOSE(step({x2})[0], graph.Replay({x2})[0]);
+}
+
+TEST_F(StaticGraphTest, PlanMemoryBackward) {
+    Array w = (*testing::BuildArray({3}).WithData<float>({1.0f, 2.0f, 3.0f})).RequireGrad();
+    auto step = [&w](const std::vector<Array>& xs) -> std::vector<Array> {
+        Array loss = Sum(Exp(xs[0] * w));
+        Backward(loss);
+        return {loss};
+    };
+
+    Array x0 = testing::BuildArray({3}).WithData<float>({1.0f, 1.0f, 1.0f});
+    StaticGraph graph = StaticGraph::Capture(step, {x0});
+    const void* grad_data = internal::GetArrayBody(*w.GetGrad())->data().get();
+    graph.PlanMemory();
+
+    // The gradient of the parameter is referenced outside of the graph, and thus not relocated.
+    EXPECT_EQ(grad_data, internal::GetArrayBody(*w.GetGrad())->data().get());
+
+    Array x1 = testing::BuildArray({3}).WithData<float>({0.5f, -1.0f, 0.25f});
+    Array expected_loss = Sum(Exp(x1 * w.AsGradStopped()));
+    Array expected_grad = x1 * Exp(x1 * w.AsGradStopped());
+    std::vector<Array> outputs = graph.Replay({x1});
+    EXPECT_ARRAY_ALL_CLOSE(expected_loss, outputs[0]);
+    EXPECT_ARRAY_ALL_CLOSE(expected_grad, *w.GetGrad());
+}
+
+TEST_F(StaticGraphTest, ReplayParallel) {
+    // Independent towers joined at the end.
+    auto step = [](const std::vector<Array>& xs) -> std::vector<Array> {
+        std::vector<Array> towers;
+        for (size_t i = 0; i < xs.size(); ++i) {
+            towers.emplace_back(Exp(Exp(xs[i] * (0.25f * (i + 1))) * 0.5f));
+        }
+        Array y = towers[0];
+        for (size_t i = 1; i < towers.size(); ++i) {
+            y = y + towers[i];
+        }
+        return {y, Sum(towers.back())};
+    };
+
+    std::vector<Array> xs;
+    std::vector<Array> xs2;
+    for (int i = 0; i < 8; ++i) {
+        xs.emplace_back(testing::BuildArray({32}).WithLinearData<float>(-1.0f + i * 0.125f, 0.03125f));
+        xs2.emplace_back(testing::BuildArray({32}).WithLinearData<float>(0.5f, -0.015625f * i));
+    }
+    StaticGraph graph = StaticGraph::Capture(step, xs);
+
+    for (int plan = 0; plan < 2; ++plan) {
+        if (plan == 1) {
+            // Buffers sharing memory after the relocation are ordered.
+            EXPECT_LT(0U, graph.PlanMemory().buffer_count);
+        }
+        for (int trial = 0; trial < 10; ++trial) {
+            const std::vector<Array>& inputs = trial % 2 == 0 ? xs2 : xs;
+            std::vector<Array> expected = step(inputs);
+            std::vector<Array> outputs = graph.Replay(inputs, StaticGraphExecutionMode::kParallel);
+            ASSERT_EQ(expected.size(), outputs.size());
+            for (size_t i = 0; i < outputs.size(); ++i) {
+                EXPECT_ARRAY_ALL_CLOSE(expected[i], outputs[i]);
+            }
+        }
+    }
+}
+
+TEST_F(StaticGraphTest, ReplayParallelBackward) {
+    Array w = (*testing::BuildArray({3}).WithData<float>({1.0f, 2.0f, 3.0f})).RequireGrad();
+    auto step = [&w](const std::vector<Array>& xs) -> std::vector<Array> {
+        Array loss = Sum(Exp(xs[0] * w)) + Sum(xs[1] * w);
+        Backward(loss);
+        return {loss};
+    };
+
+    Array x0 = testing::BuildArray({3}).WithData<float>({1.0f, 1.0f, 1.0f});
+    StaticGraph graph = StaticGraph::Capture(step, {x0, x0});
+
+    Array x1 = testing::BuildArray({3}).WithData<float>({0.5f, -1.0f, 0.25f});
+    Array x2 = testing::BuildArray({3}).WithData<float>({2.0f, 0.0f, -3.0f});
+    Array w_const = w.AsGradStopped();
+    Array expected_loss = Sum(Exp(x1 * w_const)) + Sum(x2 * w_const);
+    Array expected_grad = x1 * Exp(x1 * w_const) + x2;
+    std::vector<Array> outputs = graph.Replay({x1, x2}, StaticGraphExecutionMode::kParallel);
+    EXPECT_ARRAY_ALL_CLOSE(expected_loss, outputs[0]);
+    EXPECT_ARRAY_ALL_CLOSE(expected_grad, *w.GetGrad());
+}
+
+TEST_F(StaticGraphTest, ReplayMismatch) {
+    Array x0 = testing::BuildArray({2, 3}).WithLinearData<float>();
+    Array x1 = testing::BuildArray({2, 3}).WithLinearData<float>();
+    StaticGraph graph = StaticGraph::Capture(Step, {x0, x1});
+
+    EXPECT_THROW(graph.Replay({x0}), ChainerxError);
+    EXPECT_THROW(graph.Replay({x0, testing::BuildArray({3, 2}).WithLinearData<float>()}), DimensionError);
+    EXPECT_THROW(graph.Replay({x0, testing::BuildArray({2, 3}).WithLinearData<double>()}), DtypeError);
+}
+
+TEST_F(StaticGraphTest, CaptureUnsupportedKernel) {
+    Array x = testing::BuildArray({1, 1, 4, 4}).WithLinearData<float>();
+    auto step = [](const std::vector<Array>& xs) -> std::vector<Array> { return {MaxPool(xs[0], Dims{2, 2}, Dims{2, 2}, Dims{0, 0})}; };
+
+    EXPECT_THROW(StaticGraph::Capture(step, {x}), ChainerxError);
+}
+
+}  // namespace
+}  // namespace chainerx
@@ -77,7 +77,7 @@ template <typename ActualContainer, typename T = typename ActualContainer::value
 
 inline ::testing::AssertionResult IsBackpropIdsEqual(const std::vector<BackpropId>& expected, const Array& array) {
     std::vector<BackpropId> actual;
-    std::vector<std::shared_ptr<internal::ArrayNode>>& nodes = internal::GetArrayBody(array)->nodes();
+    const std::vector<std::shared_ptr<internal::ArrayNode>>& nodes = internal::GetArrayBody(array)->nodes();
     actual.reserve(nodes.size());
     std::transform(nodes.begin(), nodes.end(), std::back_inserter(actual), [](const std::shared_ptr<internal::ArrayNode>& node) {
         return node->backprop_id();
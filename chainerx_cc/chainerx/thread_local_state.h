@@ -9,10 +9,14 @@
 namespace chainerx {
 namespace internal {
 
+class KernelCallRecorder;
+
 struct InternalThreadLocalState {
     Context* default_context;
     Device* default_device;
     internal::BackpropModeStack backprop_mode_stack;
+    bool inference_mode;
+    KernelCallRecorder* kernel_call_recorder;
 };
 
 InternalThreadLocalState& GetInternalThreadLocalState();
@@ -0,0 +1,76 @@
+#include "chainerx/thread_pool.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "chainerx/macro.h"
+
+namespace chainerx {
+namespace internal {
+namespace {
+
+// The pool whose worker is the current thread, if any.
+thread_local const ThreadPool* t_current_pool{nullptr};
+
+}  // namespace
+
+ThreadPool::ThreadPool(size_t thread_count) {
+    CHAINERX_ASSERT(thread_count > 0);
+    threads_.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; ++i) {
+        threads_.emplace_back([this]() { WorkerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    for (std::thread& thread : threads_) {
+        thread.join();
+    }
+}
+
+void ThreadPool::Submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        CHAINERX_ASSERT(!stopping_);
+        tasks_.emplace_back(std::move(task));
+    }
+    cv_.notify_one();
+}
+
+bool ThreadPool::IsWorkerThread() const { return t_current_pool == this; }
+
+void ThreadPool::WorkerLoop() {
+    t_current_pool = this;
+    while (true) {
+        std::function<void()> task{};
+        {
+            std::unique_lock<std::mutex> lock{mutex_};
+            cv_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                // Stopping and no more tasks to run.
+                break;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+    t_current_pool = nullptr;
+}
+
+ThreadPool& GetSharedThreadPool() {
+    static ThreadPool pool{std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()))};
+    return pool;
+}
+
+}  // namespace internal
+}  // namespace chainerx
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace chainerx {
+namespace internal {
+
+// A fixed number of worker threads that run submitted tasks in FIFO order.
+//
+// Tasks must not throw. Tasks that are still queued when the pool is destroyed are run before the workers are joined.
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t thread_count);
+
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    size_t thread_count() const { return threads_.size(); }
+
+    void Submit(std::function<void()> task);
+
+    // Returns true if called from one of the worker threads of this pool.
+    bool IsWorkerThread() const;
+
+private:
+    void WorkerLoop();
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    bool stopping_{false};
+    std::vector<std::thread> threads_;
+};
+
+// Returns the pool shared by the parallel backward engine, the parallel replay of static graphs and the parallel native kernels. The pool
+// has a worker per hardware thread and is created on the first call.
+ThreadPool& GetSharedThreadPool();
+
+}  // namespace internal
+}  // namespace chainerx
@@ -0,0 +1,76 @@
+#include "chainerx/thread_pool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace chainerx {
+namespace internal {
+namespace {
+
+TEST(ThreadPoolTest, RunAllTasks) {
+    std::atomic<int> count{0};
+    {
+        ThreadPool pool{4};
+        EXPECT_EQ(size_t{4}, pool.thread_count());
+        for (int i = 0; i < 100; ++i) {
+            pool.Submit([&count]() { ++count; });
+        }
+        // Queued tasks are run before the destructor returns.
+    }
+    EXPECT_EQ(100, count);
+}
+
+TEST(ThreadPoolTest, TasksRunConcurrently) {
+    // Each task waits until all the tasks have started, which only finishes if the tasks run on different threads.
+    constexpr size_t kThreadCount = 3;
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t started = 0;
+    std::set<std::thread::id> thread_ids;
+    // The pool is destroyed first so that the tasks do not outlive the variables above.
+    ThreadPool pool{kThreadCount};
+
+    for (size_t i = 0; i < kThreadCount; ++i) {
+        pool.Submit([&]() {
+            std::unique_lock<std::mutex> lock{mutex};
+            thread_ids.emplace(std::this_thread::get_id());
+            ++started;
+            cv.notify_all();
+            cv.wait(lock, [&]() { return started >= kThreadCount; });
+        });
+    }
+
+    std::unique_lock<std::mutex> lock{mutex};
+    cv.wait(lock, [&]() { return started >= kThreadCount; });
+    EXPECT_EQ(kThreadCount, thread_ids.size());
+}
+
+TEST(ThreadPoolTest, IsWorkerThread) {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done = false;
+    bool is_worker_thread = false;
+    ThreadPool pool{1};
+    EXPECT_FALSE(pool.IsWorkerThread());
+
+    pool.Submit([&]() {
+        std::lock_guard<std::mutex> lock{mutex};
+        is_worker_thread = pool.IsWorkerThread();
+        done = true;
+        cv.notify_all();
+    });
+
+    std::unique_lock<std::mutex> lock{mutex};
+    cv.wait(lock, [&]() { return done; });
+    EXPECT_TRUE(is_worker_thread);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace chainerx
@@ -259,6 +259,113 @@ def test_conv_invalid(
                 cover_all, float_dtype))
 
 
+@op_utils.op_test(['native:0', 'cuda:0'])
+@chainer.testing.parameterize(*(
+    chainer.testing.product([
+        chainer.testing.from_pytest_parameterize(
+            'x_shape,w_shape,b_shape,stride,pad', [
+                ((2, 3, 4), (5, 3, 1), (5,), 1, 0),
+                ((1, 3, 4), (5, 3, 2), None, 3, 2),
+                ((2, 3, 4, 4), (2, 3, 3, 3), (2,), 1, 0),
+                ((1, 3, 4, 4), (2, 3, 3, 3), None, (1, 2), 1),
+                ((1, 3, 2, 6, 3), (2, 3, 1, 3, 2), (2,), 2, (2, 0, 1)),
+            ]),
+        chainer.testing.from_pytest_parameterize(
+            'dtype', chainerx.testing.float_dtypes),
+        chainer.testing.from_pytest_parameterize(
+            'activation', ['none', 'relu']),
+    ])
+))
+@chainer.testing.parameterize_pytest('cover_all', [True, False])
+class TestConvBiasActivation(op_utils.ChainerOpTest):
+
+    def setup(self):
+        device = chainerx.get_default_device()
+        if device.backend.name == 'cuda' and len(self.x_shape) <= 3:
+            pytest.skip('cudnn does not support 1-dim convolution')
+        if device.backend.name == 'cuda' and self.cover_all:
+            pytest.skip('cudnn does not support cover_all')
+
+        if self.activation == 'relu':
+            # ReLU is not differentiable at 0.
+            self.skip_backward_test = True
+            self.skip_double_backward_test = True
+
+        if self.dtype == 'float16':
+            self.check_forward_options.update({'rtol': 5e-2, 'atol': 5e-3})
+            self.check_backward_options.update({
+                'eps': 2 ** -3, 'rtol': 1e-1, 'atol': 1e-2})
+        else:
+            self.check_forward_options.update({'rtol': 1e-3})
+            self.check_backward_options.update({
+                'eps': 1e-2, 'rtol': 1e-3, 'atol': 1e-4})
+        self.check_double_backward_options.update({
+            'rtol': 5e-2, 'atol': 5e-3})
+
+    def generate_inputs(self):
+        x = array_utils.uniform(self.x_shape, self.dtype)
+        w = array_utils.uniform(self.w_shape, self.dtype)
+        if self.b_shape is None:
+            return x, w
+        b = array_utils.uniform(self.b_shape, self.dtype)
+        return x, w, b
+
+    def forward_chainerx(self, inputs):
+        if len(inputs) == 2:
+            (x, w), b = inputs, None
+        else:
+            x, w, b = inputs
+        y = chainerx.conv_bias_activation(
+            x, w, b, self.stride, self.pad, self.cover_all, self.activation)
+        return y,
+
+    def forward_chainer(self, inputs):
+        if len(inputs) == 2:
+            (x, w), b = inputs, None
+        else:
+            x, w, b = inputs
+        y = F.convolution_nd(
+            x, w, b, self.stride, self.pad, self.cover_all)
+        if self.activation == 'relu':
+            y = F.relu(y)
+        return y,
+
+
+@pytest.mark.parametrize('x_shape,w_shape,b_shape,stride,pad', [
+    # Mismatched x and w input channels.
+    ((1, 3, 4, 3), (5, 4, 2, 2), (5,), 3, 2),
+    ((1, 3, 4, 3), (5, 3, 2, 2), (6,), 1, 0),  # Mismatched w and b.
+    ((2, 3, 4, 3), (5, 3, 2, 2), None, (1,), 0),  # Wrong number of strides.
+])
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_conv_bias_activation_invalid_dimensions(
+        device, x_shape, w_shape, b_shape, stride, pad, float_dtype):
+    x, w, b, stride, pad, _ = _create_conv_args(
+        chainerx, device, x_shape, w_shape, b_shape, stride, pad, False,
+        float_dtype)
+    with pytest.raises(chainerx.DimensionError):
+        chainerx.conv_bias_activation(x, w, b, stride, pad)
+
+
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_conv_bias_activation_invalid_dtype(device):
+    x, w, b, stride, pad, _ = _create_conv_args(
+        chainerx, device, (1, 3, 4, 3), (5, 3, 2, 2), (5,), 1, 0, False,
+        'int32')
+    with pytest.raises(chainerx.DtypeError):
+        chainerx.conv_bias_activation(x, w, b, stride, pad)
+
+
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_conv_bias_activation_invalid_activation(device):
+    x, w, b, stride, pad, _ = _create_conv_args(
+        chainerx, device, (1, 3, 4, 3), (5, 3, 2, 2), (5,), 1, 0, False,
+        'float32')
+    with pytest.raises(ValueError):
+        chainerx.conv_bias_activation(
+            x, w, b, stride, pad, activation='sigmoid')
+
+
 class _ConvTransposeTestBase(object):
 
     def setup(self):
@@ -674,3 +781,109 @@ def test_lstm_invalid_dtype(device, c_shape, x_shape, in_dtypes,
         chainerx.lstm(
             *_create_lstm_args(
                 chainerx, device, c_shape, x_shape, in_dtypes))
+
+
+def _scaled_dot_product_attention_expected(q, k, v, mask, scale):
+    scores = numpy.matmul(q, numpy.swapaxes(k, -1, -2)) * scale
+    if mask is not None:
+        scores = numpy.where(mask, scores, -numpy.inf)
+    scores_max = scores.max(axis=-1, keepdims=True)
+    scores_max = numpy.where(numpy.isfinite(scores_max), scores_max, 0)
+    e = numpy.exp(scores - scores_max)
+    e_sum = e.sum(axis=-1, keepdims=True)
+    # Queries whose keys are all masked yield zeros.
+    probs = e / numpy.where(e_sum == 0, 1, e_sum)
+    return numpy.matmul(probs, v)
+
+
+@op_utils.op_test(['native:0', 'cuda:0'])
+@chainer.testing.parameterize(*(
+    chainer.testing.product([
+        chainer.testing.from_pytest_parameterize(
+            'q_shape,k_shape,v_shape,mask_shape', [
+                ((3, 2), (4, 2), (4, 3), None),
+                ((2, 3, 4), (2, 5, 4), (2, 5, 2), None),
+                ((2, 3, 4), (2, 5, 4), (2, 5, 2), (3, 5)),
+                ((2, 2, 3, 4), (2, 2, 70, 4), (2, 2, 70, 3), (2, 1, 3, 70)),
+                ((2, 0, 4), (2, 5, 4), (2, 5, 2), None),
+                ((2, 3, 4), (2, 0, 4), (2, 0, 2), None),
+            ]),
+        chainer.testing.from_pytest_parameterize(
+            'dtype', ['float16', 'float32', 'float64']),
+        chainer.testing.from_pytest_parameterize(
+            'scale', [None, 0.5]),
+    ])
+))
+class TestScaledDotProductAttention(op_utils.OpTest):
+
+    def setup(self):
+        if 0 in self.q_shape or 0 in self.k_shape:
+            self.skip_backward_test = True
+            self.skip_double_backward_test = True
+
+        if self.mask_shape is not None:
+            # Masks every other key, and all keys of the first query.
+            mask = numpy.zeros(self.mask_shape, dtype='bool_')
+            mask[..., ::2] = True
+            mask[..., 0, :] = False
+            self.mask = mask
+
+        if self.dtype == 'float16':
+            self.check_forward_options.update({'rtol': 1e-2, 'atol': 1e-2})
+            self.check_backward_options.update({'rtol': 1e-2, 'atol': 1e-2})
+            self.check_double_backward_options.update(
+                {'rtol': 1e-2, 'atol': 1e-2})
+        elif self.dtype == 'float32':
+            self.check_backward_options.update({'rtol': 1e-3, 'atol': 1e-3})
+            self.check_double_backward_options.update(
+                {'rtol': 1e-3, 'atol': 1e-3})
+
+    def generate_inputs(self):
+        q = array_utils.uniform(self.q_shape, self.dtype)
+        k = array_utils.uniform(self.k_shape, self.dtype)
+        v = array_utils.uniform(self.v_shape, self.dtype)
+        return q, k, v
+
+    def forward_chainerx(self, inputs):
+        q, k, v = inputs
+        mask = None
+        if self.mask_shape is not None:
+            mask = chainerx.array(self.mask, device=q.device)
+        return chainerx.scaled_dot_product_attention(
+            q, k, v, mask, self.scale),
+
+    def forward_expected(self, inputs):
+        q, k, v = inputs
+        mask = self.mask if self.mask_shape is not None else None
+        scale = self.scale
+        if scale is None:
+            scale = 1. / numpy.sqrt(self.q_shape[-1])
+        y = _scaled_dot_product_attention_expected(
+            q.astype('float64'), k.astype('float64'), v.astype('float64'),
+            mask, scale)
+        return y.astype(self.dtype),
+
+
+@pytest.mark.parametrize('q_shape,k_shape,v_shape,mask_shape', [
+    # q.ndim < 2
+    ((4,), (4,), (4,), None),
+    # Mismatched batch shapes
+    ((2, 3, 4), (3, 5, 4), (3, 5, 2), None),
+    # Mismatched feature sizes of q and k
+    ((2, 3, 4), (2, 5, 3), (2, 5, 2), None),
+    # Mismatched numbers of keys and values
+    ((2, 3, 4), (2, 5, 4), (2, 6, 2), None),
+    # Mask not broadcastable to the scores
+    ((2, 3, 4), (2, 5, 4), (2, 5, 2), (3, 4)),
+])
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_scaled_dot_product_attention_invalid_dimensions(
+        device, q_shape, k_shape, v_shape, mask_shape, float_dtype):
+    q = array_utils.create_dummy_ndarray(chainerx, q_shape, float_dtype)
+    k = array_utils.create_dummy_ndarray(chainerx, k_shape, float_dtype)
+    v = array_utils.create_dummy_ndarray(chainerx, v_shape, float_dtype)
+    mask = None
+    if mask_shape is not None:
+        mask = chainerx.ones(mask_shape, 'bool_')
+    with pytest.raises(chainerx.DimensionError):
+        chainerx.scaled_dot_product_attention(q, k, v, mask)
@@ -26,6 +26,15 @@ _in_out_loss_dtypes = dtype_utils._permutate_dtype_mapping([
 ])
 
 
+def _reduce_loss(loss, reduce):
+    # Reduces elementwise losses computed by Chainer as ChainerX does.
+    if reduce == 'sum':
+        return F.sum(loss)
+    if reduce == 'mean':
+        return F.mean(loss)
+    return loss
+
+
 class LossBase(op_utils.ChainerOpTest):
 
     def setup(self):
@@ -96,16 +105,14 @@ class TestAbsoluteError(LossBase):
     chainer.testing.product({
         'shape': _loss_shapes,
         'in_dtypes,out_dtype': _in_out_loss_dtypes,
+        'reduce': ['no', 'sum', 'mean'],
     })
 ))
 class TestGaussianKLDivergence(LossBase):
 
     def forward_xp(self, inputs, xp):
         mean, ln_var = inputs
-        if xp is chainerx:
-            out = xp.gaussian_kl_divergence(mean, ln_var)
-        else:
-            out = xp.gaussian_kl_divergence(mean, ln_var, reduce='no')
+        out = xp.gaussian_kl_divergence(mean, ln_var, reduce=self.reduce)
         return out,
 
 
@@ -115,6 +122,14 @@ class TestGaussianKLDivergence(LossBase):
         'shape': _loss_shapes,
         'in_dtypes,out_dtype': _in_out_loss_dtypes,
         'delta': [0.01, 0.05, 0.1, 0.2, 0.3, 0.4, 0.5],
+        'reduce': ['no'],
+    })
+    # Reductions
+    + chainer.testing.product({
+        'shape': _loss_shapes,
+        'in_dtypes,out_dtype': _in_out_loss_dtypes,
+        'delta': [0.3],
+        'reduce': ['sum', 'mean'],
     })
 ))
 class TestHuberLoss(LossBase):
@@ -127,9 +142,10 @@ class TestHuberLoss(LossBase):
     def forward_xp(self, inputs, xp):
         x, t = inputs
         if xp is chainerx:
-            out = xp.huber_loss(x, t, self.delta)
+            out = xp.huber_loss(x, t, self.delta, reduce=self.reduce)
         else:
-            out = xp.huber_loss(x, t, self.delta, reduce='no')
+            out = _reduce_loss(
+                xp.huber_loss(x, t, self.delta, reduce='no'), self.reduce)
         return out,
 
 
@@ -139,6 +155,7 @@ class TestHuberLoss(LossBase):
         'shape': _loss_shapes,
         'x_dtype': chainerx.testing.float_dtypes,
         't_dtype': ['int8', 'int16', 'int32', 'int64'],
+        'reduce': ['no', 'sum', 'mean'],
     })
 ))
 class TestSigmoidCrossEntropy(op_utils.ChainerOpTest):
@@ -162,14 +179,14 @@ class TestSigmoidCrossEntropy(op_utils.ChainerOpTest):
         # TODO(aksub99): Improve implementation to avoid non-differentiability
         # wrt targets
         t = self.backend_config.get_array(self.t)
-        out = chainerx.sigmoid_cross_entropy(x, t)
+        out = chainerx.sigmoid_cross_entropy(x, t, reduce=self.reduce)
         return out,
 
     def forward_chainer(self, inputs):
         x, = inputs
         t = self.t
         out = F.sigmoid_cross_entropy(x, t, normalize=False, reduce='no')
-        return out,
+        return _reduce_loss(out, self.reduce),
 
 
 @op_utils.op_test(['native:0', 'cuda:0'])
@@ -217,6 +234,7 @@ class TestSoftmaxCrossEntropy(op_utils.ChainerOpTest):
         'x_dtype': chainerx.testing.float_dtypes,
         't_dtype': ['int8', 'int16', 'int32', 'int64'],
         'norm_float,norm_str': [(1.0, 'L1'), (2.0, 'L2')],
+        'reduce': ['no', 'sum', 'mean'],
     })
 ))
 class TestHinge(op_utils.ChainerOpTest):
@@ -240,7 +258,7 @@ class TestHinge(op_utils.ChainerOpTest):
         x, = inputs
         t = self.backend_config.get_array(self.t)
         norm = self.norm_float
-        out = chainerx.hinge(x, t, norm=norm)
+        out = chainerx.hinge(x, t, norm=norm, reduce=self.reduce)
         return out,
 
     def forward_chainer(self, inputs):
@@ -248,4 +266,4 @@ class TestHinge(op_utils.ChainerOpTest):
         t = self.t
         norm = self.norm_str
         out = F.hinge(x, t, norm=norm, reduce='no')
-        return out,
+        return _reduce_loss(out, self.reduce),
@@ -302,3 +302,282 @@ def test_fixed_batch_norm_invalid_dimensions(
     with pytest.raises(chainerx.DimensionError):
         chainerx.fixed_batch_norm(
             x, gamma, beta, mean=mean, var=var, eps=1e-2, axis=axis)
+
+
+@op_utils.op_test(['native:0', 'cuda:0'])
+@chainer.testing.parameterize(*chainer.testing.product({
+    'w_shape': [(3, 2), (3, 2, 2, 2), (4, 1, 3)],
+    'with_bias': [True, False],
+    'dtype': chainerx.testing.float_dtypes,
+    'eps': [None, 1.2],
+}))
+class TestFoldFixedBatchNorm(op_utils.OpTest):
+
+    def setup(self):
+        if self.dtype == 'float16':
+            self.check_forward_options.update({'rtol': 1e-2, 'atol': 1e-2})
+            self.check_backward_options.update({'rtol': 1e-1, 'atol': 1e-1})
+            self.check_double_backward_options.update(
+                {'rtol': 1e-1, 'atol': 1e-1})
+        else:
+            self.check_backward_options.update({'rtol': 1e-3, 'atol': 1e-3})
+            self.check_double_backward_options.update(
+                {'rtol': 1e-3, 'atol': 1e-3})
+
+    def generate_inputs(self):
+        out_channels = self.w_shape[0]
+        dtype = self.dtype
+        w = numpy.random.uniform(-1, 1, self.w_shape).astype(dtype)
+        gamma = numpy.random.uniform(-1, 1, out_channels).astype(dtype)
+        beta = numpy.random.uniform(-1, 1, out_channels).astype(dtype)
+        mean = numpy.random.uniform(-1, 1, out_channels).astype(dtype)
+        var = numpy.random.uniform(0.5, 1, out_channels).astype(dtype)
+        if not self.with_bias:
+            return w, gamma, beta, mean, var
+        b = numpy.random.uniform(-1, 1, out_channels).astype(dtype)
+        return w, gamma, beta, mean, var, b
+
+    def _get_eps(self):
+        return 2e-5 if self.eps is None else self.eps
+
+    def forward_chainerx(self, inputs):
+        w, gamma, beta, mean, var = inputs[:5]
+        b = inputs[5] if self.with_bias else None
+        if self.eps is None:
+            return chainerx.fold_fixed_batch_norm(
+                w, b, gamma, beta, mean, var)
+        return chainerx.fold_fixed_batch_norm(
+            w, b, gamma, beta, mean, var, eps=self.eps)
+
+    def forward_expected(self, inputs):
+        w, gamma, beta, mean, var = inputs[:5]
+        b = inputs[5] if self.with_bias else numpy.zeros_like(mean)
+        scale = gamma / numpy.sqrt(var + self._get_eps())
+        scale_shape = (-1,) + (1,) * (w.ndim - 1)
+        folded_w = w * scale.reshape(scale_shape)
+        folded_b = (b - mean) * scale + beta
+        return folded_w.astype(self.dtype), folded_b.astype(self.dtype)
+
+
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_fold_fixed_batch_norm_conv(device):
+    # Folding must give the same result as the fixed batch normalization of
+    # the convolution output.
+    x = array_utils.uniform((2, 3, 5, 4), 'float64')
+    w = array_utils.uniform((4, 3, 2, 2), 'float64')
+    b = array_utils.uniform((4,), 'float64')
+    gamma, beta, mean = [
+        array_utils.uniform((4,), 'float64') for _ in range(3)]
+    var = numpy.random.uniform(0.5, 1, (4,)).astype('float64')
+    x, w, b, gamma, beta, mean, var = [
+        chainerx.array(a) for a in (x, w, b, gamma, beta, mean, var)]
+
+    expected = chainerx.fixed_batch_norm(
+        chainerx.conv(x, w, b), gamma, beta, mean, var, axis=(0, 2, 3))
+    folded_w, folded_b = chainerx.fold_fixed_batch_norm(
+        w, b, gamma, beta, mean, var)
+    chainerx.testing.assert_allclose(
+        chainerx.conv(x, folded_w, folded_b), expected, rtol=1e-7, atol=1e-7)
+
+
+@pytest.mark.parametrize('w_shape,b_shape,param_shape', [
+    ((3, 2), None, (2,)),
+    ((3, 2), (2,), (3,)),
+    ((3, 2, 2, 2), None, (3, 1)),
+    ((), None, ()),
+])
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_fold_fixed_batch_norm_invalid_dimensions(
+        device, w_shape, b_shape, param_shape, float_dtype):
+    w = array_utils.create_dummy_ndarray(chainerx, w_shape, float_dtype)
+    b = None
+    if b_shape is not None:
+        b = array_utils.create_dummy_ndarray(chainerx, b_shape, float_dtype)
+    gamma, beta, mean, var = [
+        array_utils.create_dummy_ndarray(chainerx, param_shape, float_dtype)
+        for _ in range(4)]
+    with pytest.raises(chainerx.DimensionError):
+        chainerx.fold_fixed_batch_norm(w, b, gamma, beta, mean, var)
+
+
+# x_shape,axis
+_layer_norm_params = [
+    ((3, 2), None),
+    ((3, 2), -1),
+    ((3, 2), 0),
+    ((5, 4, 3), None),
+    ((5, 4, 3), 1),
+    ((2, 3, 4, 5), -2),
+]
+
+
+@op_utils.op_test(['native:0', 'cuda:0'])
+@chainer.testing.parameterize_pytest('x_shape,axis', _layer_norm_params)
+@chainer.testing.parameterize_pytest('eps', [None, 3e-5, 1.2])
+@chainer.testing.parameterize_pytest('contiguous', [None, 'C'])
+class TestLayerNorm(op_utils.ChainerOpTest):
+
+    def setup(self, float_dtype):
+        self.dtype = float_dtype
+
+        optional_args = {}
+        if self.eps is not None:
+            optional_args['eps'] = self.eps
+        if self.axis is not None:
+            optional_args['axis'] = self.axis
+        self.optional_args = optional_args
+
+        if float_dtype == 'float16':
+            self.check_forward_options.update({'rtol': 1e-2, 'atol': 1e-2})
+            self.check_backward_options.update({'rtol': 1e-1, 'atol': 1e-1})
+            self.check_double_backward_options.update(
+                {'rtol': 1e-1, 'atol': 1e-1})
+        else:
+            self.check_forward_options.update({'rtol': 1e-6, 'atol': 1e-5})
+            self.check_backward_options.update({'rtol': 5e-3, 'atol': 5e-4})
+            self.check_double_backward_options.update(
+                {'rtol': 5e-2, 'atol': 5e-3})
+
+    def _normalized_shape(self):
+        axis = -1 if self.axis is None else self.axis
+        return self.x_shape[axis:]
+
+    def generate_inputs(self):
+        x_shape = self.x_shape
+        normalized_shape = self._normalized_shape()
+        dtype = self.dtype
+
+        x = numpy.random.uniform(-1, 1, x_shape).astype(dtype)
+        gamma = numpy.random.uniform(0.5, 1, normalized_shape).astype(dtype)
+        beta = numpy.random.uniform(-1, 1, normalized_shape).astype(dtype)
+
+        return x, gamma, beta
+
+    def forward_chainerx(self, inputs):
+        x, gamma, beta = inputs
+
+        y = chainerx.layer_norm(x, gamma, beta, **self.optional_args)
+        return y,
+
+    def forward_chainer(self, inputs):
+        x, gamma, beta = inputs
+
+        # chainer.functions.layer_normalization only supports 2-dimensional
+        # inputs normalized along the second axis.
+        size = gamma.size
+        eps = self.optional_args.get('eps', 1e-5)
+        y = chainer.functions.layer_normalization(
+            x.reshape(-1, size), gamma.reshape(size), beta.reshape(size),
+            eps=eps)
+        return y.reshape(x.shape),
+
+
+# x_shape,gamma_shape,beta_shape,axis
+_layer_norm_invalid_dimensions_params = [
+    ((2, 3), (2,), (3,), -1),  # Bad gamma shape.
+    ((2, 3), (3,), (2,), -1),  # Bad beta shape.
+    ((2, 3, 4), (4,), (4,), 1),  # Parameters do not cover the axes.
+    ((2, 3), (3,), (3,), 2),  # Axis out of range.
+]
+
+
+@pytest.mark.parametrize(
+    'x_shape,gamma_shape,beta_shape,axis',
+    _layer_norm_invalid_dimensions_params)
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_layer_norm_invalid_dimensions(
+        device, x_shape, gamma_shape, beta_shape, axis, float_dtype):
+    x = array_utils.create_dummy_ndarray(chainerx, x_shape, float_dtype)
+    gamma = array_utils.create_dummy_ndarray(
+        chainerx, gamma_shape, float_dtype)
+    beta = array_utils.create_dummy_ndarray(chainerx, beta_shape, float_dtype)
+
+    with pytest.raises(chainerx.DimensionError):
+        chainerx.layer_norm(x, gamma, beta, axis=axis)
+
+
+# x_shape,groups
+_group_norm_params = [
+    ((3, 4), 2),
+    ((3, 4), 4),
+    ((2, 6, 3), 3),
+    ((2, 6, 3, 2), 1),
+    ((2, 6, 3, 2), 2),
+    ((2, 4, 2, 2, 2), 4),
+]
+
+
+@op_utils.op_test(['native:0', 'cuda:0'])
+@chainer.testing.parameterize_pytest('x_shape,groups', _group_norm_params)
+@chainer.testing.parameterize_pytest('eps', [None, 3e-5, 1.2])
+@chainer.testing.parameterize_pytest('contiguous', [None, 'C'])
+class TestGroupNorm(op_utils.ChainerOpTest):
+
+    def setup(self, float_dtype):
+        self.dtype = float_dtype
+
+        optional_args = {}
+        if self.eps is not None:
+            optional_args['eps'] = self.eps
+        self.optional_args = optional_args
+
+        if float_dtype == 'float16':
+            self.check_forward_options.update({'rtol': 1e-2, 'atol': 1e-2})
+            self.check_backward_options.update({'rtol': 1e-1, 'atol': 1e-1})
+            self.check_double_backward_options.update(
+                {'rtol': 1e-1, 'atol': 1e-1})
+        else:
+            self.check_forward_options.update({'rtol': 1e-6, 'atol': 1e-5})
+            self.check_backward_options.update({'rtol': 5e-3, 'atol': 5e-4})
+            self.check_double_backward_options.update(
+                {'rtol': 5e-2, 'atol': 5e-3})
+
+    def generate_inputs(self):
+        x_shape = self.x_shape
+        channels = x_shape[1]
+        dtype = self.dtype
+
+        x = numpy.random.uniform(-1, 1, x_shape).astype(dtype)
+        gamma = numpy.random.uniform(0.5, 1, (channels,)).astype(dtype)
+        beta = numpy.random.uniform(-1, 1, (channels,)).astype(dtype)
+
+        return x, gamma, beta
+
+    def forward_chainerx(self, inputs):
+        x, gamma, beta = inputs
+
+        y = chainerx.group_norm(
+            x, self.groups, gamma, beta, **self.optional_args)
+        return y,
+
+    def forward_chainer(self, inputs):
+        x, gamma, beta = inputs
+
+        y = chainer.functions.group_normalization(
+            x, self.groups, gamma, beta, **self.optional_args)
+        return y,
+
+
+# x_shape,groups,gamma_shape,beta_shape
+_group_norm_invalid_dimensions_params = [
+    ((3,), 1, (3,), (3,)),  # Too few dimensions.
+    ((2, 6, 3), 4, (6,), (6,)),  # Indivisible channels.
+    ((2, 6, 3), 0, (6,), (6,)),  # No groups.
+    ((2, 6, 3), 3, (3,), (6,)),  # Bad gamma shape.
+    ((2, 6, 3), 3, (6,), (3,)),  # Bad beta shape.
+]
+
+
+@pytest.mark.parametrize(
+    'x_shape,groups,gamma_shape,beta_shape',
+    _group_norm_invalid_dimensions_params)
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_group_norm_invalid_dimensions(
+        device, x_shape, groups, gamma_shape, beta_shape, float_dtype):
+    x = array_utils.create_dummy_ndarray(chainerx, x_shape, float_dtype)
+    gamma = array_utils.create_dummy_ndarray(
+        chainerx, gamma_shape, float_dtype)
+    beta = array_utils.create_dummy_ndarray(chainerx, beta_shape, float_dtype)
+
+    with pytest.raises(chainerx.DimensionError):
+        chainerx.group_norm(x, groups, gamma, beta)
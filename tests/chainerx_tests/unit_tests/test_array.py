@@ -550,6 +550,37 @@ def test_array_cleargrad():
         5, 7, 8], 'Clearing grad must not affect previously retrieved grad'
 
 
+def test_array_zerograd():
+    dtype = chainerx.float32
+    array = chainerx.array([2, 5, 1], dtype).require_grad()
+    array.zerograd()
+    assert array.get_grad()._debug_flat_data == [0, 0, 0]
+
+    # Gradients of multiple backward calls are accumulated.
+    for _ in range(2):
+        chainerx.backward(array * 3)
+    assert array.get_grad()._debug_flat_data == [6, 6, 6]
+
+
+def test_array_zerograd_shared_grad():
+    dtype = chainerx.float32
+    array = chainerx.array([2, 5, 1], dtype).require_grad()
+    grad = chainerx.array([5, 7, 8], dtype)
+    array.set_grad(grad)
+
+    array.zerograd()
+    assert array.get_grad()._debug_flat_data == [0, 0, 0]
+    assert grad._debug_flat_data == [
+        5, 7, 8], 'Zeroing grad must not affect a grad referenced elsewhere'
+
+    chainerx.backward(array * 3)
+    zeroed_grad = array.get_grad()
+    chainerx.backward(array * 3)
+    assert zeroed_grad._debug_flat_data == [
+        3, 3, 3], 'Backward must not affect a grad referenced elsewhere'
+    assert array.get_grad()._debug_flat_data == [6, 6, 6]
+
+
 def test_array_grad_identity():
     array = chainerx.array([1., 1., 1.], chainerx.float32)
     grad = chainerx.array([0.5, 0.5, 0.5], chainerx.float32)
@@ -656,3 +656,55 @@ def test_grad_with_retain_grad():
 
     _assert_arrays_equal(expected_retain[0], b.get_grad(backprop_id))
     _assert_arrays_equal(expected_retain[1], a.get_grad(backprop_id))
+
+
+def _forward_branching(x1, x2):
+    y = x1 * x2
+    for i in range(1, 9):
+        h = chainerx.exp(x1 * (0.1 * i)) * x2 + x1 / (x2 + i)
+        y = y + h * h
+    return y.sum()
+
+
+@pytest.mark.parametrize(
+    'execution_mode', ['serial', 'parallel_deterministic', 'parallel'])
+@pytest.mark.parametrize('method', ['backward', 'ndarray', 'grad'])
+def test_backward_execution_mode(execution_mode, method):
+    shape = (10,)
+    dtype = chainerx.float32
+
+    def make_inputs():
+        return (
+            (chainerx.arange(10, dtype=dtype) * 0.1 + 0.5).require_grad(),
+            (chainerx.arange(10, dtype=dtype) * 0.1 + 1.5).require_grad(),)
+
+    xs = make_inputs()
+    chainerx.backward(_forward_branching(*xs))
+    expected_gxs = [x.grad for x in xs]
+
+    xs = make_inputs()
+    y = _forward_branching(*xs)
+    if method == 'backward':
+        chainerx.backward(y, execution_mode=execution_mode)
+        gxs = [x.grad for x in xs]
+    elif method == 'ndarray':
+        y.backward(execution_mode=execution_mode)
+        gxs = [x.grad for x in xs]
+    else:
+        gxs = chainerx.grad([y], list(xs), execution_mode=execution_mode)
+
+    for gx, expected_gx in zip(gxs, expected_gxs):
+        assert gx.shape == shape
+        if execution_mode == 'parallel':
+            # The order of accumulation is not specified.
+            chainerx.testing.assert_allclose(
+                gx, expected_gx, rtol=1e-5, atol=1e-6)
+        else:
+            _assert_arrays_equal(gx, expected_gx)
+
+
+def test_backward_invalid_execution_mode():
+    x = chainerx.full((1,), 3, chainerx.float32).require_grad()
+    y = x * 2
+    with pytest.raises(ValueError):
+        chainerx.backward(y, execution_mode='unknown')